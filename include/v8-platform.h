@@ -331,6 +331,16 @@ class Platform {
     CallOnWorkerThread(std::move(task));
   }
 
+  /**
+   * Schedules a task to be invoked with low-priority on a worker thread. Such
+   * tasks are speculative and should not delay other worker tasks.
+   */
+  virtual void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) {
+    // Embedders may optionally override this to process these tasks in a low
+    // priority pool.
+    CallOnWorkerThread(std::move(task));
+  }
+
   /**
    * Schedules a task to be invoked on a worker thread after |delay_in_seconds|
    * expires.
@@ -1559,9 +1559,23 @@ class V8_EXPORT ScriptCompiler {
    * Creates and returns code cache for the specified unbound_script.
    * This will return nullptr if the script cannot be serialized. The
    * CachedData returned by this function should be owned by the caller.
+   * A code cache created after the script has been running records which
+   * functions were optimized, so that they are optimized early again when
+   * the cache is consumed.
    */
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script);
 
+  /**
+   * Like CreateCodeCache above, but first compiles the functions of the
+   * script that start at one of the given source positions. The positions
+   * are typically the function start positions reported by best-effort
+   * coverage after a warmup run, so that the cache contains exactly the
+   * functions needed during startup.
+   */
+  static CachedData* CreateCodeCache(
+      Local<UnboundScript> unbound_script,
+      const std::vector<int>& hot_function_positions);
+
   /**
    * Creates and returns code cache for the specified unbound_module_script.
    * This will return nullptr if the script cannot be serialized. The
@@ -6738,12 +6752,18 @@ class V8_EXPORT HeapObjectStatistics {
   const char* object_sub_type() { return object_sub_type_; }
   size_t object_count() { return object_count_; }
   size_t object_size() { return object_size_; }
+  /**
+   * Half-width of the 95% confidence interval of object_size() when the
+   * statistics were estimated from a sample of the heap, and 0 otherwise.
+   */
+  size_t object_size_error() { return object_size_error_; }
 
  private:
   const char* object_type_;
   const char* object_sub_type_;
   size_t object_count_;
   size_t object_size_;
+  size_t object_size_error_;
 
   friend class Isolate;
 };
@@ -6763,6 +6783,42 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Distribution of the time spent in one garbage collection phase. A phase is
+ * either the whole pause of a collector or a tracer scope, which is sampled
+ * once per garbage collection it was active in. Background phases report the
+ * time spent on background threads. Percentiles are bucket bounds with a
+ * relative error of at most 12.5%.
+ */
+class V8_EXPORT GCPhaseStatistics {
+ public:
+  GCPhaseStatistics();
+  const char* phase_name() { return phase_name_; }
+  bool is_background() { return is_background_; }
+  size_t sample_count() { return sample_count_; }
+  double total_time_ms() { return total_time_ms_; }
+  double max_time_ms() { return max_time_ms_; }
+  double p50_time_ms() { return p50_time_ms_; }
+  double p90_time_ms() { return p90_time_ms_; }
+  double p99_time_ms() { return p99_time_ms_; }
+  // Bytes promoted to the old generation. Only reported for the collector
+  // pause phases.
+  size_t promoted_bytes() { return promoted_bytes_; }
+
+ private:
+  const char* phase_name_;
+  bool is_background_;
+  size_t sample_count_;
+  double total_time_ms_;
+  double max_time_ms_;
+  double p50_time_ms_;
+  double p90_time_ms_;
+  double p99_time_ms_;
+  size_t promoted_bytes_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 /**
@@ -6937,6 +6993,16 @@ class V8_EXPORT EmbedderHeapTracer {
   virtual void RegisterV8References(
       const std::vector<std::pair<void*, void*> >& embedder_fields) = 0;
 
+  /**
+   * Returns true if |RegisterV8References| may be called from V8's concurrent
+   * marking threads. Wrappers found by those threads are then handed to the
+   * embedder directly instead of being processed on the main thread. The
+   * embedder is responsible for synchronizing |RegisterV8References| with its
+   * own tracing. All registrations from marking threads have completed
+   * before tracing is finalized in the atomic pause.
+   */
+  virtual bool SupportsConcurrentRegistration() { return false; }
+
   /**
    * Called at the beginning of a GC cycle.
    */
@@ -7423,6 +7489,15 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Optional notification that the isolate likely holds garbage, e.g. after
+   * the embedder released a large object graph. V8 then reduces memory with
+   * a few garbage collections once the isolate is idle. With
+   * --memory-reducer-stagger-ms these collections are coordinated with other
+   * isolates in the process.
+   */
+  void RequestMemoryReduction();
+
   /**
    * Methods below this point require holding a lock (using Locker) in
    * a multi-threaded environment.
@@ -7539,6 +7614,22 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Returns the number of garbage collection phases for which pause time
+   * distributions are recorded.
+   */
+  size_t NumberOfGCPhases();
+
+  /**
+   * Get the pause time distribution of a garbage collection phase.
+   *
+   * \param phase_statistics The GCPhaseStatistics object to fill in.
+   * \param index The index of the phase, which ranges from 0 to
+   *   NumberOfGCPhases() - 1.
+   * \returns true on success.
+   */
+  bool GetGCPhaseStatistics(GCPhaseStatistics* phase_statistics, size_t index);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7952,6 +8043,38 @@ class V8_EXPORT Isolate {
    */
   bool IdleNotificationDeadline(double deadline_in_seconds);
 
+  /**
+   * Priority of the garbage collection work V8 may do between two requests,
+   * see IdleNotificationBetweenRequests().
+   */
+  enum class IdleGCPriority {
+    /**
+     * Only work that is estimated to finish before the deadline is done, so
+     * that the next request is not delayed. Incremental marking is not
+     * started.
+     */
+    kLatencyCritical,
+    /**
+     * In addition, incremental marking may be started if the old generation
+     * is close to its limit, trading some latency of the following requests
+     * for avoiding a full garbage collection during a request.
+     */
+    kThroughput
+  };
+
+  /**
+   * Optional notification for server embedders that a request has finished
+   * and no further request is expected before deadline_in_seconds. V8 uses
+   * the idle period to scavenge a well-filled young generation, to advance
+   * incremental marking, and to finalize marking if that fits into the
+   * remaining time. The deadline is based on the same timebase as
+   * MonotonicallyIncreasingTime(). Returns true if V8 has no more garbage
+   * collection work to do.
+   */
+  bool IdleNotificationBetweenRequests(
+      double deadline_in_seconds,
+      IdleGCPriority priority = IdleGCPriority::kLatencyCritical);
+
   /**
    * Optional notification that the system is running low on memory.
    * V8 uses these notifications to attempt to free memory.
@@ -8100,6 +8223,23 @@ class V8_EXPORT Isolate {
   void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  /**
+   * Configures the heuristics that grow the old generation between full
+   * garbage collections.
+   *
+   * |gc_time_budget_ms_per_second| is the garbage collection time the
+   * embedder is willing to spend per second of execution. The heap grows
+   * faster when the observed garbage collection speed would otherwise exceed
+   * this budget. Passing zero restores the default budget.
+   *
+   * If |memory_envelope_in_bytes| is non-zero, the heap grows more slowly as
+   * the old generation approaches the envelope. Unlike the heap limit, the
+   * envelope is a soft target: exceeding it does not cause an out-of-memory
+   * failure.
+   */
+  void SetHeapGrowingPolicy(double gc_time_budget_ms_per_second,
+                            size_t memory_envelope_in_bytes);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
@@ -45,6 +45,7 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -2593,6 +2594,16 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(shared);
 }
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
+    Local<UnboundScript> unbound_script,
+    const std::vector<int>& hot_function_positions) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  DCHECK(shared->is_toplevel());
+  return i::CodeSerializer::Serialize(shared, hot_function_positions);
+}
+
 // static
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
     Local<UnboundModuleScript> unbound_module_script) {
@@ -5933,7 +5944,19 @@ HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
       object_sub_type_(nullptr),
       object_count_(0),
-      object_size_(0) {}
+      object_size_(0),
+      object_size_error_(0) {}
+
+GCPhaseStatistics::GCPhaseStatistics()
+    : phase_name_(nullptr),
+      is_background_(false),
+      sample_count_(0),
+      total_time_ms_(0),
+      max_time_ms_(0),
+      p50_time_ms_(0),
+      p90_time_ms_(0),
+      p99_time_ms_(0),
+      promoted_bytes_(0) {}
 
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
@@ -8477,7 +8500,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (V8_LIKELY(!i::FLAG_gc_stats)) return false;
+  if (V8_LIKELY(!i::FLAG_gc_stats &&
+                i::FLAG_gc_object_stats_sampling_interval == 0)) {
+    return false;
+  }
 
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
@@ -8498,6 +8524,8 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
   object_statistics->object_sub_type_ = object_sub_type;
   object_statistics->object_count_ = object_count;
   object_statistics->object_size_ = object_size;
+  object_statistics->object_size_error_ =
+      heap->ObjectSizeErrorAtLastGC(type_index);
   return true;
 }
 
@@ -8516,6 +8544,30 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+size_t Isolate::NumberOfGCPhases() { return i::GCTracer::kNumberOfPhases; }
+
+bool Isolate::GetGCPhaseStatistics(GCPhaseStatistics* phase_statistics,
+                                   size_t index) {
+  if (!phase_statistics) return false;
+  if (index >= NumberOfGCPhases()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::GCTracer::PhaseStatistics stats;
+  isolate->heap()->tracer()->GetPhaseStatistics(static_cast<int>(index),
+                                                &stats);
+
+  phase_statistics->phase_name_ = stats.name;
+  phase_statistics->is_background_ = stats.is_background;
+  phase_statistics->sample_count_ = stats.histogram->count();
+  phase_statistics->total_time_ms_ = stats.histogram->total_ms();
+  phase_statistics->max_time_ms_ = stats.histogram->max_ms();
+  phase_statistics->p50_time_ms_ = stats.histogram->Percentile(50);
+  phase_statistics->p90_time_ms_ = stats.histogram->Percentile(90);
+  phase_statistics->p99_time_ms_ = stats.histogram->Percentile(99);
+  phase_statistics->promoted_bytes_ = stats.promoted_bytes;
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -8673,6 +8725,14 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   return isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
+bool Isolate::IdleNotificationBetweenRequests(double deadline_in_seconds,
+                                              IdleGCPriority priority) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!i::FLAG_use_idle_notification) return true;
+  return isolate->heap()->IdleNotificationBetweenRequests(
+      deadline_in_seconds, priority == IdleGCPriority::kThroughput);
+}
+
 void Isolate::LowMemoryNotification() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   {
@@ -8727,6 +8787,11 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   isolate->allocator()->MemoryPressureNotification(level);
 }
 
+void Isolate::RequestMemoryReduction() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->RequestMemoryReduction();
+}
+
 void Isolate::EnableMemorySavingsMode() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->EnableMemorySavingsMode();
@@ -8832,6 +8897,13 @@ void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
 }
 
+void Isolate::SetHeapGrowingPolicy(double gc_time_budget_ms_per_second,
+                                   size_t memory_envelope_in_bytes) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetHeapGrowingPolicy(gc_time_budget_ms_per_second,
+                                        memory_envelope_in_bytes);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
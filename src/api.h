@@ -329,7 +329,7 @@ class HandleScopeImplementer {
  public:
   explicit HandleScopeImplementer(Isolate* isolate)
       : isolate_(isolate),
-        spare_(nullptr),
+        spare_count_(0),
         call_depth_(0),
         microtasks_depth_(0),
         microtasks_suppressions_(0),
@@ -342,9 +342,7 @@ class HandleScopeImplementer {
         last_handle_before_deferred_block_(nullptr) {
   }
 
-  ~HandleScopeImplementer() {
-    DeleteArray(spare_);
-  }
+  ~HandleScopeImplementer() { DeleteSpareBlocks(); }
 
   // Threading support for handle data.
   static int ArchiveSpacePerThread();
@@ -415,18 +413,30 @@ class HandleScopeImplementer {
 
   void ReturnBlock(Address* block) {
     DCHECK_NOT_NULL(block);
-    if (spare_ != nullptr) DeleteArray(spare_);
-    spare_ = block;
+    if (spare_count_ == kMaxSpareBlocks) {
+      DeleteArray(block);
+    } else {
+      spare_[spare_count_++] = block;
+    }
   }
 
  private:
+  // Number of handle blocks kept around for reuse once scopes that needed
+  // several extension blocks are closed, so that code repeatedly opening
+  // such scopes does not go to the allocator every time.
+  static const int kMaxSpareBlocks = 8;
+
+  void DeleteSpareBlocks() {
+    while (spare_count_ > 0) DeleteArray(spare_[--spare_count_]);
+  }
+
   void ResetAfterArchive() {
     blocks_.detach();
     entered_contexts_.detach();
     saved_contexts_.detach();
     microtask_context_ = Context();
     entered_context_count_during_microtasks_ = 0;
-    spare_ = nullptr;
+    spare_count_ = 0;
     last_handle_before_deferred_block_ = nullptr;
     call_depth_ = 0;
   }
@@ -440,10 +450,7 @@ class HandleScopeImplementer {
     blocks_.free();
     entered_contexts_.free();
     saved_contexts_.free();
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-      spare_ = nullptr;
-    }
+    DeleteSpareBlocks();
     DCHECK_EQ(call_depth_, 0);
   }
 
@@ -457,7 +464,8 @@ class HandleScopeImplementer {
   // Used as a stack to keep track of saved contexts.
   DetachableVector<Context> saved_contexts_;
   Context microtask_context_;
-  Address* spare_;
+  Address* spare_[kMaxSpareBlocks];
+  int spare_count_;
   int call_depth_;
   int microtasks_depth_;
   int microtasks_suppressions_;
@@ -553,11 +561,8 @@ void HandleScopeImplementer::LeaveMicrotaskContext() {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Address* HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Address* block =
-      (spare_ != nullptr) ? spare_
-                          : NewArray<internal::Address>(kHandleBlockSize);
-  spare_ = nullptr;
-  return block;
+  if (spare_count_ > 0) return spare_[--spare_count_];
+  return NewArray<internal::Address>(kHandleBlockSize);
 }
 
 void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
@@ -582,10 +587,7 @@ void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-    }
-    spare_ = block_start;
+    ReturnBlock(block_start);
   }
   DCHECK((blocks_.empty() && prev_limit == nullptr) ||
          (!blocks_.empty() && prev_limit != nullptr));
@@ -2289,10 +2289,26 @@ void Scope::AllocateVariablesRecursively() {
     return;
   }
 
-  // Allocate variables for inner scopes.
+  // Allocate variables for inner scopes. Stack locals of inner block scopes
+  // live in the frame of the enclosing closure. Sibling block scopes are
+  // never active at the same time, so with --ignition-reuse-block-slots they
+  // start at the same slot and only the largest of them grows the frame.
+  // This scope's own locals are allocated above all of them below.
+  Scope* slot_owner = this;
+  while (slot_owner->is_block_scope()) {
+    slot_owner = slot_owner->outer_scope()->GetDeclarationScope();
+  }
+  int const first_block_slot = slot_owner->num_stack_slots_;
+  int max_block_slots = first_block_slot;
   for (Scope* scope = inner_scope_; scope != nullptr; scope = scope->sibling_) {
     scope->AllocateVariablesRecursively();
+    if (FLAG_ignition_reuse_block_slots && scope->is_block_scope()) {
+      max_block_slots = Max(max_block_slots, slot_owner->num_stack_slots_);
+      slot_owner->num_stack_slots_ = first_block_slot;
+    }
   }
+  slot_owner->num_stack_slots_ =
+      Max(max_block_slots, slot_owner->num_stack_slots_);
 
   DCHECK(!already_resolved_);
   DCHECK_EQ(Context::MIN_CONTEXT_SLOTS, num_heap_slots_);
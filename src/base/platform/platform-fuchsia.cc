@@ -131,6 +131,9 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   UNREACHABLE();  // TODO(scottmg): Port, https://crbug.com/731217.
 }
@@ -915,6 +915,9 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) {
   ::Sleep(static_cast<DWORD>(interval.InMilliseconds()));
 }
@@ -168,6 +168,10 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Hints that the given range of reserved memory may be backed by huge pages
+  // once committed. Returns false if the hint is not supported.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -5,6 +5,7 @@
 #include "src/compilation-cache.h"
 
 #include "src/counters.h"
+#include "src/flags.h"
 #include "src/globals.h"
 #include "src/heap/factory.h"
 #include "src/objects-inl.h"
@@ -15,9 +16,6 @@
 namespace v8 {
 namespace internal {
 
-// The number of generations for each sub cache.
-static const int kRegExpGenerations = 2;
-
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
 
@@ -26,7 +24,7 @@ CompilationCache::CompilationCache(Isolate* isolate)
       script_(isolate),
       eval_global_(isolate),
       eval_contextual_(isolate),
-      reg_exp_(isolate, kRegExpGenerations),
+      reg_exp_(isolate, std::max(1, FLAG_regexp_cache_generations)),
       enabled_(true) {
   CompilationSubCache* subcaches[kSubCacheCount] =
     {&script_, &eval_global_, &eval_contextual_, &reg_exp_};
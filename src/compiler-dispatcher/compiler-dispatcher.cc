@@ -248,7 +248,9 @@ void CompilerDispatcher::ScheduleMoreWorkerTasksIfNeeded() {
     }
     ++num_worker_tasks_;
   }
-  platform_->CallOnWorkerThread(
+  // Jobs that haven't started yet are finished on the main thread when their
+  // function is needed, so the background work is speculative.
+  platform_->CallLowPriorityTaskOnWorkerThread(
       MakeCancelableTask(task_manager_.get(), [this] { DoBackgroundWork(); }));
 }
 
@@ -4,11 +4,14 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/base/template-utils.h"
 #include "src/cancelable-task.h"
 #include "src/compiler.h"
 #include "src/counters.h"
+#include "src/heap/heap-inl.h"
 #include "src/isolate.h"
 #include "src/objects-inl.h"
 #include "src/optimized-compilation-info.h"
@@ -36,6 +39,11 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
   delete job;
 }
 
+// Jobs for functions whose bytecode is this many bytes longer need one more
+// profiler tick to get the same priority.
+const int kBytecodeSizePerPriorityTick = 256;
+const int kPriorityScale = 1024;
+
 }  // namespace
 
 class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
@@ -104,14 +112,68 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DeleteArray(input_queue_);
 }
 
+// static
+int OptimizingCompileDispatcher::ComputePriority(JSFunction* function,
+                                                 bool is_osr) {
+  if (!FLAG_prioritize_concurrent_recompilation) return 0;
+  // The function is stuck in a loop in unoptimized code.
+  if (is_osr) return kMaxInt;
+  if (!function->has_feedback_vector()) return 0;
+  int64_t ticks = function->feedback_vector()->profiler_ticks();
+  int64_t bytecode_length =
+      function->shared()->HasBytecodeArray()
+          ? function->shared()->GetBytecodeArray()->length()
+          : 0;
+  int64_t priority = (ticks + 1) * kPriorityScale /
+                     (1 + bytecode_length / kBytecodeSizePerPriorityTick);
+  return static_cast<int>(std::min(priority, int64_t{kMaxInt - 1}));
+}
+
+int OptimizingCompileDispatcher::HighestPriorityIndex() {
+  DCHECK_LT(0, input_queue_length_);
+  int result = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    const InputQueueEntry& entry = input_queue_[i];
+    const InputQueueEntry& best = input_queue_[result];
+    if (entry.priority > best.priority ||
+        (entry.priority == best.priority &&
+         entry.sequence_number < best.sequence_number)) {
+      result = i;
+    }
+  }
+  return result;
+}
+
+int OptimizingCompileDispatcher::LowestPriorityIndex() {
+  DCHECK_LT(0, input_queue_length_);
+  int result = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    const InputQueueEntry& entry = input_queue_[i];
+    const InputQueueEntry& worst = input_queue_[result];
+    if (entry.priority < worst.priority ||
+        (entry.priority == worst.priority &&
+         entry.sequence_number > worst.sequence_number)) {
+      result = i;
+    }
+  }
+  return result;
+}
+
+OptimizedCompilationJob* OptimizingCompileDispatcher::RemoveInput(int index) {
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, input_queue_length_);
+  OptimizedCompilationJob* job = input_queue_[index].job;
+  DCHECK_NOT_NULL(job);
+  input_queue_length_--;
+  input_queue_[index] = input_queue_[input_queue_length_];
+  return job;
+}
+
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  OptimizedCompilationJob* job = RemoveInput(HighestPriorityIndex());
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
@@ -156,11 +218,7 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
     while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
+      DisposeCompilationJob(RemoveInput(input_queue_length_ - 1), true);
     }
     FlushOutputQueue(true);
     if (FLAG_trace_concurrent_recompilation) {
@@ -202,40 +260,89 @@ void OptimizingCompileDispatcher::Stop() {
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  // Flip the touched code pages back to executable once for the whole batch
+  // instead of once per installed code object.
+  CodePageCollectionMemoryModificationScope code_allocation(isolate_->heap());
+  while (InstallNextOptimizedFunction()) {
+  }
+}
 
-  for (;;) {
-    OptimizedCompilationJob* job = nullptr;
-    {
-      base::MutexGuard access_output_queue_(&output_queue_mutex_);
-      if (output_queue_.empty()) return;
-      job = output_queue_.front();
-      output_queue_.pop();
-    }
-    OptimizedCompilationInfo* info = job->compilation_info();
-    Handle<JSFunction> function(*info->closure(), isolate_);
-    if (function->HasOptimizedCode()) {
-      if (FLAG_trace_concurrent_recompilation) {
-        PrintF("  ** Aborting compilation for ");
-        function->ShortPrint();
-        PrintF(" as it has already been optimized.\n");
-      }
-      DisposeCompilationJob(job, false);
-    } else {
-      Compiler::FinalizeOptimizedCompilationJob(job, isolate_);
+void OptimizingCompileDispatcher::InstallOptimizedFunctionsOnInterrupt() {
+  int const max_jobs = FLAG_concurrent_recompilation_install_batch;
+  if (max_jobs <= 0) return InstallOptimizedFunctions();
+
+  HandleScope handle_scope(isolate_);
+  CodePageCollectionMemoryModificationScope code_allocation(isolate_->heap());
+  for (int i = 0; i < max_jobs; ++i) {
+    if (!InstallNextOptimizedFunction()) return;
+  }
+  // Leave the remaining jobs for the next interrupt, so that a burst of
+  // finished jobs does not turn into one long pause on the main thread.
+  base::MutexGuard access_output_queue_(&output_queue_mutex_);
+  if (!output_queue_.empty()) isolate_->stack_guard()->RequestInstallCode();
+}
+
+bool OptimizingCompileDispatcher::InstallNextOptimizedFunction() {
+  OptimizedCompilationJob* job = nullptr;
+  {
+    base::MutexGuard access_output_queue_(&output_queue_mutex_);
+    if (output_queue_.empty()) return false;
+    job = output_queue_.front();
+    output_queue_.pop();
+  }
+  OptimizedCompilationInfo* info = job->compilation_info();
+  Handle<JSFunction> function(*info->closure(), isolate_);
+  if (function->HasOptimizedCode()) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Aborting compilation for ");
+      function->ShortPrint();
+      PrintF(" as it has already been optimized.\n");
     }
+    DisposeCompilationJob(job, false);
+  } else {
+    Compiler::FinalizeOptimizedCompilationJob(job, isolate_);
   }
+  return true;
+}
+
+bool OptimizingCompileDispatcher::IsQueueAvailable(int priority) {
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (input_queue_length_ < input_queue_capacity_) return true;
+  return input_queue_[LowestPriorityIndex()].priority < priority;
 }
 
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
-  DCHECK(IsQueueAvailable());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  QueueForOptimization(job, ComputePriority(*info->closure(), info->is_osr()));
+}
+
+void OptimizingCompileDispatcher::QueueForOptimization(
+    OptimizedCompilationJob* job, int priority) {
+  DCHECK(IsQueueAvailable(priority));
+  OptimizedCompilationJob* cancelled_job = nullptr;
   {
-    // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
+    if (input_queue_length_ == input_queue_capacity_) {
+      // Replace the coldest job. Its compile task finds one job less in the
+      // queue and does nothing.
+      int index = LowestPriorityIndex();
+      DCHECK_LT(input_queue_[index].priority, priority);
+      cancelled_job = RemoveInput(index);
+    }
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[input_queue_length_] = {job, priority,
+                                         next_sequence_number_++};
     input_queue_length_++;
   }
+  if (cancelled_job != nullptr) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Cancelled concurrent optimization of ");
+      cancelled_job->compilation_info()->closure()->ShortPrint();
+      PrintF(" in favor of a hotter function.\n");
+    }
+    DisposeCompilationJob(cancelled_job, true);
+  }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
   } else {
@@ -14,10 +14,12 @@
 #include "src/base/platform/platform.h"
 #include "src/flags.h"
 #include "src/globals.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class OptimizedCompilationJob;
 class SharedFunctionInfo;
 
@@ -27,28 +29,44 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
         input_queue_length_(0),
-        input_queue_shift_(0),
+        next_sequence_number_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
 
   void Stop();
   void Flush(BlockingBehavior blocking_behavior);
-  // Takes ownership of |job|.
+  // Takes ownership of |job|. If the queue is full, the queued job with the
+  // lowest priority is cancelled to make room.
   void QueueForOptimization(OptimizedCompilationJob* job);
+  void QueueForOptimization(OptimizedCompilationJob* job, int priority);
   void Unblock();
   void InstallOptimizedFunctions();
+  // Like InstallOptimizedFunctions, but finalizes at most
+  // --concurrent-recompilation-install-batch jobs and requests another
+  // install interrupt for the rest.
+  void InstallOptimizedFunctionsOnInterrupt();
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Returns true if a job with the given priority can be queued, either
+  // because there is space left or because a job with a lower priority can
+  // be cancelled.
+  bool IsQueueAvailable(int priority);
+
+  // Priority of optimizing |function|, based on its profiler ticks relative
+  // to its bytecode size. OSR jobs are always served first. Must be called on
+  // the main thread.
+  static int ComputePriority(JSFunction* function, bool is_osr);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
@@ -56,24 +74,34 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    int priority;
+    // Breaks ties between jobs of the same priority in FIFO order.
+    uint64_t sequence_number;
+  };
+
   void FlushOutputQueue(bool restore_function_code);
+  // Finalizes the oldest finished job. Returns false if there was none.
+  bool InstallNextOptimizedFunction();
   void CompileNext(OptimizedCompilationJob* job);
   OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
 
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  // Returns the queue index of the job to be served next or the job to be
+  // cancelled first. The input queue must be locked and non-empty.
+  int HighestPriorityIndex();
+  int LowestPriorityIndex();
+  // Removes the entry at |index| from the locked input queue.
+  OptimizedCompilationJob* RemoveInput(int index);
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Unordered array of incoming recompilation tasks (including OSR). Jobs are
+  // served by priority.
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
-  int input_queue_shift_;
+  uint64_t next_sequence_number_;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
@@ -96,6 +124,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Since flags might get modified while the background thread is running, it
   // is not safe to access them directly.
   int recompilation_delay_;
+
+  FRIEND_TEST(OptimizingCompileDispatcherTest, PriorityOrder);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, CancelLowestPriority);
 };
 }  // namespace internal
 }  // namespace v8
@@ -638,6 +638,9 @@ void InsertCodeIntoOptimizedCodeCache(
   Handle<Code> code = compilation_info->code();
   if (code->kind() != Code::OPTIMIZED_FUNCTION) return;  // Nothing to do.
 
+  // Remember the optimization in the code cache, see RuntimeProfiler.
+  compilation_info->shared_info()->set_has_optimized_at_least_once(true);
+
   // Function context specialization folds-in the function context,
   // so no sharing can occur.
   if (compilation_info->is_function_context_specializing()) {
@@ -689,7 +692,9 @@ bool GetOptimizedCodeNow(OptimizedCompilationJob* job, Isolate* isolate) {
 
 bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
   OptimizedCompilationInfo* compilation_info = job->compilation_info();
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  int priority = OptimizingCompileDispatcher::ComputePriority(
+      *compilation_info->closure(), compilation_info->is_osr());
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable(priority)) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -714,7 +719,8 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
                "V8.RecompileSynchronous");
 
   if (job->PrepareJob(isolate) != CompilationJob::SUCCEEDED) return false;
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
+  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job,
+                                                                 priority);
 
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
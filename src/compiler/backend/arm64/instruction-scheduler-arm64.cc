@@ -361,8 +361,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  // Basic latency modeling for arm64 instructions. The numbers follow the
+  // published latencies of the Neoverse N1 and Cortex-A76 cores and assume
+  // that loads hit the L1 cache.
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -416,15 +417,17 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 1;
 
     case kArm64Ldr:
-    case kArm64LdrD:
-    case kArm64LdrS:
     case kArm64LdrW:
     case kArm64Ldrb:
     case kArm64Ldrh:
     case kArm64Ldrsb:
     case kArm64Ldrsh:
     case kArm64Ldrsw:
-      return 11;
+      return 4;
+
+    case kArm64LdrD:
+    case kArm64LdrS:
+      return 5;
 
     case kArm64Str:
     case kArm64StrD:
@@ -438,13 +441,11 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
-
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+      return 2;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
@@ -458,23 +459,27 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float32Sub:
     case kArm64Float64Add:
     case kArm64Float64Sub:
-      return 5;
-
     case kArm64Float32Abs:
     case kArm64Float32Cmp:
     case kArm64Float32Neg:
     case kArm64Float64Abs:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
+      return 2;
+
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
       return 3;
 
     case kArm64Float32Div:
     case kArm64Float32Sqrt:
-      return 12;
+      return 10;
 
     case kArm64Float64Div:
+      return 15;
+
     case kArm64Float64Sqrt:
-      return 19;
+      return 17;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -485,7 +490,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64RoundTiesEven:
     case kArm64Float64RoundTruncate:
     case kArm64Float64RoundUp:
-      return 5;
+      return 3;
 
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
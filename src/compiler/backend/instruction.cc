@@ -620,6 +620,10 @@ static InstructionBlock* InstructionBlockFor(Zone* zone,
   InstructionBlock* instr_block = new (zone)
       InstructionBlock(zone, GetRpo(block), GetRpo(block->loop_header()),
                        GetLoopEndRpo(block), block->deferred(), is_handler);
+  if (block->control() == BasicBlock::kDeoptimize ||
+      block->control() == BasicBlock::kThrow) {
+    instr_block->mark_cold_exit();
+  }
   // Map successors and precessors
   instr_block->successors().reserve(block->SuccessorCount());
   for (BasicBlock* successor : block->successors()) {
@@ -756,10 +760,15 @@ void InstructionSequence::ComputeAssemblyOrder() {
   new (ao_blocks_) InstructionBlocks(zone());
   ao_blocks_->reserve(instruction_blocks_->size());
 
-  // Place non-deferred blocks.
+  // Place non-deferred blocks. Cold exits are moved out of line with the
+  // deferred blocks, except for the entry block.
   for (InstructionBlock* const block : *instruction_blocks_) {
     DCHECK_NOT_NULL(block);
     if (block->IsDeferred()) continue;            // skip deferred blocks.
+    if (FLAG_turbo_move_cold_exits && block->is_cold_exit() &&
+        block->rpo_number() != RpoNumber::FromInt(0)) {
+      continue;  // skip cold exits.
+    }
     if (block->ao_number() != invalid) continue;  // loop rotated.
     if (block->IsLoopHeader()) {
       bool header_align = true;
@@ -785,7 +794,7 @@ void InstructionSequence::ComputeAssemblyOrder() {
     block->set_ao_number(RpoNumber::FromInt(ao++));
     ao_blocks_->push_back(block);
   }
-  // Add all leftover (deferred) blocks.
+  // Add all leftover (deferred and cold exit) blocks.
   for (InstructionBlock* const block : *instruction_blocks_) {
     if (block->ao_number() == invalid) {
       block->set_ao_number(RpoNumber::FromInt(ao++));
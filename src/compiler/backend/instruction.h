@@ -1396,6 +1396,11 @@ class V8_EXPORT_PRIVATE InstructionBlock final
   bool must_deconstruct_frame() const { return must_deconstruct_frame_; }
   void mark_must_deconstruct_frame() { must_deconstruct_frame_ = true; }
 
+  // Blocks that leave the function by deoptimizing or throwing are not
+  // deferred for register allocation, but are laid out with deferred code.
+  bool is_cold_exit() const { return cold_exit_; }
+  void mark_cold_exit() { cold_exit_ = true; }
+
  private:
   Successors successors_;
   Predecessors predecessors_;
@@ -1412,6 +1417,7 @@ class V8_EXPORT_PRIVATE InstructionBlock final
   bool needs_frame_ = false;
   bool must_construct_frame_ = false;
   bool must_deconstruct_frame_ = false;
+  bool cold_exit_ = false;
 };
 
 class InstructionSequence;
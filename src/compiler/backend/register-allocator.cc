@@ -2981,10 +2981,13 @@ void LinearScanAllocator::FindFreeRegistersForRange(
     DCHECK(cur_inactive->End() > range->Start());
     int cur_reg = cur_inactive->assigned_register();
     // No need to carry out intersections, when this register won't be
-    // interesting to this range anyway.
+    // interesting to this range anyway. Any intersection starts no earlier
+    // than both ranges do, so once the register is blocked by then the
+    // result cannot lower positions[cur_reg]. Only fixed ranges can start
+    // after {range}; all other inactive ranges still get intersected.
     // TODO(mtrofin): extend to aliased ranges, too.
     if ((kSimpleFPAliasing || !check_fp_aliasing()) &&
-        positions[cur_reg] < range->Start()) {
+        positions[cur_reg] <= std::max(range->Start(), cur_inactive->Start())) {
       continue;
     }
 
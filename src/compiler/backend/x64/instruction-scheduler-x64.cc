@@ -348,38 +348,64 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // Basic latency modeling for x64 instructions. The numbers follow the
+  // measured latencies on Skylake and Zen cores, rounded to the slower of
+  // the two where they differ.
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTaggedPointer:
+    case kX64MovqDecompressAnyTagged:
+      // Loads hit the L1 cache in the common case.
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return 5;
+      }
+      return 1;
+    case kSSEFloat32Abs:
+    case kSSEFloat32Neg:
+    case kSSEFloat64Abs:
+    case kSSEFloat64Neg:
+      return 1;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
     case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+      return 3;
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
-    case kSSEFloat32Abs:
-    case kSSEFloat32Neg:
-    case kSSEFloat64Cmp:
+    case kSSEFloat32Mul:
     case kSSEFloat64Add:
     case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-    case kSSEFloat64Abs:
-    case kSSEFloat64Neg:
-      return 3;
-    case kSSEFloat32Mul:
+      return 4;
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
-    case kSSEFloat32Round:
-    case kSSEFloat64Round:
+      return 5;
     case kSSEFloat32ToInt32:
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return 6;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 8;
     case kX64Idiv:
       return 49;
     case kX64Idiv32:
@@ -389,10 +415,13 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kX64Udiv32:
       return 26;
     case kSSEFloat32Div:
-    case kSSEFloat64Div:
+      return 11;
     case kSSEFloat32Sqrt:
+      return 12;
+    case kSSEFloat64Div:
+      return 14;
     case kSSEFloat64Sqrt:
-      return 13;
+      return 16;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
@@ -295,7 +295,7 @@ void TryCloneBranch(Node* node, BasicBlock* block, Zone* temp_zone,
     Node* phi_true = graph->NewNode(phi->op(), input_count + 1, inputs);
     inputs[input_count] = merge_false;
     Node* phi_false = graph->NewNode(phi->op(), input_count + 1, inputs);
-    if (phi->UseCount() == 0) {
+    if (phi->uses().empty()) {
       DCHECK_EQ(phi->opcode(), IrOpcode::kEffectPhi);
     } else {
       for (Edge edge : phi->use_edges()) {
@@ -170,7 +170,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     case kRestrictedInlining:
       return NoChange();
     case kStressInlining:
-      return InlineCandidate(candidate, false);
+      return InlineCandidate(candidate, false,
+                             FLAG_max_inlined_bytecode_size_cumulative);
     case kGeneralInlining:
       break;
   }
@@ -189,7 +190,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       cumulative_count_ < FLAG_max_inlined_bytecode_size_absolute) {
     TRACE("Inlining small function(s) at call site #%d:%s\n", node->id(),
           node->op()->mnemonic());
-    return InlineCandidate(candidate, true);
+    return InlineCandidate(candidate, true,
+                           FLAG_max_inlined_bytecode_size_absolute);
   }
 
   // In the general case we remember the candidate for later.
@@ -215,14 +217,22 @@ void JSInliningHeuristic::Finalize() {
     double size_of_candidate =
         candidate.total_size * FLAG_reserve_inline_budget_scale_factor;
     int total_size = cumulative_count_ + static_cast<int>(size_of_candidate);
-    if (total_size > FLAG_max_inlined_bytecode_size_cumulative) {
+    // Call sites that are hit many times per invocation of the function,
+    // i.e. calls in hot loops, are allowed to use the absolute budget. The
+    // candidates are ordered by frequency, so they get to use it first.
+    int budget = FLAG_max_inlined_bytecode_size_cumulative;
+    if (candidate.frequency.IsKnown() &&
+        candidate.frequency.value() >= FLAG_hot_inlining_frequency) {
+      budget = FLAG_max_inlined_bytecode_size_absolute;
+    }
+    if (total_size > budget) {
       // Try if any smaller functions are available to inline.
       continue;
     }
 
     // Make sure we don't try to inline dead candidate nodes.
     if (!candidate.node->IsDead()) {
-      Reduction const reduction = InlineCandidate(candidate, false);
+      Reduction const reduction = InlineCandidate(candidate, false, budget);
       if (reduction.Changed()) return;
     }
   }
@@ -239,7 +249,7 @@ bool CollectStateValuesOwnedUses(Node* node, Node* state_values,
                                  NodeAndIndex* uses_buffer, size_t* use_count,
                                  size_t max_uses) {
   // Only accumulate states that are not shared with other users.
-  if (state_values->UseCount() > 1) return true;
+  if (state_values->HasMultipleUses()) return true;
   for (int i = 0; i < state_values->InputCount(); i++) {
     Node* input = state_values->InputAt(i);
     if (input->opcode() == IrOpcode::kStateValues) {
@@ -263,7 +273,7 @@ Node* JSInliningHeuristic::DuplicateStateValuesAndRename(Node* state_values,
                                                          StateCloneMode mode) {
   // Only rename in states that are not shared with other users. This needs to
   // be in sync with the condition in {CollectStateValuesOwnedUses}.
-  if (state_values->UseCount() > 1) return state_values;
+  if (state_values->HasMultipleUses()) return state_values;
   Node* copy = mode == kChangeInPlace ? state_values : nullptr;
   for (int i = 0; i < state_values->InputCount(); i++) {
     Node* input = state_values->InputAt(i);
@@ -291,7 +301,7 @@ bool CollectFrameStateUniqueUses(Node* node, Node* frame_state,
                                  NodeAndIndex* uses_buffer, size_t* use_count,
                                  size_t max_uses) {
   // Only accumulate states that are not shared with other users.
-  if (frame_state->UseCount() > 1) return true;
+  if (frame_state->HasMultipleUses()) return true;
   if (frame_state->InputAt(kFrameStateStackInput) == node) {
     if (*use_count >= max_uses) return false;
     uses_buffer[*use_count] = {frame_state, kFrameStateStackInput};
@@ -312,7 +322,7 @@ Node* JSInliningHeuristic::DuplicateFrameStateAndRename(Node* frame_state,
                                                         StateCloneMode mode) {
   // Only rename in states that are not shared with other users. This needs to
   // be in sync with the condition in {DuplicateFrameStateAndRename}.
-  if (frame_state->UseCount() > 1) return frame_state;
+  if (frame_state->HasMultipleUses()) return frame_state;
   Node* copy = mode == kChangeInPlace ? frame_state : nullptr;
   if (frame_state->InputAt(kFrameStateStackInput) == from) {
     if (!copy) {
@@ -614,7 +624,8 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
 }
 
 Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
-                                               bool small_function) {
+                                               bool small_function,
+                                               int budget) {
   int const num_calls = candidate.num_functions;
   Node* const node = candidate.node;
   if (num_calls == 1) {
@@ -682,7 +693,7 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
     Node* node = calls[i];
     if (small_function ||
         (candidate.can_inline_function[i] &&
-         cumulative_count_ < FLAG_max_inlined_bytecode_size_cumulative)) {
+         cumulative_count_ < budget)) {
       Reduction const reduction = inliner_.ReduceJSCall(node);
       if (reduction.Changed()) {
         // Killing the call node is not strictly necessary, but it is safer to
@@ -68,7 +68,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
 
   // Dumps candidates to console.
   void PrintCandidates();
-  Reduction InlineCandidate(Candidate const& candidate, bool small_function);
+  // Inlines {candidate}. The targets of a polymorphic call site are inlined
+  // as long as the cumulative bytecode size stays below {budget}.
+  Reduction InlineCandidate(Candidate const& candidate, bool small_function,
+                            int budget);
   void CreateOrReuseDispatch(Node* node, Node* callee,
                              Candidate const& candidate, Node** if_successes,
                              Node** calls, Node** inputs, int input_count);
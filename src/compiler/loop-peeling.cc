@@ -350,11 +350,51 @@ void EliminateLoopExit(Node* node) {
 
 }  // namespace
 
+void LoopPeeler::PeelOuterLoops(LoopTree::Loop* loop) {
+  // Only peel loops whose nested loops are all innermost loops; the loops
+  // further out would duplicate too much code.
+  bool is_outer_loop = false;
+  for (LoopTree::Loop* inner_loop : loop->children()) {
+    if (!inner_loop->children().empty()) {
+      PeelOuterLoops(inner_loop);
+      is_outer_loop = true;
+    }
+  }
+  if (is_outer_loop || loop->children().empty()) return;
+  // The size now includes the peeled iterations of the inner loops.
+  if (loop->TotalSize() > LoopPeeler::kMaxPeeledNodes) return;
+  if (FLAG_trace_turbo_loop) {
+    PrintF("Peeling outer loop with header: ");
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      PrintF("%i ", node->id());
+    }
+    PrintF("\n");
+  }
+
+  Peel(loop);
+}
+
+void LoopPeeler::PeelOuterLoops() {
+  // Peeling the inner loops invalidated {loop_tree_}, so recompute the loop
+  // structure first. Copies left unused by peeling are not reachable and do
+  // not show up in the new tree; they only make CanPeel bail out.
+  LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph_, tmp_zone_);
+  LoopPeeler peeler(graph_, common_, loop_tree, tmp_zone_, source_positions_,
+                    node_origins_);
+  for (LoopTree::Loop* loop : loop_tree->outer_loops()) {
+    peeler.PeelOuterLoops(loop);
+  }
+}
+
 void LoopPeeler::PeelInnerLoopsOfTree() {
   for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
     PeelInnerLoops(loop);
   }
 
+  // Peeling an enclosing loop as well exposes its invariant loads and checks,
+  // including those of the inner loops, to load elimination.
+  if (FLAG_turbo_peel_outer_loops) PeelOuterLoops();
+
   EliminateLoopExits(graph_, tmp_zone_);
 }
 
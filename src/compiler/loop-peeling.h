@@ -59,6 +59,8 @@ class V8_EXPORT_PRIVATE LoopPeeler {
   NodeOriginTable* const node_origins_;
 
   void PeelInnerLoops(LoopTree::Loop* loop);
+  void PeelOuterLoops();
+  void PeelOuterLoops(LoopTree::Loop* loop);
 };
 
 
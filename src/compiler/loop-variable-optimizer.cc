@@ -220,6 +220,19 @@ const InductionVariable* LoopVariableOptimizer::FindInductionVariable(
   return nullptr;
 }
 
+namespace {
+
+Node* SkipToNumber(Node* input) {
+  if (input->opcode() == IrOpcode::kSpeculativeToNumber ||
+      input->opcode() == IrOpcode::kJSToNumber ||
+      input->opcode() == IrOpcode::kJSToNumberConvertBigInt) {
+    return input->InputAt(0);
+  }
+  return input;
+}
+
+}  // namespace
+
 InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   DCHECK_EQ(2, phi->op()->ValueInputCount());
   Node* loop = NodeProperties::GetControlInput(phi);
@@ -241,14 +254,16 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
     return nullptr;
   }
 
-  // TODO(jarin) Support both sides.
-  Node* input = arith->InputAt(0);
-  if (input->opcode() == IrOpcode::kSpeculativeToNumber ||
-      input->opcode() == IrOpcode::kJSToNumber ||
-      input->opcode() == IrOpcode::kJSToNumberConvertBigInt) {
-    input = input->InputAt(0);
+  // The phi is usually the left operand, but for additions we also accept
+  // it on the right, so that loops written as {i = 1 + i} are recognized.
+  Node* incr = arith->InputAt(1);
+  if (SkipToNumber(arith->InputAt(0)) != phi) {
+    if (arithmeticType != InductionVariable::ArithmeticType::kAddition ||
+        SkipToNumber(arith->InputAt(1)) != phi) {
+      return nullptr;
+    }
+    incr = arith->InputAt(0);
   }
-  if (input != phi) return nullptr;
 
   Node* effect_phi = nullptr;
   for (Node* use : loop->uses()) {
@@ -259,7 +274,6 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   }
   if (!effect_phi) return nullptr;
 
-  Node* incr = arith->InputAt(1);
   return new (zone()) InductionVariable(phi, effect_phi, arith, incr, initial,
                                         zone(), arithmeticType);
 }
@@ -159,6 +159,10 @@ class V8_EXPORT_PRIVATE Node final {
   // Returns true if {owner1} and {owner2} are the only users of {this} node.
   bool OwnedBy(Node const* owner1, Node const* owner2) const;
 
+  // Returns true if {this} node has more than one use. Unlike comparing
+  // {UseCount()}, this does not walk the whole use list.
+  bool HasMultipleUses() const { return first_use_ && first_use_->next; }
+
   void Print() const;
 
  private:
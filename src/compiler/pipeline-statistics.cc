@@ -9,6 +9,8 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/string.h"
 #include "src/optimized-compilation-info.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
 
 namespace v8 {
 namespace internal {
@@ -96,9 +98,49 @@ void PipelineStatistics::BeginPhase(const char* name) {
 
 void PipelineStatistics::EndPhase() {
   DCHECK(InPhaseKind());
+  bool trace_zone_stats = IsZoneStatsTracingEnabled();
+  ZoneStats::StatsScope::AllocatedBytesByZoneName bytes_by_zone_name;
+  if (trace_zone_stats) {
+    phase_stats_.scope_->GetAllocatedBytesByZoneName(&bytes_by_zone_name);
+    bytes_by_zone_name[outer_zone_->name()] +=
+        OuterZoneSize() - phase_stats_.outer_zone_initial_size_;
+  }
   CompilationStatistics::BasicStats diff;
   phase_stats_.End(this, &diff);
   compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
+  if (trace_zone_stats) TraceZoneStats(diff, bytes_by_zone_name);
+}
+
+// static
+bool PipelineStatistics::IsZoneStatsTracingEnabled() {
+  bool enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(
+      TRACE_DISABLED_BY_DEFAULT("v8.turbofan.zone_stats"), &enabled);
+  return enabled;
+}
+
+void PipelineStatistics::TraceZoneStats(
+    const CompilationStatistics::BasicStats& diff,
+    const ZoneStats::StatsScope::AllocatedBytesByZoneName&
+        bytes_by_zone_name) {
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("function", function_name_);
+  value->SetString("phase_kind", phase_kind_name_);
+  value->SetString("phase", phase_name_);
+  // Sizes are reported in KB to stay within the range of the trace integers.
+  value->SetInteger("max_allocated_kb",
+                    static_cast<int>(diff.max_allocated_bytes_ / KB));
+  value->SetInteger("total_allocated_kb",
+                    static_cast<int>(diff.total_allocated_bytes_ / KB));
+  value->BeginDictionary("zones_kb");
+  for (const auto& entry : bytes_by_zone_name) {
+    value->SetInteger(entry.first.c_str(),
+                      static_cast<int>(entry.second / KB));
+  }
+  value->EndDictionary();
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.turbofan.zone_stats"),
+                       "V8.TurboFanPhaseZoneStats", TRACE_EVENT_SCOPE_THREAD,
+                       "stats", std::move(value));
 }
 
 }  // namespace compiler
@@ -27,6 +27,10 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Returns true if the per-phase zone usage is being recorded to the trace,
+  // in which case statistics are collected even without --turbo-stats.
+  static bool IsZoneStatsTracingEnabled();
+
  private:
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
@@ -55,6 +59,9 @@ class PipelineStatistics : public Malloced {
   bool InPhase() { return !!phase_stats_.scope_; }
   void BeginPhase(const char* name);
   void EndPhase();
+  void TraceZoneStats(const CompilationStatistics::BasicStats& diff,
+                      const ZoneStats::StatsScope::AllocatedBytesByZoneName&
+                          bytes_by_zone_name);
 
   Zone* outer_zone_;
   ZoneStats* zone_stats_;
@@ -236,6 +236,11 @@ class PipelineData {
   bool verify_graph() const { return verify_graph_; }
   void set_verify_graph(bool value) { verify_graph_ = value; }
 
+  // Set when the graph is too large to spend the full compile time on it,
+  // see --turbo-compile-budget-node-count.
+  bool reduced_optimization() const { return reduced_optimization_; }
+  void set_reduced_optimization() { reduced_optimization_ = true; }
+
   MaybeHandle<Code> code() { return code_; }
   void set_code(MaybeHandle<Code> code) {
     DCHECK(code_.is_null());
@@ -439,6 +444,7 @@ class PipelineData {
   PipelineStatistics* pipeline_statistics_ = nullptr;
   bool compilation_failed_ = false;
   bool verify_graph_ = false;
+  bool reduced_optimization_ = false;
   int start_source_position_ = kNoSourcePosition;
   base::Optional<OsrHelper> osr_helper_;
   MaybeHandle<Code> code_;
@@ -777,7 +783,8 @@ PipelineStatistics* CreatePipelineStatistics(Handle<Script> script,
                                              ZoneStats* zone_stats) {
   PipelineStatistics* pipeline_statistics = nullptr;
 
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+      PipelineStatistics::IsZoneStatsTracingEnabled()) {
     pipeline_statistics =
         new PipelineStatistics(info, isolate->GetTurboStatistics(), zone_stats);
     pipeline_statistics->BeginPhaseKind("initializing");
@@ -1885,10 +1892,6 @@ bool PipelineImpl::CreateGraph() {
   Run<InliningPhase>();
   RunPrintAndVerify(InliningPhase::phase_name(), true);
 
-  // Remove dead->live edges from the graph.
-  Run<EarlyGraphTrimmingPhase>();
-  RunPrintAndVerify(EarlyGraphTrimmingPhase::phase_name(), true);
-
   // Determine the Typer operation flags.
   {
     if (is_sloppy(info()->shared_info()->language_mode()) &&
@@ -1927,6 +1930,26 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
 
   data->BeginPhaseKind("lowering");
 
+  // Remove dead->live edges from the graph. This only touches the graph and
+  // thus runs on the background thread for concurrent compilation jobs. The
+  // serialization phases in CreateGraph only visit nodes reachable from the
+  // end, so they are not affected by the untrimmed graph.
+  Run<EarlyGraphTrimmingPhase>();
+  RunPrintAndVerify(EarlyGraphTrimmingPhase::phase_name(), true);
+
+  // The graph size after inlining is a good predictor of the compile time.
+  // Very large graphs skip the optional phases with the worst scaling, so
+  // that the function gets reasonable code soon instead of optimal code late.
+  if (FLAG_turbo_compile_budget_node_count > 0 &&
+      data->graph()->NodeCount() >
+          static_cast<size_t>(FLAG_turbo_compile_budget_node_count)) {
+    if (FLAG_trace_opt) {
+      PrintF("[reduced optimization of %s, graph has %" PRIuS " nodes]\n",
+             info()->GetDebugName().get(), data->graph()->NodeCount());
+    }
+    data->set_reduced_optimization();
+  }
+
   // Type the graph and keep the Typer running such that new nodes get
   // automatically typed when they are created.
   Run<TyperPhase>(data->CreateTyper());
@@ -1934,7 +1957,8 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
-  if (data->info()->is_loop_peeling_enabled()) {
+  if (data->info()->is_loop_peeling_enabled() &&
+      !data->reduced_optimization()) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
   } else {
@@ -1942,13 +1966,13 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(LoopExitEliminationPhase::phase_name(), true);
   }
 
-  if (FLAG_turbo_load_elimination) {
+  if (FLAG_turbo_load_elimination && !data->reduced_optimization()) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
   data->DeleteTyper();
 
-  if (FLAG_turbo_escape) {
+  if (FLAG_turbo_escape && !data->reduced_optimization()) {
     Run<EscapeAnalysisPhase>();
     if (data->compilation_failed()) {
       info()->AbortOptimization(
@@ -2759,7 +2783,9 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  bool preprocess_ranges =
+      FLAG_turbo_preprocess_ranges && !data->reduced_optimization();
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
     if (info()->trace_turbo_json_enabled() &&
         !data->MayHaveUnverifiableGraph()) {
@@ -2775,7 +2801,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -278,7 +278,32 @@ Reduction RedundancyElimination::ReduceEffectPhi(Node* node) {
     Node* const input = NodeProperties::GetEffectInput(node, i);
     checks->Merge(node_checks_.Get(input));
   }
-  return UpdateChecks(node, checks);
+
+  // The merge above only keeps the checks that dominate the {node}. A check
+  // without value outputs (i.e. CheckIf) can be reused from any input as long
+  // as an equivalent check happened on every other input, since nothing but
+  // the effect chain refers to it. This removes checks that were repeated on
+  // both sides of a diamond from the code after the merge.
+  EffectPathChecks const* merged_checks = checks;
+  EffectPathChecks const* first_checks =
+      node_checks_.Get(NodeProperties::GetEffectInput(node, 0));
+  for (Check const* check = first_checks->head_; check != checks->head_;
+       check = check->next) {
+    Node* const candidate = check->node;
+    if (candidate->op()->ValueOutputCount() != 0) continue;
+    bool on_all_inputs = true;
+    for (int i = 1; i < input_count; ++i) {
+      Node* const input = NodeProperties::GetEffectInput(node, i);
+      if (!node_checks_.Get(input)->LookupCheck(candidate)) {
+        on_all_inputs = false;
+        break;
+      }
+    }
+    if (on_all_inputs) {
+      merged_checks = merged_checks->AddCheck(zone(), candidate);
+    }
+  }
+  return UpdateChecks(node, merged_checks);
 }
 
 Reduction RedundancyElimination::ReduceSpeculativeNumberComparison(Node* node) {
@@ -3191,6 +3191,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  Node* index32 = index;
   index = Uint32ToUintptr(index);
   if (FLAG_wasm_no_bounds_checks) return index;
 
@@ -3206,6 +3207,11 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     return mcgraph()->IntPtrConstant(0);
   }
   uint64_t end_offset = uint64_t{offset} + access_size - 1u;
+  if (last_bounds_check_.index == index32 &&
+      last_bounds_check_.control == Control() &&
+      end_offset <= last_bounds_check_.end_offset) {
+    return last_bounds_check_.checked_index;
+  }
   Node* end_offset_node = IntPtrConstant(end_offset);
 
   // The accessed memory is [index + offset, index + end_offset].
@@ -3252,6 +3258,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     DCHECK_NOT_NULL(mem_mask);
     index = graph()->NewNode(m->WordAnd(), index, mem_mask);
   }
+  last_bounds_check_ = {index32, end_offset, Control(), index};
   return index;
 }
 
@@ -3407,6 +3414,94 @@ Node* WasmGraphBuilder::StoreMem(MachineRepresentation mem_rep, Node* index,
   return store;
 }
 
+Node* WasmGraphBuilder::BoundsCheckMemRange(Node* start, Node* size,
+                                            wasm::WasmCodePosition position) {
+  start = Uint32ToUintptr(start);
+  if (FLAG_wasm_no_bounds_checks) return start;
+  size = Uint32ToUintptr(size);
+  auto m = mcgraph()->machine();
+  Node* mem_size = instance_cache_->mem_size;
+  // Check {size <= mem_size} first, so {mem_size - size} does not underflow.
+  TrapIfTrue(wasm::kTrapMemOutOfBounds,
+             graph()->NewNode(m->UintLessThan(), mem_size, size), position);
+  Node* effective_size = graph()->NewNode(m->IntSub(), mem_size, size);
+  TrapIfTrue(wasm::kTrapMemOutOfBounds,
+             graph()->NewNode(m->UintLessThan(), effective_size, start),
+             position);
+  return start;
+}
+
+Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
+                                   wasm::WasmCodePosition position) {
+  // Small constant sizes become a single load and store, which the regular
+  // bounds checks cover. Loading before storing keeps overlapping ranges
+  // correct, and an out-of-bounds access traps before memory is written.
+  Uint32Matcher match(size);
+  if (match.HasValue()) {
+    wasm::ValueType type = wasm::kWasmStmt;
+    MachineType memtype = MachineType::None();
+    switch (match.Value()) {
+      case 1:
+        type = wasm::kWasmI32;
+        memtype = MachineType::Uint8();
+        break;
+      case 2:
+        type = wasm::kWasmI32;
+        memtype = MachineType::Uint16();
+        break;
+      case 4:
+        type = wasm::kWasmI32;
+        memtype = MachineType::Uint32();
+        break;
+      case 8:
+        type = wasm::kWasmI64;
+        memtype = MachineType::Uint64();
+        break;
+      default:
+        break;
+    }
+    if (type != wasm::kWasmStmt) {
+      Node* value = LoadMem(type, memtype, src, 0, 0, position);
+      return StoreMem(memtype.representation(), dst, 0, 0, value, position,
+                      type);
+    }
+  }
+
+  Node* dst_index = BoundsCheckMemRange(dst, size, position);
+  Node* src_index = BoundsCheckMemRange(src, size, position);
+  auto m = mcgraph()->machine();
+  Node* dst_address = graph()->NewNode(m->IntAdd(), MemBuffer(0), dst_index);
+  Node* src_address = graph()->NewNode(m->IntAdd(), MemBuffer(0), src_index);
+
+  MachineType sig_types[] = {MachineType::Pointer(), MachineType::Pointer(),
+                             MachineType::Uint32()};
+  MachineSignature sig(0, 3, sig_types);
+  Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
+      ExternalReference::wasm_memory_copy()));
+  return BuildCCall(&sig, function, dst_address, src_address, size);
+}
+
+Node* WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
+                                   wasm::WasmCodePosition position) {
+  // A constant single byte is just a store.
+  Uint32Matcher match(size);
+  if (match.Is(1)) {
+    return StoreMem(MachineRepresentation::kWord8, dst, 0, 0, value, position,
+                    wasm::kWasmI32);
+  }
+
+  Node* dst_index = BoundsCheckMemRange(dst, size, position);
+  Node* dst_address = graph()->NewNode(mcgraph()->machine()->IntAdd(),
+                                       MemBuffer(0), dst_index);
+
+  MachineType sig_types[] = {MachineType::Pointer(), MachineType::Uint32(),
+                             MachineType::Uint32()};
+  MachineSignature sig(0, 3, sig_types);
+  Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
+      ExternalReference::wasm_memory_fill()));
+  return BuildCCall(&sig, function, dst_address, value, size);
+}
+
 namespace {
 Node* GetAsmJsOOBValue(MachineRepresentation rep, MachineGraph* mcgraph) {
   switch (rep) {
@@ -280,6 +280,10 @@ class WasmGraphBuilder {
   Node* StoreMem(MachineRepresentation mem_rep, Node* index, uint32_t offset,
                  uint32_t alignment, Node* val, wasm::WasmCodePosition position,
                  wasm::ValueType type);
+  Node* MemoryCopy(Node* dst, Node* src, Node* size,
+                   wasm::WasmCodePosition position);
+  Node* MemoryFill(Node* dst, Node* value, Node* size,
+                   wasm::WasmCodePosition position);
   static void PrintDebugName(Node* node);
 
   void set_instance_node(Node* instance_node) {
@@ -389,6 +393,17 @@ class WasmGraphBuilder {
   bool needs_stack_check_ = false;
   const bool untrusted_code_mitigations_ = true;
 
+  // The last dynamic bounds check, identified by the (32-bit) index it checked
+  // and the control node it left behind. As long as control did not change, a
+  // check of the same index with a smaller end offset is redundant, because
+  // memories never shrink.
+  struct LastBoundsCheck {
+    Node* index = nullptr;
+    uint64_t end_offset = 0;
+    Node* control = nullptr;
+    Node* checked_index = nullptr;
+  } last_bounds_check_;
+
   wasm::FunctionSig* const sig_;
 
   compiler::WasmDecorator* decorator_ = nullptr;
@@ -401,6 +416,9 @@ class WasmGraphBuilder {
   // BoundsCheckMem receives a uint32 {index} node and returns a ptrsize index.
   Node* BoundsCheckMem(uint8_t access_size, Node* index, uint32_t offset,
                        wasm::WasmCodePosition, EnforceBoundsCheck);
+  // BoundsCheckMemRange traps unless [{start}, {start} + {size}) is within the
+  // memory, and returns {start} as a ptrsize index.
+  Node* BoundsCheckMemRange(Node* start, Node* size, wasm::WasmCodePosition);
   Node* CheckBoundsAndAlignment(uint8_t access_size, Node* index,
                                 uint32_t offset, wasm::WasmCodePosition);
   Node* Uint32ToUintptr(Node*);
@@ -36,16 +36,29 @@ size_t ZoneStats::StatsScope::GetMaxAllocatedBytes() {
 size_t ZoneStats::StatsScope::GetCurrentAllocatedBytes() {
   size_t total = 0;
   for (Zone* zone : zone_stats_->zones_) {
-    total += static_cast<size_t>(zone->allocation_size());
-    // Adjust for initial values.
-    InitialValues::iterator it = initial_values_.find(zone);
-    if (it != initial_values_.end()) {
-      total -= it->second;
-    }
+    total += AllocatedBytesSinceStart(zone);
   }
   return total;
 }
 
+size_t ZoneStats::StatsScope::AllocatedBytesSinceStart(Zone* zone) {
+  size_t size = static_cast<size_t>(zone->allocation_size());
+  // Adjust for initial values.
+  InitialValues::iterator it = initial_values_.find(zone);
+  if (it != initial_values_.end()) {
+    size -= it->second;
+  }
+  return size;
+}
+
+void ZoneStats::StatsScope::GetAllocatedBytesByZoneName(
+    AllocatedBytesByZoneName* result) {
+  *result = returned_bytes_by_zone_name_;
+  for (Zone* zone : zone_stats_->zones_) {
+    (*result)[zone->name()] += AllocatedBytesSinceStart(zone);
+  }
+}
+
 size_t ZoneStats::StatsScope::GetTotalAllocatedBytes() {
   return zone_stats_->GetTotalAllocatedBytes() -
          total_allocated_bytes_at_start_;
@@ -55,6 +68,7 @@ void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
   size_t current_total = GetCurrentAllocatedBytes();
   // Update max.
   max_allocated_bytes_ = std::max(max_allocated_bytes_, current_total);
+  returned_bytes_by_zone_name_[zone->name()] += AllocatedBytesSinceStart(zone);
   // Drop zone from initial value map.
   InitialValues::iterator it = initial_values_.find(zone);
   if (it != initial_values_.end()) {
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "src/globals.h"
@@ -49,14 +50,22 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     size_t GetCurrentAllocatedBytes();
     size_t GetTotalAllocatedBytes();
 
+    // Collects the bytes allocated since the scope was entered, keyed by the
+    // name of the allocating zone. Zones returned while the scope was active
+    // are included.
+    typedef std::map<std::string, size_t> AllocatedBytesByZoneName;
+    void GetAllocatedBytesByZoneName(AllocatedBytesByZoneName* result);
+
    private:
     friend class ZoneStats;
     void ZoneReturned(Zone* zone);
+    size_t AllocatedBytesSinceStart(Zone* zone);
 
     typedef std::map<Zone*, size_t> InitialValues;
 
     ZoneStats* const zone_stats_;
     InitialValues initial_values_;
+    AllocatedBytesByZoneName returned_bytes_by_zone_name_;
     size_t total_allocated_bytes_at_start_;
     size_t max_allocated_bytes_;
 
@@ -1396,7 +1396,9 @@ class RuntimeCallTimerScope {
   SC(pc_to_code, V8.PcToCode)                                       \
   SC(pc_to_code_cached, V8.PcToCodeCached)                          \
   /* The store-buffer implementation of the write barrier. */       \
-  SC(store_buffer_overflows, V8.StoreBufferOverflows)
+  SC(store_buffer_overflows, V8.StoreBufferOverflows)               \
+  /* Overflows that flushed a store buffer on the main thread. */   \
+  SC(store_buffer_stalls, V8.StoreBufferStalls)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
   /* Number of code stubs. */                                                  \
@@ -1429,6 +1431,7 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
@@ -1439,6 +1442,8 @@ class RuntimeCallTimerScope {
   SC(sub_string_native, V8.SubStringNative)                                    \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(regexp_results_cache_hits, V8.RegExpResultsCacheHits)                     \
+  SC(regexp_results_cache_misses, V8.RegExpResultsCacheMisses)                 \
   SC(math_exp_runtime, V8.MathExpRuntime)                                      \
   SC(math_log_runtime, V8.MathLogRuntime)                                      \
   SC(math_pow_runtime, V8.MathPowRuntime)                                      \
@@ -2487,6 +2487,96 @@ void SourceGroup::Execute(Isolate* isolate) {
   }
 }
 
+namespace {
+
+struct LoadGCStats {
+  base::TimeTicks gc_start;
+  base::TimeDelta gc_time;
+  int gc_count = 0;
+};
+
+void LoadGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                    void* data) {
+  LoadGCStats* stats = static_cast<LoadGCStats*>(data);
+  stats->gc_start = base::TimeTicks::HighResolutionNow();
+}
+
+void LoadGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                    void* data) {
+  LoadGCStats* stats = static_cast<LoadGCStats*>(data);
+  stats->gc_time += base::TimeTicks::HighResolutionNow() - stats->gc_start;
+  stats->gc_count++;
+}
+
+}  // namespace
+
+void SourceGroup::RunLoad(Isolate* isolate) {
+  const int iterations = Shell::options.load_iterations;
+  if (iterations <= 0) return;
+  const int index = static_cast<int>(this - Shell::options.isolate_sources);
+  HandleScope handle_scope(isolate);
+  Local<Context> context = isolate->GetCurrentContext();
+  Local<String> name =
+      String::NewFromUtf8(isolate, Shell::options.load_function,
+                          NewStringType::kNormal)
+          .ToLocalChecked();
+  Local<Value> value;
+  if (!context->Global()->Get(context, name).ToLocal(&value) ||
+      !value->IsFunction()) {
+    printf("Error: --load-function '%s' is not a global function\n",
+           Shell::options.load_function);
+    base::OS::ExitProcess(1);
+  }
+  Local<Function> function = Local<Function>::Cast(value);
+
+  LoadGCStats gc_stats;
+  isolate->AddGCPrologueCallback(LoadGCPrologue, &gc_stats);
+  isolate->AddGCEpilogueCallback(LoadGCEpilogue, &gc_stats);
+  std::vector<double> latencies_us;
+  latencies_us.reserve(iterations);
+  base::TimeTicks load_start = base::TimeTicks::HighResolutionNow();
+  for (int i = 0; i < iterations; ++i) {
+    HandleScope iteration_scope(isolate);
+    TryCatch try_catch(isolate);
+    base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+    MaybeLocal<Value> result =
+        function->Call(context, context->Global(), 0, nullptr);
+    latencies_us.push_back(
+        (base::TimeTicks::HighResolutionNow() - start).InMillisecondsF() *
+        1000);
+    if (result.IsEmpty()) {
+      Shell::ReportException(isolate, &try_catch);
+      base::OS::ExitProcess(1);
+    }
+  }
+  base::TimeDelta load_time = base::TimeTicks::HighResolutionNow() - load_start;
+  isolate->RemoveGCPrologueCallback(LoadGCPrologue, &gc_stats);
+  isolate->RemoveGCEpilogueCallback(LoadGCEpilogue, &gc_stats);
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  auto percentile = [&latencies_us](int p) {
+    size_t rank = (latencies_us.size() * p + 99) / 100;
+    return latencies_us[rank == 0 ? 0 : rank - 1];
+  };
+  double seconds = load_time.InSecondsF();
+  double ops_per_sec = seconds > 0 ? iterations / seconds : 0;
+  // Emit all lines with a single call so that the output of isolates running
+  // in parallel does not interleave. The "<name>: <value>" format is what the
+  // default results_regexp of tools/run_perf.py expects, so the values carry
+  // no unit suffix; the unit is part of the metric name instead.
+  printf(
+      "Isolate%d-OpsPerSec: %.2f\n"
+      "Isolate%d-P50Us: %.2f\n"
+      "Isolate%d-P90Us: %.2f\n"
+      "Isolate%d-P99Us: %.2f\n"
+      "Isolate%d-GCTimeMs: %.2f\n"
+      "Isolate%d-GCCount: %d\n",
+      index, ops_per_sec, index, percentile(50), index, percentile(90), index,
+      percentile(99), index, gc_stats.gc_time.InMillisecondsF(), index,
+      gc_stats.gc_count);
+  fflush(stdout);
+}
+
 Local<String> SourceGroup::ReadFile(Isolate* isolate, const char* name) {
   return Shell::ReadFile(isolate, name);
 }
@@ -2520,6 +2610,7 @@ void SourceGroup::ExecuteInThread() {
           PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
           Execute(isolate);
           Shell::CompleteMessageLoop(isolate);
+          RunLoad(isolate);
         }
         DisposeModuleEmbedderData(context);
       }
@@ -2895,6 +2986,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-iterations=", 18) == 0) {
+      options.load_iterations = atoi(argv[i] + 18);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-function=", 16) == 0) {
+      options.load_function = argv[i] + 16;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -2959,6 +3056,7 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
       PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
       options.isolate_sources[0].Execute(isolate);
       CompleteMessageLoop(isolate);
+      options.isolate_sources[0].RunLoad(isolate);
     }
     if (!use_existing_context) {
       DisposeModuleEmbedderData(context);
@@ -96,6 +96,10 @@ class SourceGroup {
 
   void Execute(Isolate* isolate);
 
+  // Calls the global --load-function --load-iterations times and prints the
+  // throughput, latency percentiles and GC pause time of this isolate.
+  void RunLoad(Isolate* isolate);
+
   void StartExecuteInThread();
   void WaitForThread();
   void JoinThread();
@@ -386,6 +390,8 @@ class ShellOptions {
   bool enable_os_system = false;
   bool quiet_load = false;
   int thread_pool_size = 0;
+  int load_iterations = 0;
+  const char* load_function = "run";
   bool stress_delay_tasks = false;
   std::vector<const char*> arguments;
   bool include_arguments = true;
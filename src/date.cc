@@ -301,11 +301,40 @@ void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
 }
 
 
+int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
+#ifdef V8_INTL_SUPPORT
+  // Asking ICU for the offset is expensive, so UTC times in the range of the
+  // segment cache are served from there. Local times may fall into a gap or
+  // an overlap at a transition and always go to ICU.
+  if (FLAG_icu_timezone_data && is_utc && time_ms >= 0 &&
+      time_ms <= kMaxEpochTimeInMs) {
+    return SegmentOffsetInMs(static_cast<int>(time_ms / 1000));
+  }
+#endif
+  return GetLocalOffsetFromOS(time_ms, is_utc);
+}
+
 int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   int time_sec = (time_ms >= 0 && time_ms <= kMaxEpochTimeInMs)
       ? static_cast<int>(time_ms / 1000)
       : static_cast<int>(EquivalentTime(time_ms) / 1000);
+#ifdef V8_INTL_SUPPORT
+  // The segment cache holds local offsets instead in this mode.
+  if (FLAG_icu_timezone_data) return GetDaylightSavingsOffsetFromOS(time_sec);
+#endif
+  return SegmentOffsetInMs(time_sec);
+}
+
+int DateCache::GetSegmentOffsetFromOS(int time_sec) {
+#ifdef V8_INTL_SUPPORT
+  if (FLAG_icu_timezone_data) {
+    return GetLocalOffsetFromOS(static_cast<int64_t>(time_sec) * 1000, true);
+  }
+#endif
+  return GetDaylightSavingsOffsetFromOS(time_sec);
+}
 
+int DateCache::SegmentOffsetInMs(int time_sec) {
   // Invalidate cache if the usage counter is close to overflow.
   // Note that dst_usage_counter is incremented less than ten times
   // in this function.
@@ -333,7 +362,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
     // Cache miss.
     before_->start_sec = time_sec;
     before_->end_sec = time_sec;
-    before_->offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
+    before_->offset_ms = GetSegmentOffsetFromOS(time_sec);
     before_->last_used = ++dst_usage_counter_;
     return before_->offset_ms;
   }
@@ -347,7 +376,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   if (time_sec > before_->end_sec + kDefaultDSTDeltaInSec) {
     // If the before_ segment ends too early, then just
     // query for the offset of the time_sec
-    int offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
+    int offset_ms = GetSegmentOffsetFromOS(time_sec);
     ExtendTheAfterSegment(time_sec, offset_ms);
     // This swap helps the optimistic fast check in subsequent invocations.
     DST* temp = before_;
@@ -365,7 +394,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   // Note that start_sec of invalid segments is kMaxEpochTimeInSec.
   if (before_->end_sec + kDefaultDSTDeltaInSec <= after_->start_sec) {
     int new_after_start_sec = before_->end_sec + kDefaultDSTDeltaInSec;
-    int new_offset_ms = GetDaylightSavingsOffsetFromOS(new_after_start_sec);
+    int new_offset_ms = GetSegmentOffsetFromOS(new_after_start_sec);
     ExtendTheAfterSegment(new_after_start_sec, new_offset_ms);
   } else {
     DCHECK(!InvalidSegment(after_));
@@ -388,7 +417,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   for (int i = 4; i >= 0; --i) {
     int delta = after_->start_sec - before_->end_sec;
     int middle_sec = (i == 0) ? time_sec : before_->end_sec + delta / 2;
-    int offset_ms = GetDaylightSavingsOffsetFromOS(middle_sec);
+    int offset_ms = GetSegmentOffsetFromOS(middle_sec);
     if (before_->offset_ms == offset_ms) {
       before_->end_sec = middle_sec;
       if (time_sec <= before_->end_sec) {
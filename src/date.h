@@ -79,9 +79,7 @@ class DateCache {
   }
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
-  int LocalOffsetInMs(int64_t time, bool is_utc) {
-    return GetLocalOffsetFromOS(time, is_utc);
-  }
+  int LocalOffsetInMs(int64_t time, bool is_utc);
 
 
   const char* LocalTimezone(int64_t time_ms) {
@@ -196,6 +194,12 @@ class DateCache {
   // ECMA 262 - 15.9.1.8
   int DaylightSavingsOffsetInMs(int64_t time_ms);
 
+  // Looks up the offset for the given time in the segment cache. The cache
+  // holds daylight savings offsets, or complete local offsets when ICU
+  // timezone data is used. See GetSegmentOffsetFromOS.
+  int SegmentOffsetInMs(int time_sec);
+  int GetSegmentOffsetFromOS(int time_sec);
+
   // Sets the before_ and the after_ segments from the DST cache such that
   // the before_ segment starts earlier than the given time and
   // the after_ segment start later than the given time.
@@ -9,6 +9,7 @@
 #include "src/frames.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/heap/incremental-marking.h"
 #include "src/isolate-inl.h"
 #include "src/keys.h"
 #include "src/message-template.h"
@@ -855,6 +856,38 @@ class ElementsAccessorBase : public InternalElementsAccessor {
     return new_elements;
   }
 
+  // A Smi and a double take the same space on 64-bit hosts, so a Smi
+  // backing store can be rewritten into a FixedDoubleArray of the same
+  // capacity instead of copying it. This is not done while marking, since
+  // the concurrent marker may be scanning the backing store. Handles to the
+  // old store stay valid as FixedArrayBase, so callers must not keep a
+  // Handle<FixedArray> to it across a transition to double elements.
+  static bool TryConvertSmiToDoubleElementsInPlace(
+      Isolate* isolate, Handle<FixedArrayBase> elements) {
+    STATIC_ASSERT(FixedArray::kHeaderSize == FixedDoubleArray::kHeaderSize);
+    if (kDoubleSize != kPointerSize) return false;
+    ReadOnlyRoots roots(isolate);
+    if (elements->map() != roots.fixed_array_map()) return false;
+    Heap* heap = isolate->heap();
+    if (heap->incremental_marking()->IsMarking()) return false;
+
+    DisallowHeapAllocation no_gc;
+    FixedArray smis = FixedArray::cast(*elements);
+    heap->NotifyObjectLayoutChange(smis, smis->Size(), no_gc);
+    Address the_hole = roots.the_hole_value()->ptr();
+    for (int i = 0; i < smis->length(); i++) {
+      Address address = smis->address() + FixedArray::OffsetOfElementAt(i);
+      Address value = Memory<Address>(address);
+      if (value == the_hole) {
+        Memory<uint64_t>(address) = kHoleNanInt64;
+      } else {
+        Memory<double>(address) = Smi::ToInt(reinterpret_cast<Object*>(value));
+      }
+    }
+    smis->set_map(roots.fixed_double_array_map());
+    return true;
+  }
+
   static void TransitionElementsKindImpl(Handle<JSObject> object,
                                          Handle<Map> to_map) {
     Handle<Map> from_map = handle(object->map(), object->GetIsolate());
@@ -881,10 +914,17 @@ class ElementsAccessorBase : public InternalElementsAccessor {
         DCHECK(
             (IsSmiElementsKind(from_kind) && IsDoubleElementsKind(to_kind)) ||
             (IsDoubleElementsKind(from_kind) && IsObjectElementsKind(to_kind)));
-        uint32_t capacity = static_cast<uint32_t>(object->elements()->length());
-        Handle<FixedArrayBase> elements = ConvertElementsWithCapacity(
-            object, from_elements, from_kind, capacity);
-        JSObject::SetMapAndElements(object, to_map, elements);
+        if (IsSmiElementsKind(from_kind) &&
+            TryConvertSmiToDoubleElementsInPlace(object->GetIsolate(),
+                                                 from_elements)) {
+          JSObject::MigrateToMap(object, to_map);
+        } else {
+          uint32_t capacity =
+              static_cast<uint32_t>(object->elements()->length());
+          Handle<FixedArrayBase> elements = ConvertElementsWithCapacity(
+              object, from_elements, from_kind, capacity);
+          JSObject::SetMapAndElements(object, to_map, elements);
+        }
       }
       if (FLAG_trace_elements_transitions) {
         JSObject::PrintElementsTransition(
@@ -545,7 +545,8 @@ Object* StackGuard::HandleInterrupts() {
       any_interrupt_handled = true;
     }
     DCHECK(isolate_->concurrent_recompilation_enabled());
-    isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
+    isolate_->optimizing_compile_dispatcher()
+        ->InstallOptimizedFunctionsOnInterrupt();
   }
 
   if (CheckAndClearInterrupt(API_INTERRUPT)) {
@@ -207,6 +207,10 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
       "Load StubCache::secondary_->value", index);
   Add(load_stub_cache->map_reference(StubCache::kSecondary).address(),
       "Load StubCache::secondary_->map", index);
+  Add(load_stub_cache->mask_reference(StubCache::kPrimary).address(),
+      "Load StubCache::primary_mask_", index);
+  Add(load_stub_cache->mask_reference(StubCache::kSecondary).address(),
+      "Load StubCache::secondary_mask_", index);
 
   StubCache* store_stub_cache = isolate->store_stub_cache();
 
@@ -223,6 +227,10 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
       "Store StubCache::secondary_->value", index);
   Add(store_stub_cache->map_reference(StubCache::kSecondary).address(),
       "Store StubCache::secondary_->map", index);
+  Add(store_stub_cache->mask_reference(StubCache::kPrimary).address(),
+      "Store StubCache::primary_mask_", index);
+  Add(store_stub_cache->mask_reference(StubCache::kSecondary).address(),
+      "Store StubCache::secondary_mask_", index);
 
   CHECK_EQ(kSpecialReferenceCount + kExternalReferenceCount +
                kBuiltinsReferenceCount + kRuntimeReferenceCount +
@@ -36,7 +36,7 @@ class ExternalReferenceTable {
   static constexpr int kAccessorReferenceCount =
       Accessors::kAccessorInfoCount + Accessors::kAccessorSetterCount;
   // The number of stub cache external references, see AddStubCache.
-  static constexpr int kStubCacheReferenceCount = 12;
+  static constexpr int kStubCacheReferenceCount = 16;
   static constexpr int kSize =
       kSpecialReferenceCount + kExternalReferenceCount +
       kBuiltinsReferenceCount + kRuntimeReferenceCount +
@@ -173,6 +173,8 @@ class StatsCounter;
   V(wasm_int64_mod, "wasm::int64_mod")                                        \
   V(wasm_int64_to_float32, "wasm::int64_to_float32_wrapper")                  \
   V(wasm_int64_to_float64, "wasm::int64_to_float64_wrapper")                  \
+  V(wasm_memory_copy, "wasm::memory_copy")                                    \
+  V(wasm_memory_fill, "wasm::memory_fill")                                    \
   V(wasm_uint64_div, "wasm::uint64_div")                                      \
   V(wasm_uint64_mod, "wasm::uint64_mod")                                      \
   V(wasm_uint64_to_float32, "wasm::uint64_to_float32_wrapper")                \
@@ -289,6 +289,9 @@ DEFINE_IMPLICATION(future, write_protect_code_memory)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_site_pretenuring_revisit, false,
+            "let allocation sites decided as not tenured be pretenured when "
+            "their survival rate rises")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -345,6 +348,8 @@ DEFINE_BOOL(ignition_filter_expression_positions, true,
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_reuse_block_slots, false,
+            "let stack locals of sibling block scopes share frame slots")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_STRING(print_bytecode_filter, "*",
@@ -380,6 +385,15 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(code_cache_tier_up_hints, true,
+            "optimize functions deserialized from the code cache early if "
+            "they were optimized when the cache was created")
+DEFINE_BOOL(prioritize_concurrent_recompilation, true,
+            "serve the concurrent compilation queue by function hotness and "
+            "cancel cold queued jobs when it is full")
+DEFINE_INT(concurrent_recompilation_install_batch, 4,
+           "maximum number of finished jobs installed per interrupt "
+           "(0 means all)")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -462,6 +476,9 @@ DEFINE_FLOAT(reserve_inline_budget_scale_factor, 1.2,
 DEFINE_INT(max_inlined_bytecode_size_small, 30,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
+DEFINE_FLOAT(hot_inlining_frequency, 10,
+             "minimum frequency for inlining within the absolute instead of "
+             "the cumulative bytecode budget")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
@@ -479,6 +496,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(osr_arm_all_levels, true,
+            "arm all loop nesting levels for OSR once the function has "
+            "optimized code")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -492,10 +512,17 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_peel_outer_loops, false,
+            "Turbofan peels loops enclosing innermost loops as well")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
+DEFINE_BOOL(turbo_move_cold_exits, true,
+            "Turbofan lays out deoptimizing and throwing blocks out of line")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_INT(turbo_compile_budget_node_count, 0,
+           "skip loop peeling, load elimination, escape analysis and live "
+           "range splintering for graphs with more nodes (0 means no limit)")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
@@ -524,8 +551,17 @@ DEFINE_BOOL(assume_asmjs_origin, false,
             "force wasm decoder to assume input is internal asm-wasm format")
 DEFINE_BOOL(wasm_disable_structured_cloning, false,
             "disable wasm structured cloning")
+DEFINE_BOOL(wasm_parallel_validation, false,
+            "validate wasm function bodies on worker threads when decoding "
+            "a module without compiling it")
 DEFINE_INT(wasm_num_compilation_tasks, 10,
            "number of parallel compilation tasks for wasm")
+DEFINE_INT(wasm_compilation_task_units, 0,
+           "number of compilation units a wasm background compile task "
+           "compiles before yielding its worker thread (0 for no limit)")
+DEFINE_BOOL(wasm_low_priority_tier_up, false,
+            "post wasm background compile tasks at low priority once only "
+            "tier-up units are left")
 DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
                   "trace wasm native heap events")
 DEFINE_BOOL(wasm_write_protect_code_memory, false,
@@ -568,6 +604,8 @@ DEFINE_BOOL(liftoff, false,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_DEBUG_BOOL(trace_liftoff, false,
                   "trace Liftoff, the baseline compiler for WebAssembly")
+DEFINE_BOOL(liftoff_loop_register_locals, false,
+            "keep locals in registers across Liftoff loop headers")
 DEFINE_DEBUG_BOOL(wasm_break_on_decoder_error, false,
                   "debug break when wasm decoder encounters an error")
 DEFINE_BOOL(trace_wasm_memory, false,
@@ -617,9 +655,15 @@ DEFINE_IMPLICATION(future, wasm_shared_engine)
 DEFINE_BOOL(wasm_shared_code, true,
             "shares code underlying a wasm module when it is transferred")
 DEFINE_IMPLICATION(future, wasm_shared_code)
+DEFINE_BOOL(wasm_native_module_cache, false,
+            "share the native module of identical wasm modules compiled "
+            "synchronously within the same engine")
 DEFINE_BOOL(wasm_trap_handler, true,
             "use signal handlers to catch out of bounds memory access in wasm"
             " (currently Linux x86_64 only)")
+DEFINE_INT(wasm_memory_reservation_pool_size, 0,
+           "number of released wasm memory reservations with full guard "
+           "regions kept for reuse by later memories")
 DEFINE_BOOL(wasm_trap_handler_fallback, false,
             "Use bounds checks if guarded memory is not available")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
@@ -643,6 +687,9 @@ DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
 DEFINE_INT(type_info_threshold, 25,
            "percentage of ICs that must have type info to allow optimization")
+DEFINE_BOOL(delay_opt_for_type_info, false,
+            "hold back hot functions while fewer than --type-info-threshold "
+            "percent of their ICs have type info")
 
 DEFINE_INT(stress_sampling_allocation_profiler, 0,
            "Enables sampling allocation profiler with X as a sample interval")
@@ -694,9 +741,19 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
+DEFINE_BOOL(concurrent_embedder_registration, true,
+            "let concurrent marking tasks register wrappers with embedders "
+            "that support it")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_SIZE_T(large_page_pool_size, 8,
+              "maximum size of freed large object pages that are kept "
+              "committed for reuse (in Mbytes)")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(early_parallel_scavenge, false,
+            "start background scavenging tasks before the main thread "
+            "scavenges the roots")
+DEFINE_NEG_NEG_IMPLICATION(parallel_scavenge, early_parallel_scavenge)
 #if defined(V8_TARGET_ARCH_ARM)
 #define V8_WRITE_PROTECT_CODE_MEMORY_BOOL false
 #else
@@ -721,6 +778,9 @@ DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_INT(compaction_time_budget_ms, 0,
+           "bound the bytes evacuated in a single full GC by the traced "
+           "compaction speed times this budget (0 means fixed quota)")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -733,7 +793,16 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(gc_object_stats_sampling_interval, 0,
+           "estimate object counts and memory usage from a sample of pages "
+           "on every n-th mark-compact (0 disables sampling)")
+DEFINE_INT(gc_object_stats_sampling_percent, 10,
+           "percentage of old generation pages visited when sampling object "
+           "statistics")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
+DEFINE_SIZE_T(zone_large_segment_pool_size, 0,
+              "maximum memory kept in freed zone segments of the maximum "
+              "segment size (0 disables the pool)")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
@@ -757,10 +826,25 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
             "disable remembered set verification")
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
+DEFINE_BOOL(flush_bytecode_on_memory_pressure, false,
+            "reset functions with old bytecode to lazy compilation on "
+            "critical memory pressure")
+DEFINE_BOOL(string_deduplication, false,
+            "deduplicate short sequential strings when collecting all "
+            "available garbage")
+DEFINE_INT(string_deduplication_max_length, 64,
+           "maximum length of strings considered for deduplication")
+DEFINE_INT(string_deduplication_budget, 100000,
+           "maximum number of strings deduplicated in one pass")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_INT(memory_reducer_stagger_ms, 0,
+           "minimum time between memory reducing GCs of different isolates "
+           "in the process (0 disables coordination)")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages_for_code_range, false,
+            "ask the OS to back the code range with huge pages")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
@@ -875,6 +959,9 @@ DEFINE_BOOL(expose_async_hooks, false, "expose async_hooks object")
 DEFINE_BOOL(allow_unsafe_function_constructor, false,
             "allow invoking the function constructor without security checks")
 DEFINE_BOOL(force_slow_path, false, "always take the slow path for builtins")
+DEFINE_INT(typed_array_parallel_sort_threshold, 0,
+           "sort typed arrays of at least this length on worker threads "
+           "(0 disables parallel sorting)")
 
 // builtins-ia32.cc
 DEFINE_BOOL(inline_new, true, "use fast inline allocation")
@@ -911,12 +998,19 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_BOOL(parallel_compile_lazy_declarations, false,
+            "also compile lazy top-level function declarations in parallel "
+            "compile tasks ahead of their first call")
+DEFINE_IMPLICATION(parallel_compile_lazy_declarations, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_INT(cpu_profiler_max_samples, 0,
+           "maximum number of samples recorded per CPU profile, after which "
+           "only the aggregated call tree is updated (0 means no limit)")
 
 // Array abuse tracing
 DEFINE_BOOL(trace_js_array_abuse, false,
@@ -1086,6 +1180,8 @@ DEFINE_BOOL_READONLY(jitless, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
+DEFINE_INT(regexp_cache_generations, 2,
+           "number of mark-compact GCs a cached regexp survives unused")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1101,6 +1197,9 @@ DEFINE_STRING(embedded_src, nullptr,
 DEFINE_STRING(
     embedded_variant, nullptr,
     "Label to disambiguate symbols in embedded data file. (mksnapshot only)")
+DEFINE_STRING(embedded_builtins_order, nullptr,
+              "Path to a file listing builtin names, one per line, to lay out "
+              "first in the embedded blob. (mksnapshot only)")
 DEFINE_STRING(startup_src, nullptr,
               "Write V8 startup as C++ src. (mksnapshot only)")
 DEFINE_STRING(startup_blob, nullptr,
@@ -1151,6 +1250,12 @@ DEFINE_BOOL(opt, !V8_LITE_BOOL, "use adaptive optimizations")
 
 // Enable use of inline caches to optimize object access operations.
 DEFINE_BOOL(use_ic, !V8_LITE_BOOL, "use inline caching")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary megamorphic stub "
+           "cache tables")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary megamorphic stub "
+           "cache tables")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, V8_LITE_BOOL,
@@ -1288,6 +1393,9 @@ DEFINE_BOOL(prof_cpp, false, "Like --prof, but ignore generated code.")
 DEFINE_IMPLICATION(prof, prof_cpp)
 DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
+DEFINE_BOOL(prof_bytecode_handlers, false,
+            "print the number of CPU profiler samples in each bytecode "
+            "handler when profiling stops")
 DEFINE_STRING(logfile, "v8.log", "Specify the name of the log file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
 DEFINE_BOOL(ll_prof, false, "Enable low-level linux profiler.")
@@ -1302,7 +1410,6 @@ DEFINE_BOOL(perf_basic_prof_only_functions, false,
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 DEFINE_NEG_IMPLICATION(perf_prof, wasm_write_protect_code_memory)
@@ -4,6 +4,7 @@
 
 #include "src/futex-emulation.h"
 
+#include <atomic>
 #include <limits>
 
 #include "src/base/macros.h"
@@ -22,6 +23,7 @@ using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
     LAZY_INSTANCE_INITIALIZER;
+std::atomic<int> FutexEmulation::num_waiters_{0};
 
 
 void FutexWaitListNode::NotifyWake() {
@@ -166,6 +168,10 @@ Object* FutexEmulation::Wait(Isolate* isolate,
     // still holding the lock).
     ResetWaitingOnScopeExit reset_waiting(node);
 
+    // Announce the waiter before reading the value, see `num_waiters_`.
+    num_waiters_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
     T* p = reinterpret_cast<T*>(static_cast<int8_t*>(backing_store) + addr);
     if (*p != value) {
       result = Smi::FromInt(WaitReturnValue::kNotEqual);
@@ -253,6 +259,7 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
     wait_list_.Pointer()->RemoveNode(node);
   } while (false);
+  num_waiters_.fetch_sub(1);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
                                   rel_timeout_ms, nullptr);
@@ -269,6 +276,12 @@ Object* FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
                              uint32_t num_waiters_to_wake) {
   DCHECK_LT(addr, array_buffer->byte_length());
 
+  // Nobody is waiting, or about to wait on a value it has not read yet. The
+  // fence pairs with the one in Wait: it orders the caller's preceding plain
+  // store to the waited-on cell before the load of `num_waiters_`.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (num_waiters_.load() == 0) return Smi::FromInt(0);
+
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
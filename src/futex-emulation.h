@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "src/allocation.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
@@ -158,6 +160,12 @@ class FutexEmulation : public AllStatic {
   // condition variable of such nodes.
   static base::LazyMutex mutex_;
   static base::LazyInstance<FutexWaitList>::type wait_list_;
+
+  // Upper bound of the number of threads in `wait_list_`. Waiters increment
+  // it before checking the value they wait on, so that `Wake` can return
+  // without taking `mutex_` when it is zero: any waiter it misses has not
+  // read the value yet and sees the store that preceded the wake.
+  static std::atomic<int> num_waiters_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -836,7 +836,14 @@ void GlobalHandles::UpdateListOfNewSpaceNodes() {
   }
   DCHECK_LE(last, new_space_nodes_.size());
   new_space_nodes_.resize(last);
-  new_space_nodes_.shrink_to_fit();
+  // Embedders that create many young handles per cycle would otherwise pay
+  // for reallocating and regrowing the list on every scavenge. Only give
+  // memory back when most of the capacity is unused.
+  static const size_t kMinCapacityToShrink = 1024;
+  if (new_space_nodes_.capacity() > kMinCapacityToShrink &&
+      new_space_nodes_.capacity() > 4 * last) {
+    new_space_nodes_.shrink_to_fit();
+  }
 }
 
 int GlobalHandles::InvokeFirstPassWeakCallbacks() {
@@ -60,19 +60,19 @@ template <typename Callback>
 void LocalArrayBufferTracker::Free(Callback should_free) {
   size_t freed_memory = 0;
   Isolate* isolate = page_->heap()->isolate();
-  for (TrackingData::iterator it = array_buffers_.begin();
-       it != array_buffers_.end();) {
-    JSArrayBuffer* buffer = reinterpret_cast<JSArrayBuffer*>(it->first);
-    const size_t length = it->second.length;
-
+  // Kept entries are moved to the front and the tail is dropped in one go.
+  size_t kept = 0;
+  for (size_t i = 0; i < array_buffers_.size(); i++) {
+    JSArrayBuffer* buffer = array_buffers_[i].first;
     if (should_free(buffer)) {
-      JSArrayBuffer::FreeBackingStore(isolate, it->second);
-      it = array_buffers_.erase(it);
-      freed_memory += length;
+      JSArrayBuffer::FreeBackingStore(isolate, array_buffers_[i].second);
+      freed_memory += array_buffers_[i].second.length;
     } else {
-      ++it;
+      if (kept != i) array_buffers_[kept] = array_buffers_[i];
+      kept++;
     }
   }
+  array_buffers_.erase(array_buffers_.begin() + kept, array_buffers_.end());
   if (freed_memory > 0) {
     page_->DecrementExternalBackingStoreBytes(
         ExternalBackingStoreType::kArrayBuffer, freed_memory);
@@ -105,21 +105,25 @@ void LocalArrayBufferTracker::Add(JSArrayBuffer* buffer, size_t length) {
 
 void LocalArrayBufferTracker::AddInternal(JSArrayBuffer* buffer,
                                           size_t length) {
-  auto ret = array_buffers_.insert(
-      {buffer,
-       {buffer->backing_store(), length, buffer->backing_store(),
-        buffer->is_wasm_memory()}});
-  USE(ret);
-  // Check that we indeed inserted a new value and did not overwrite an existing
-  // one (which would be a bug).
-  DCHECK(ret.second);
+  // Check that we do not track the same buffer twice (which would be a bug).
+  SLOW_DCHECK(!IsTracked(buffer));
+  auto it = array_buffers_.end();
+  if (!array_buffers_.empty() && buffer < array_buffers_.back().first) {
+    it = std::lower_bound(array_buffers_.begin(), array_buffers_.end(), buffer,
+                          EntryLess);
+  }
+  array_buffers_.emplace(
+      it, buffer,
+      JSArrayBuffer::Allocation(buffer->backing_store(), length,
+                                buffer->backing_store(),
+                                buffer->is_wasm_memory()));
 }
 
 void LocalArrayBufferTracker::Remove(JSArrayBuffer* buffer, size_t length) {
   page_->DecrementExternalBackingStoreBytes(
       ExternalBackingStoreType::kArrayBuffer, length);
 
-  TrackingData::iterator it = array_buffers_.find(buffer);
+  TrackingData::const_iterator it = Find(buffer);
   // Check that we indeed find a key to remove.
   DCHECK(it != array_buffers_.end());
   DCHECK_EQ(length, it->second.length);
@@ -21,21 +21,32 @@ LocalArrayBufferTracker::~LocalArrayBufferTracker() {
 template <typename Callback>
 void LocalArrayBufferTracker::Process(Callback callback) {
   std::vector<JSArrayBuffer::Allocation> backing_stores_to_free;
-  TrackingData kept_array_buffers;
 
   JSArrayBuffer* new_buffer = nullptr;
   JSArrayBuffer* old_buffer = nullptr;
   size_t freed_memory = 0;
-  for (TrackingData::iterator it = array_buffers_.begin();
-       it != array_buffers_.end(); ++it) {
-    old_buffer = it->first;
+  // Kept entries are compacted to the front of array_buffers_ in place.
+  size_t kept = 0;
+  // Buffers moved within the page may break the address order.
+  bool needs_sorting = false;
+  for (size_t i = 0; i < array_buffers_.size(); i++) {
+    old_buffer = array_buffers_[i].first;
+    const JSArrayBuffer::Allocation& allocation = array_buffers_[i].second;
     DCHECK_EQ(page_, Page::FromAddress(old_buffer->address()));
     const CallbackResult result = callback(old_buffer, &new_buffer);
     if (result == kKeepEntry) {
-      kept_array_buffers.insert(*it);
+      if (kept != i) array_buffers_[kept] = array_buffers_[i];
+      kept++;
     } else if (result == kUpdateEntry) {
       DCHECK_NOT_NULL(new_buffer);
       Page* target_page = Page::FromAddress(new_buffer->address());
+      DCHECK_EQ(old_buffer->is_wasm_memory(), allocation.is_wasm_memory);
+      if (target_page == page_) {
+        needs_sorting = true;
+        array_buffers_[kept] = {new_buffer, allocation};
+        kept++;
+        continue;
+      }
       {
         base::MutexGuard guard(target_page->mutex());
         LocalArrayBufferTracker* tracker = target_page->local_tracker();
@@ -44,10 +55,9 @@ void LocalArrayBufferTracker::Process(Callback callback) {
           tracker = target_page->local_tracker();
         }
         DCHECK_NOT_NULL(tracker);
-        const size_t length = it->second.length;
+        const size_t length = allocation.length;
         // We should decrement before adding to avoid potential overflows in
         // the external memory counters.
-        DCHECK_EQ(it->first->is_wasm_memory(), it->second.is_wasm_memory);
         tracker->AddInternal(new_buffer, length);
         MemoryChunk::MoveExternalBackingStoreBytes(
             ExternalBackingStoreType::kArrayBuffer,
@@ -55,11 +65,11 @@ void LocalArrayBufferTracker::Process(Callback callback) {
             static_cast<MemoryChunk*>(target_page), length);
       }
     } else if (result == kRemoveEntry) {
-      freed_memory += it->second.length;
+      freed_memory += allocation.length;
       // We pass backing_store() and stored length to the collector for freeing
       // the backing store. Wasm allocations will go through their own tracker
       // based on the backing store.
-      backing_stores_to_free.push_back(it->second);
+      backing_stores_to_free.push_back(allocation);
     } else {
       UNREACHABLE();
     }
@@ -72,7 +82,14 @@ void LocalArrayBufferTracker::Process(Callback callback) {
         static_cast<intptr_t>(freed_memory));
   }
 
-  array_buffers_.swap(kept_array_buffers);
+  array_buffers_.erase(array_buffers_.begin() + kept, array_buffers_.end());
+  if (needs_sorting) {
+    std::sort(array_buffers_.begin(), array_buffers_.end(),
+              [](const TrackingData::value_type& a,
+                 const TrackingData::value_type& b) {
+                return a.first < b.first;
+              });
+  }
 
   // Pass the backing stores that need to be freed to the main thread for
   // potential later distribution.
@@ -5,7 +5,9 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_TRACKER_H_
 #define V8_HEAP_ARRAY_BUFFER_TRACKER_H_
 
-#include <unordered_map>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/platform/mutex.h"
@@ -94,25 +96,37 @@ class LocalArrayBufferTracker {
   bool IsEmpty() const { return array_buffers_.empty(); }
 
   bool IsTracked(JSArrayBuffer* buffer) const {
-    return array_buffers_.find(buffer) != array_buffers_.end();
+    return Find(buffer) != array_buffers_.end();
   }
 
  private:
-  class Hasher {
-   public:
-    size_t operator()(JSArrayBuffer* buffer) const {
-      return reinterpret_cast<size_t>(buffer) >> 3;
-    }
-  };
-
   // Keep track of the backing store and the corresponding length at time of
   // registering. The length is accessed from JavaScript and can be a
   // HeapNumber. The reason for tracking the length is that in the case of
   // length being a HeapNumber, the buffer and its length may be stored on
   // different memory pages, making it impossible to guarantee order of freeing.
-  typedef std::unordered_map<JSArrayBuffer*, JSArrayBuffer::Allocation, Hasher>
+  // The entries are kept in a vector sorted by buffer address. Processing and
+  // freeing walk it linearly and compact it in place, which keeps the order
+  // and is much cheaper than maintaining a hash map when most buffers die
+  // young. Buffers are mostly allocated at increasing addresses, so adding
+  // one usually appends. Lookups for unregistering a buffer use binary
+  // search.
+  typedef std::vector<std::pair<JSArrayBuffer*, JSArrayBuffer::Allocation>>
       TrackingData;
 
+  static bool EntryLess(const TrackingData::value_type& entry,
+                        JSArrayBuffer* buffer) {
+    return entry.first < buffer;
+  }
+
+  TrackingData::const_iterator Find(JSArrayBuffer* buffer) const {
+    auto it = std::lower_bound(array_buffers_.begin(), array_buffers_.end(),
+                               buffer, EntryLess);
+    return it != array_buffers_.end() && it->first == buffer
+               ? it
+               : array_buffers_.end();
+  }
+
   // Internal version of add that does not update counters. Requires separate
   // logic for updating external memory counters.
   inline void AddInternal(JSArrayBuffer* buffer, size_t length);
@@ -34,6 +34,10 @@ namespace internal {
 // Note: If Start() is not called in time, e.g., because the first concurrent
 // task is already done processing all work, then Done() will return true
 // immediately.
+//
+// A task that is still busy producing work when the others start can be
+// registered upfront with StartPending(). Until it calls Join(), waiting tasks
+// do not time out, as the pending task may still produce work for them.
 class OneshotBarrier {
  public:
   explicit OneshotBarrier(base::TimeDelta timeout) : timeout_(timeout) {}
@@ -43,6 +47,19 @@ class OneshotBarrier {
     tasks_++;
   }
 
+  void StartPending() {
+    base::MutexGuard guard(&mutex_);
+    tasks_++;
+    pending_++;
+  }
+
+  void Join() {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_LT(0, pending_);
+    pending_--;
+    if (waiting_ > 0) condition_.NotifyAll();
+  }
+
   void NotifyAll() {
     base::MutexGuard guard(&mutex_);
     if (waiting_ > 0) condition_.NotifyAll();
@@ -57,6 +74,9 @@ class OneshotBarrier {
     if (waiting_ == tasks_) {
       done_ = true;
       condition_.NotifyAll();
+    } else if (pending_ > 0) {
+      // Spurious wakeup is ok here.
+      condition_.Wait(&mutex_);
     } else {
       // Spurious wakeup is ok here.
       if (!condition_.WaitFor(&mutex_, timeout_)) {
@@ -77,6 +97,7 @@ class OneshotBarrier {
   base::Mutex mutex_;
   base::TimeDelta timeout_;
   int tasks_ = 0;
+  int pending_ = 0;
   int waiting_ = 0;
   bool done_ = false;
 };
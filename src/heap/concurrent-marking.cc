@@ -4,11 +4,14 @@
 
 #include "src/heap/concurrent-marking.h"
 
+#include <memory>
 #include <stack>
 #include <unordered_map>
 
 #include "include/v8config.h"
+#include "src/base/platform/platform.h"
 #include "src/base/template-utils.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
@@ -81,7 +84,8 @@ class ConcurrentMarkingVisitor final
       ConcurrentMarking::MarkingWorklist* bailout,
       MemoryChunkDataMap* memory_chunk_data, WeakObjects* weak_objects,
       ConcurrentMarking::EmbedderTracingWorklist* embedder_objects, int task_id,
-      bool embedder_tracing_enabled)
+      bool embedder_tracing_enabled,
+      LocalEmbedderHeapTracer::ProcessingScope* embedder_registration)
       : shared_(shared, task_id),
         bailout_(bailout, task_id),
         weak_objects_(weak_objects),
@@ -89,7 +93,8 @@ class ConcurrentMarkingVisitor final
         marking_state_(memory_chunk_data),
         memory_chunk_data_(memory_chunk_data),
         task_id_(task_id),
-        embedder_tracing_enabled_(embedder_tracing_enabled) {}
+        embedder_tracing_enabled_(embedder_tracing_enabled),
+        embedder_registration_(embedder_registration) {}
 
   template <typename T, typename = typename std::enable_if<
                             std::is_base_of<Object, T>::value>::type>
@@ -464,9 +469,15 @@ class ConcurrentMarkingVisitor final
     DCHECK(object->IsApiWrapper());
     int size = VisitJSObjectSubclass(map, object);
     if (size && embedder_tracing_enabled_) {
-      // Success: The object needs to be processed for embedder references on
-      // the main thread.
-      embedder_objects_.Push(object);
+      if (embedder_registration_) {
+        // The embedder accepts references from marking threads, so the
+        // wrapper is registered right away.
+        embedder_registration_->TracePossibleWrapper(map, object);
+      } else {
+        // Success: The object needs to be processed for embedder references
+        // on the main thread.
+        embedder_objects_.Push(object);
+      }
     }
     return size;
   }
@@ -525,6 +536,7 @@ class ConcurrentMarkingVisitor final
   int task_id_;
   SlotSnapshot slot_snapshot_;
   bool embedder_tracing_enabled_;
+  LocalEmbedderHeapTracer::ProcessingScope* const embedder_registration_;
 };
 
 // Strings can change maps due to conversion to thin string or external strings.
@@ -605,9 +617,17 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
                       GCTracer::BackgroundScope::MC_BACKGROUND_MARKING);
   size_t kBytesUntilInterruptCheck = 64 * KB;
   int kObjectsUntilInterrupCheck = 1000;
+  LocalEmbedderHeapTracer* local_tracer = heap_->local_embedder_heap_tracer();
+  std::unique_ptr<LocalEmbedderHeapTracer::ProcessingScope>
+      embedder_registration;
+  if (local_tracer->SupportsConcurrentRegistration()) {
+    embedder_registration.reset(
+        new LocalEmbedderHeapTracer::ProcessingScope(local_tracer));
+  }
   ConcurrentMarkingVisitor visitor(
       shared_, bailout_, &task_state->memory_chunk_data, weak_objects_,
-      embedder_objects_, task_id, heap_->local_embedder_heap_tracer()->InUse());
+      embedder_objects_, task_id, local_tracer->InUse(),
+      embedder_registration.get());
   double time_ms;
   size_t marked_bytes = 0;
   if (FLAG_trace_concurrent_marking) {
@@ -618,6 +638,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
 
   {
     TimedScope scope(&time_ms);
+    active_task_count_++;
 
     {
       Ephemeron ephemeron;
@@ -636,7 +657,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
       while (current_marked_bytes < kBytesUntilInterruptCheck &&
              objects_processed < kObjectsUntilInterrupCheck) {
         HeapObject* object;
-        if (!shared_->Pop(task_id, &object)) {
+        if (!PopOrSteal(task_id, task_state, &object)) {
           done = true;
           break;
         }
@@ -672,6 +693,10 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
       }
     }
 
+    // Hand the remaining wrappers to the embedder before the task is reported
+    // as finished, so that the atomic pause observes all registrations.
+    embedder_registration.reset();
+    active_task_count_--;
     shared_->FlushToGlobal(task_id);
     bailout_->FlushToGlobal(task_id);
     on_hold_->FlushToGlobal(task_id);
@@ -706,6 +731,20 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
   }
 }
 
+bool ConcurrentMarking::PopOrSteal(int task_id, TaskState* task_state,
+                                   HeapObject** object) {
+  if (shared_->Pop(task_id, object)) return true;
+  for (int attempt = 0; attempt < kMaxStealAttempts; attempt++) {
+    // Only this task is left, so nobody can share work with it.
+    if (active_task_count_.load(std::memory_order_relaxed) <= 1) break;
+    if (task_state->preemption_request) break;
+    shared_->RequestWork();
+    base::OS::Sleep(base::TimeDelta::FromMicroseconds(10));
+    if (shared_->Pop(task_id, object)) return true;
+  }
+  return false;
+}
+
 void ConcurrentMarking::ScheduleTasks() {
   DCHECK(FLAG_parallel_marking || FLAG_concurrent_marking);
   DCHECK(!heap_->IsTearingDown());
@@ -59,10 +59,11 @@ class ConcurrentMarking {
     COMPLETE_TASKS_FOR_TESTING,
   };
 
-  // TODO(gab): The only thing that prevents this being above 7 is
-  // Worklist::kMaxNumTasks being maxed at 8 (concurrent marking doesn't use
+  // Bounded by Worklist::kMaxNumTasks (concurrent marking doesn't use
   // task 0, reserved for the main thread).
-  static constexpr int kMaxTasks = 7;
+  static constexpr int kMaxTasks = 15;
+  // Number of times an idle task asks busy tasks for work before it gives up.
+  static constexpr int kMaxStealAttempts = 10;
   using MarkingWorklist = Worklist<HeapObject*, 64 /* segment size */>;
   using EmbedderTracingWorklist = Worklist<HeapObject*, 16 /* segment size */>;
 
@@ -110,6 +111,9 @@ class ConcurrentMarking {
   };
   class Task;
   void Run(int task_id, TaskState* task_state);
+  // Pops an object from the shared worklist. If the worklist is empty and
+  // other tasks are still marking, requests work from them and retries.
+  bool PopOrSteal(int task_id, TaskState* task_state, HeapObject** object);
   Heap* const heap_;
   MarkingWorklist* const shared_;
   MarkingWorklist* const bailout_;
@@ -118,6 +122,7 @@ class ConcurrentMarking {
   EmbedderTracingWorklist* const embedder_objects_;
   TaskState task_state_[kMaxTasks + 1];
   std::atomic<size_t> total_marked_bytes_{0};
+  std::atomic<int> active_task_count_{0};
   std::atomic<bool> ephemeron_marked_{false};
   base::Mutex pending_lock_;
   base::ConditionVariable pending_condition_;
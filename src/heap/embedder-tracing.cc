@@ -15,6 +15,7 @@ void LocalEmbedderHeapTracer::SetRemoteTracer(EmbedderHeapTracer* tracer) {
   if (remote_tracer_) remote_tracer_->isolate_ = nullptr;
 
   remote_tracer_ = tracer;
+  supports_concurrent_registration_ = false;
   if (remote_tracer_)
     remote_tracer_->isolate_ = reinterpret_cast<v8::Isolate*>(isolate_);
 }
@@ -24,6 +25,9 @@ void LocalEmbedderHeapTracer::TracePrologue() {
 
   num_v8_marking_worklist_was_empty_ = 0;
   embedder_worklist_empty_ = false;
+  supports_concurrent_registration_ =
+      FLAG_concurrent_embedder_registration &&
+      remote_tracer_->SupportsConcurrentRegistration();
   remote_tracer_->TracePrologue();
 }
 
@@ -74,7 +78,12 @@ LocalEmbedderHeapTracer::ProcessingScope::~ProcessingScope() {
 void LocalEmbedderHeapTracer::ProcessingScope::TracePossibleWrapper(
     JSObject* js_object) {
   DCHECK(js_object->IsApiWrapper());
-  if (js_object->GetEmbedderFieldCount() < 2) return;
+  TracePossibleWrapper(js_object->map(), js_object);
+}
+
+void LocalEmbedderHeapTracer::ProcessingScope::TracePossibleWrapper(
+    Map map, JSObject* js_object) {
+  if (JSObject::GetEmbedderFieldCount(map) < 2) return;
 
   void* pointer0;
   void* pointer1;
@@ -14,6 +14,7 @@ namespace internal {
 
 class Heap;
 class JSObject;
+class Map;
 
 class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
  public:
@@ -26,6 +27,9 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
     ~ProcessingScope();
 
     void TracePossibleWrapper(JSObject* js_object);
+    // Variant that can be used off the main thread as it takes the map the
+    // caller has already loaded.
+    void TracePossibleWrapper(Map map, JSObject* js_object);
 
     void AddWrapperInfoForTesting(WrapperInfo info);
 
@@ -47,6 +51,13 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   bool InUse() const { return remote_tracer_ != nullptr; }
   EmbedderHeapTracer* remote_tracer() const { return remote_tracer_; }
 
+  // Returns true if concurrent marking tasks may register wrappers with the
+  // remote tracer directly. Queried from the remote tracer in TracePrologue
+  // so that marking tasks do not need to call into the embedder for it.
+  bool SupportsConcurrentRegistration() const {
+    return supports_concurrent_registration_;
+  }
+
   void SetRemoteTracer(EmbedderHeapTracer* tracer);
   void TracePrologue();
   void TraceEpilogue();
@@ -77,6 +88,7 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   EmbedderHeapTracer* remote_tracer_ = nullptr;
 
   size_t num_v8_marking_worklist_was_empty_ = 0;
+  bool supports_concurrent_registration_ = false;
   EmbedderHeapTracer::EmbedderStackState embedder_stack_state_ =
       EmbedderHeapTracer::kUnknown;
   // Indicates whether the embedder worklist was observed empty on the main
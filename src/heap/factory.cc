@@ -3661,6 +3661,7 @@ Handle<SharedFunctionInfo> Factory::NewSharedFunctionInfo(
     share->set_raw_function_token_offset(0);
     // All flags default to false or 0.
     share->set_flags(0);
+    share->set_flags2(0);
     share->CalculateConstructAsBuiltin();
     share->set_kind(kind);
 
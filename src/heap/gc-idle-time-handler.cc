@@ -15,6 +15,7 @@ const double GCIdleTimeHandler::kConservativeTimeRatio = 0.9;
 const size_t GCIdleTimeHandler::kMaxFinalIncrementalMarkCompactTimeInMs = 1000;
 const double GCIdleTimeHandler::kHighContextDisposalRate = 100;
 const size_t GCIdleTimeHandler::kMinTimeForOverApproximatingWeakClosureInMs = 1;
+const double GCIdleTimeHandler::kHighNewSpaceUtilizationRatio = 0.5;
 
 
 void GCIdleTimeAction::Print() {
@@ -34,6 +35,12 @@ void GCIdleTimeAction::Print() {
     case DO_FULL_GC:
       PrintF("full GC");
       break;
+    case DO_SCAVENGE:
+      PrintF("scavenge");
+      break;
+    case DO_START_INCREMENTAL_MARKING:
+      PrintF("start incremental marking");
+      break;
   }
 }
 
@@ -43,6 +50,13 @@ void GCIdleTimeHeapState::Print() {
   PrintF("contexts_disposal_rate=%f ", contexts_disposal_rate);
   PrintF("size_of_objects=%" PRIuS " ", size_of_objects);
   PrintF("incremental_marking_stopped=%d ", incremental_marking_stopped);
+  PrintF("new_space_capacity=%" PRIuS " ", new_space_capacity);
+  PrintF("used_new_space_size=%" PRIuS " ", used_new_space_size);
+  PrintF("scavenge_speed=%f ", scavenge_speed_in_bytes_per_ms);
+  PrintF("final_incremental_mark_compact_speed=%f ",
+         final_incremental_mark_compact_speed_in_bytes_per_ms);
+  PrintF("incremental_marking_limit_reached=%d ",
+         incremental_marking_limit_reached);
 }
 
 size_t GCIdleTimeHandler::EstimateMarkingStepSize(
@@ -96,6 +110,27 @@ bool GCIdleTimeHandler::ShouldDoOverApproximateWeakClosure(
 }
 
 
+double GCIdleTimeHandler::EstimateScavengeTime(
+    size_t used_new_space_size, double scavenge_speed_in_bytes_per_ms) {
+  if (scavenge_speed_in_bytes_per_ms == 0) {
+    scavenge_speed_in_bytes_per_ms = kInitialConservativeScavengeSpeed;
+  }
+  return used_new_space_size / scavenge_speed_in_bytes_per_ms;
+}
+
+bool GCIdleTimeHandler::ShouldDoScavenge(
+    double idle_time_in_ms, size_t new_space_capacity,
+    size_t used_new_space_size, double scavenge_speed_in_bytes_per_ms) {
+  if (used_new_space_size <
+      new_space_capacity * kHighNewSpaceUtilizationRatio) {
+    return false;
+  }
+  return EstimateScavengeTime(used_new_space_size,
+                              scavenge_speed_in_bytes_per_ms) <=
+         idle_time_in_ms * kConservativeTimeRatio;
+}
+
+
 GCIdleTimeAction GCIdleTimeHandler::NothingOrDone(double idle_time_in_ms) {
   if (idle_time_in_ms >= kMinBackgroundIdleTime) {
     return GCIdleTimeAction::Nothing();
@@ -149,6 +184,41 @@ GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
   return GCIdleTimeAction::IncrementalStep();
 }
 
+// Between requests the controller tries to get work out of the way of the
+// next request:
+// (1) If the new space is filled well enough and a scavenge fits into the
+// idle time, a scavenge is performed.
+// (2) If incremental marking is in progress, we perform a marking step and
+// only finalize if the estimated finalization time fits.
+// (3) If the old generation is close to its limit and starting marking is
+// allowed, incremental marking is started.
+GCIdleTimeAction GCIdleTimeHandler::ComputeForIdlePeriod(
+    double idle_time_in_ms, GCIdleTimeHeapState heap_state,
+    bool may_start_marking) {
+  if (static_cast<int>(idle_time_in_ms) <= 0) {
+    return GCIdleTimeAction::Nothing();
+  }
+
+  if (ShouldDoScavenge(idle_time_in_ms, heap_state.new_space_capacity,
+                       heap_state.used_new_space_size,
+                       heap_state.scavenge_speed_in_bytes_per_ms)) {
+    return GCIdleTimeAction::Scavenge();
+  }
+
+  if (FLAG_incremental_marking && !heap_state.incremental_marking_stopped) {
+    GCIdleTimeAction action = GCIdleTimeAction::IncrementalStep();
+    action.strict_deadline = true;
+    return action;
+  }
+
+  if (FLAG_incremental_marking && may_start_marking &&
+      heap_state.incremental_marking_limit_reached) {
+    return GCIdleTimeAction::StartIncrementalMarking();
+  }
+
+  return GCIdleTimeAction::Done();
+}
+
 bool GCIdleTimeHandler::Enabled() { return FLAG_incremental_marking; }
 
 }  // namespace internal
@@ -15,6 +15,8 @@ enum GCIdleTimeActionType {
   DO_NOTHING,
   DO_INCREMENTAL_STEP,
   DO_FULL_GC,
+  DO_SCAVENGE,
+  DO_START_INCREMENTAL_MARKING,
 };
 
 
@@ -24,6 +26,7 @@ class GCIdleTimeAction {
     GCIdleTimeAction result;
     result.type = DONE;
     result.additional_work = false;
+    result.strict_deadline = false;
     return result;
   }
 
@@ -31,6 +34,7 @@ class GCIdleTimeAction {
     GCIdleTimeAction result;
     result.type = DO_NOTHING;
     result.additional_work = false;
+    result.strict_deadline = false;
     return result;
   }
 
@@ -38,6 +42,7 @@ class GCIdleTimeAction {
     GCIdleTimeAction result;
     result.type = DO_INCREMENTAL_STEP;
     result.additional_work = false;
+    result.strict_deadline = false;
     return result;
   }
 
@@ -45,6 +50,23 @@ class GCIdleTimeAction {
     GCIdleTimeAction result;
     result.type = DO_FULL_GC;
     result.additional_work = false;
+    result.strict_deadline = false;
+    return result;
+  }
+
+  static GCIdleTimeAction Scavenge() {
+    GCIdleTimeAction result;
+    result.type = DO_SCAVENGE;
+    result.additional_work = false;
+    result.strict_deadline = true;
+    return result;
+  }
+
+  static GCIdleTimeAction StartIncrementalMarking() {
+    GCIdleTimeAction result;
+    result.type = DO_START_INCREMENTAL_MARKING;
+    result.additional_work = false;
+    result.strict_deadline = true;
     return result;
   }
 
@@ -52,6 +74,9 @@ class GCIdleTimeAction {
 
   GCIdleTimeActionType type;
   bool additional_work;
+  // If set, work that is not estimated to fit into the remaining idle time,
+  // i.e., finalization of incremental marking, is not started.
+  bool strict_deadline;
 };
 
 
@@ -63,6 +88,12 @@ class GCIdleTimeHeapState {
   double contexts_disposal_rate;
   size_t size_of_objects;
   bool incremental_marking_stopped;
+  size_t new_space_capacity;
+  size_t used_new_space_size;
+  double scavenge_speed_in_bytes_per_ms;
+  double final_incremental_mark_compact_speed_in_bytes_per_ms;
+  // Only computed for idle periods between requests.
+  bool incremental_marking_limit_reached;
 };
 
 
@@ -115,6 +146,14 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
   // Incremental marking step time.
   static const size_t kIncrementalMarkingStepTimeInMs = 1;
 
+  // If we haven't recorded any scavenger events yet, we use a conservative
+  // lower bound for the scavenger speed.
+  static const size_t kInitialConservativeScavengeSpeed = 100 * KB;
+
+  // Idle periods between requests are used for a scavenge once the new space
+  // is filled at least up to this ratio.
+  static const double kHighNewSpaceUtilizationRatio;
+
   static const size_t kMinTimeForOverApproximatingWeakClosureInMs;
 
   // Number of times we will return a Nothing action in the current mode
@@ -127,6 +166,15 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
   GCIdleTimeAction Compute(double idle_time_in_ms,
                            GCIdleTimeHeapState heap_state);
 
+  // Decides on the work for an idle period between two requests of a server
+  // embedder. Unlike Compute() it may also schedule a scavenge and, if
+  // |may_start_marking| is set, the start of incremental marking so that this
+  // work does not happen during the next request. All returned actions have
+  // a strict deadline.
+  GCIdleTimeAction ComputeForIdlePeriod(double idle_time_in_ms,
+                                        GCIdleTimeHeapState heap_state,
+                                        bool may_start_marking);
+
   bool Enabled();
 
   void ResetNoProgressCounter() { idle_times_which_made_no_progress_ = 0; }
@@ -147,6 +195,14 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
 
   static bool ShouldDoOverApproximateWeakClosure(double idle_time_in_ms);
 
+  static double EstimateScavengeTime(size_t used_new_space_size,
+                                     double scavenge_speed_in_bytes_per_ms);
+
+  static bool ShouldDoScavenge(double idle_time_in_ms,
+                               size_t new_space_capacity,
+                               size_t used_new_space_size,
+                               double scavenge_speed_in_bytes_per_ms);
+
  private:
   GCIdleTimeAction NothingOrDone(double idle_time_in_ms);
 
@@ -4,9 +4,11 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <cmath>
 #include <cstdarg>
 
 #include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
 #include "src/counters-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
@@ -124,6 +126,60 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
   }
 }
 
+DurationHistogram::DurationHistogram() { Reset(); }
+
+void DurationHistogram::Reset() {
+  memset(buckets_, 0, sizeof(buckets_));
+  count_ = 0;
+  total_ms_ = 0;
+  max_ms_ = 0;
+}
+
+int DurationHistogram::BucketIndex(uint64_t duration_us) {
+  if (duration_us < static_cast<uint64_t>(kSubBuckets)) {
+    return static_cast<int>(duration_us);
+  }
+  if (duration_us >= (static_cast<uint64_t>(1) << kMaxExponent)) {
+    return kNumberOfBuckets - 1;
+  }
+  int exponent = 63 - base::bits::CountLeadingZeros64(duration_us);
+  int sub_bucket = static_cast<int>(
+      (duration_us >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+  return (exponent - kSubBucketBits + 1) * kSubBuckets + sub_bucket;
+}
+
+uint64_t DurationHistogram::BucketUpperBound(int index) {
+  DCHECK_LT(index, kNumberOfBuckets);
+  if (index < kSubBuckets) return static_cast<uint64_t>(index) + 1;
+  int group = index / kSubBuckets;
+  int sub_bucket = index % kSubBuckets;
+  return static_cast<uint64_t>(kSubBuckets + sub_bucket + 1) << (group - 1);
+}
+
+void DurationHistogram::AddSample(double duration_ms) {
+  if (duration_ms < 0) duration_ms = 0;
+  buckets_[BucketIndex(static_cast<uint64_t>(duration_ms * 1000))]++;
+  count_++;
+  total_ms_ += duration_ms;
+  max_ms_ = Max(max_ms_, duration_ms);
+}
+
+double DurationHistogram::Percentile(double percentile) const {
+  if (count_ == 0) return 0;
+  DCHECK_LE(0, percentile);
+  DCHECK_LE(percentile, 100);
+  size_t target = static_cast<size_t>(std::ceil(count_ * percentile / 100));
+  target = Max(target, static_cast<size_t>(1));
+  size_t seen = 0;
+  for (int i = 0; i < kNumberOfBuckets; i++) {
+    seen += buckets_[i];
+    if (seen >= target) {
+      return Min(BucketUpperBound(i) / 1000.0, max_ms_);
+    }
+  }
+  return max_ms_;
+}
+
 const char* GCTracer::Event::TypeName(bool short_name) const {
   switch (type) {
     case SCAVENGER:
@@ -170,6 +226,9 @@ GCTracer::GCTracer(Heap* heap)
     background_counter_[i].total_duration_ms = 0;
     background_counter_[i].runtime_call_counter = RuntimeCallCounter(nullptr);
   }
+  for (int i = 0; i < kNumberOfPauseTypes; i++) {
+    pause_promoted_bytes_[i] = 0;
+  }
 }
 
 void GCTracer::ResetForTesting() {
@@ -198,6 +257,13 @@ void GCTracer::ResetForTesting() {
   average_mark_compact_duration_ = 0;
   current_mark_compact_mutator_utilization_ = 1.0;
   previous_mark_compact_end_time_ = 0;
+  for (int i = 0; i < kNumberOfPauseTypes; i++) {
+    pause_histograms_[i].Reset();
+    pause_promoted_bytes_[i] = 0;
+  }
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    scope_histograms_[i].reset();
+  }
   base::MutexGuard guard(&background_counter_mutex_);
   for (int i = 0; i < BackgroundScope::NUMBER_OF_SCOPES; i++) {
     background_counter_[i].total_duration_ms = 0;
@@ -349,6 +415,7 @@ void GCTracer::Stop(GarbageCollector collector) {
       UNREACHABLE();
   }
   FetchBackgroundGeneralCounters();
+  RecordPhaseHistograms(duration);
 
   heap_->UpdateTotalGCTime(duration);
 
@@ -1125,6 +1192,42 @@ void GCTracer::RecordGCPhasesHistograms(TimedHistogram* gc_timer) {
   }
 }
 
+void GCTracer::RecordPhaseHistograms(double duration) {
+  DCHECK_LT(static_cast<int>(current_.type), kNumberOfPauseTypes);
+  pause_histograms_[current_.type].AddSample(duration);
+  pause_promoted_bytes_[current_.type] += heap_->promoted_objects_size();
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    if (current_.scopes[i] == 0) continue;
+    if (!scope_histograms_[i]) {
+      scope_histograms_[i].reset(new DurationHistogram());
+    }
+    scope_histograms_[i]->AddSample(current_.scopes[i]);
+  }
+}
+
+void GCTracer::GetPhaseStatistics(int phase, PhaseStatistics* stats) const {
+  DCHECK_LE(0, phase);
+  DCHECK_LT(phase, kNumberOfPhases);
+  if (phase < kNumberOfPauseTypes) {
+    static const char* const kPauseNames[] = {
+        "V8.GCScavenger", "V8.GCCompactor", "V8.GCIncrementalCompactor",
+        "V8.GCMinorMC"};
+    STATIC_ASSERT(arraysize(kPauseNames) == kNumberOfPauseTypes);
+    stats->name = kPauseNames[phase];
+    stats->is_background = false;
+    stats->histogram = &pause_histograms_[phase];
+    stats->promoted_bytes = pause_promoted_bytes_[phase];
+    return;
+  }
+  static const DurationHistogram kEmptyHistogram;
+  int scope = phase - kNumberOfPauseTypes;
+  stats->name = Scope::Name(static_cast<Scope::ScopeId>(scope));
+  stats->is_background = scope >= Scope::FIRST_GENERAL_BACKGROUND_SCOPE;
+  stats->histogram = scope_histograms_[scope] ? scope_histograms_[scope].get()
+                                              : &kEmptyHistogram;
+  stats->promoted_bytes = 0;
+}
+
 void GCTracer::RecordGCSumCounters(double atomic_pause_duration) {
   base::MutexGuard guard(&background_counter_mutex_);
 
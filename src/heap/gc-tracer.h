@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <memory>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -36,6 +38,44 @@ enum ScavengeSpeedMode { kForAllObjects, kForSurvivedObjects };
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),              \
                GCTracer::BackgroundScope::Name(scope_id))
 
+// Log-linear histogram of durations with microsecond resolution. Every power
+// of two is split into kSubBuckets linear buckets, which bounds the relative
+// error of the reported percentiles by 1/kSubBuckets.
+class V8_EXPORT_PRIVATE DurationHistogram {
+ public:
+  static const int kSubBucketBits = 3;
+  static const int kSubBuckets = 1 << kSubBucketBits;
+  // Durations of 2^kMaxExponent microseconds (about 16 seconds) or more are
+  // accounted for in the last bucket.
+  static const int kMaxExponent = 24;
+  static const int kNumberOfBuckets =
+      (kMaxExponent - kSubBucketBits + 1) * kSubBuckets;
+
+  DurationHistogram();
+
+  void AddSample(double duration_ms);
+  void Reset();
+
+  // Returns the smallest bucket bound in milliseconds that is not exceeded by
+  // |percentile| percent of the samples. Returns 0 if there are no samples.
+  double Percentile(double percentile) const;
+
+  size_t count() const { return count_; }
+  double total_ms() const { return total_ms_; }
+  double max_ms() const { return max_ms_; }
+
+ private:
+  static int BucketIndex(uint64_t duration_us);
+  static uint64_t BucketUpperBound(int index);
+
+  uint32_t buckets_[kNumberOfBuckets];
+  size_t count_;
+  double total_ms_;
+  double max_ms_;
+
+  FRIEND_TEST(GCTracer, DurationHistogramBuckets);
+};
+
 // GCTracer collects and prints ONE line after each garbage collector
 // invocation IFF --trace_gc is used.
 class V8_EXPORT_PRIVATE GCTracer {
@@ -199,6 +239,23 @@ class V8_EXPORT_PRIVATE GCTracer {
         incremental_marking_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
   };
 
+  // Statistics of one entry in the phase table. The first
+  // kNumberOfPauseTypes entries describe the pauses of the different
+  // collectors, the remaining ones the time spent in each scope per garbage
+  // collection.
+  struct PhaseStatistics {
+    const char* name;
+    bool is_background;
+    const DurationHistogram* histogram;
+    // Bytes promoted by the garbage collections that were sampled. Only
+    // recorded for the pause entries.
+    size_t promoted_bytes;
+  };
+
+  static const int kNumberOfPauseTypes = Event::START;
+  static const int kNumberOfPhases =
+      kNumberOfPauseTypes + Scope::NUMBER_OF_SCOPES;
+
   static const int kThroughputTimeFrameMs = 5000;
 
   static RuntimeCallCounterId RCSCounterFromScope(Scope::ScopeId id);
@@ -323,6 +380,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void RecordGCPhasesHistograms(TimedHistogram* gc_timer);
 
+  // Fills in the statistics of entry |phase| of the phase table, which ranges
+  // from 0 to kNumberOfPhases - 1.
+  void GetPhaseStatistics(int phase, PhaseStatistics* stats) const;
+
  private:
   FRIEND_TEST(GCTracer, AverageSpeed);
   FRIEND_TEST(GCTracerTest, AllocationThroughput);
@@ -338,6 +399,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
+  FRIEND_TEST(GCTracerTest, PhaseStatistics);
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
@@ -365,6 +427,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // recording takes place at the end of the atomic pause.
   void RecordGCSumCounters(double atomic_pause_duration);
 
+  // Adds the pause and the time spent in each scope of the current event to
+  // the phase histograms.
+  void RecordPhaseHistograms(double duration);
+
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
@@ -454,6 +520,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[BackgroundScope::NUMBER_OF_SCOPES];
 
+  // Distributions backing GetPhaseStatistics. Scope histograms are only
+  // allocated once the scope is sampled.
+  DurationHistogram pause_histograms_[kNumberOfPauseTypes];
+  size_t pause_promoted_bytes_[kNumberOfPauseTypes];
+  std::unique_ptr<DurationHistogram> scope_histograms_[Scope::NUMBER_OF_SCOPES];
+
   DISALLOW_COPY_AND_ASSIGN(GCTracer);
 };
 
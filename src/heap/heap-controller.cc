@@ -122,6 +122,21 @@ size_t MemoryController::MinimumAllocationLimitGrowingStep(
                       : kRegularAllocationLimitGrowingStep);
 }
 
+void MemoryController::SetGCTimeBudget(double gc_time_ms_per_second) {
+  if (gc_time_ms_per_second <= 0) {
+    target_mutator_utilization_ = default_target_mutator_utilization_;
+    return;
+  }
+  // Spending more than half of the time in GC or less than a millisecond per
+  // second are not reasonable targets for the growing heuristics.
+  const double kMinMutatorUtilization = 0.5;
+  const double kMaxMutatorUtilization = 0.999;
+  double mu = 1.0 - gc_time_ms_per_second / 1000.0;
+  mu = Max(mu, kMinMutatorUtilization);
+  mu = Min(mu, kMaxMutatorUtilization);
+  target_mutator_utilization_ = mu;
+}
+
 double HeapController::MaxGrowingFactor(size_t curr_max_size) {
   const double min_small_factor = 1.3;
   const double max_small_factor = 2.0;
@@ -23,6 +23,7 @@ class V8_EXPORT_PRIVATE MemoryController {
         min_growing_factor_(min_growing_factor),
         max_growing_factor_(max_growing_factor),
         conservative_growing_factor_(conservative_growing_factor),
+        default_target_mutator_utilization_(target_mutator_utilization),
         target_mutator_utilization_(target_mutator_utilization) {}
   virtual ~MemoryController() = default;
 
@@ -36,6 +37,15 @@ class V8_EXPORT_PRIVATE MemoryController {
   // Computes the growing step when the limit increases.
   size_t MinimumAllocationLimitGrowingStep(Heap::HeapGrowingMode growing_mode);
 
+  // Derives the target mutator utilization from the garbage collection time
+  // the embedder is willing to spend per second of execution. A budget of
+  // zero restores the default target.
+  void SetGCTimeBudget(double gc_time_ms_per_second);
+
+  double target_mutator_utilization() const {
+    return target_mutator_utilization_;
+  }
+
  protected:
   double GrowingFactor(double gc_speed, double mutator_speed,
                        double max_factor);
@@ -45,12 +55,14 @@ class V8_EXPORT_PRIVATE MemoryController {
   const double min_growing_factor_;
   const double max_growing_factor_;
   const double conservative_growing_factor_;
-  const double target_mutator_utilization_;
+  const double default_target_mutator_utilization_;
+  double target_mutator_utilization_;
 
   FRIEND_TEST(HeapControllerTest, HeapGrowingFactor);
   FRIEND_TEST(HeapControllerTest, MaxHeapGrowingFactor);
   FRIEND_TEST(HeapControllerTest, MaxOldGenerationSize);
   FRIEND_TEST(HeapControllerTest, OldGenerationAllocationLimit);
+  FRIEND_TEST(HeapControllerTest, GCTimeBudget);
 };
 
 class V8_EXPORT_PRIVATE HeapController : public MemoryController {
@@ -703,17 +703,18 @@ CodeSpaceMemoryModificationScope::~CodeSpaceMemoryModificationScope() {
 
 CodePageCollectionMemoryModificationScope::
     CodePageCollectionMemoryModificationScope(Heap* heap)
-    : heap_(heap) {
-  if (heap_->write_protect_code_memory() &&
-      !heap_->code_space_memory_modification_scope_depth()) {
+    : heap_(heap),
+      owns_registry_(heap_->write_protect_code_memory() &&
+                     !heap_->code_space_memory_modification_scope_depth() &&
+                     !heap_->unprotected_memory_chunks_registry_enabled()) {
+  if (owns_registry_) {
     heap_->EnableUnprotectedMemoryChunksRegistry();
   }
 }
 
 CodePageCollectionMemoryModificationScope::
     ~CodePageCollectionMemoryModificationScope() {
-  if (heap_->write_protect_code_memory() &&
-      !heap_->code_space_memory_modification_scope_depth()) {
+  if (owns_registry_) {
     heap_->ProtectUnprotectedMemoryChunks();
     heap_->DisableUnprotectedMemoryChunksRegistry();
   }
@@ -20,6 +20,7 @@
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/feedback-vector.h"
+#include "src/frames-inl.h"
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
@@ -38,6 +39,7 @@
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/scavenge-job.h"
 #include "src/heap/scavenger-inl.h"
@@ -50,8 +52,10 @@
 #include "src/objects/data-handler.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/maybe-object.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-inl.h"
+#include "src/objects/string-table.h"
 #include "src/regexp/jsregexp.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/embedded-data.h"
@@ -64,6 +68,7 @@
 #include "src/utils-inl.h"
 #include "src/utils.h"
 #include "src/v8.h"
+#include "src/v8threads.h"
 #include "src/vm-state-inl.h"
 
 // Has to be the last include (doesn't have include guards):
@@ -263,7 +268,7 @@ bool Heap::HasBeenSetUp() {
 GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
                                               const char** reason) {
   // Is global GC requested?
-  if (space != NEW_SPACE) {
+  if (space != NEW_SPACE && space != NEW_LO_SPACE) {
     isolate_->counters()->gc_compactor_caused_by_request()->Increment();
     *reason = "GC in old space requested";
     return MARK_COMPACTOR;
@@ -281,7 +286,8 @@ GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
   }
 
   // Over-estimate the new space size using capacity to allow some slack.
-  if (!CanExpandOldGeneration(new_space_->TotalCapacity())) {
+  if (!CanExpandOldGeneration(new_space_->TotalCapacity() +
+                              new_lo_space()->Size())) {
     isolate_->counters()
         ->gc_compactor_caused_by_oldspace_exhaustion()
         ->Increment();
@@ -692,9 +698,12 @@ inline bool MakePretenureDecision(
     AllocationSite* site, AllocationSite::PretenureDecision current_decision,
     double ratio, bool maximum_size_scavenge) {
   // Here we just allow state transitions from undecided or maybe tenure
-  // to don't tenure, maybe tenure, or tenure.
-  if ((current_decision == AllocationSite::kUndecided ||
-       current_decision == AllocationSite::kMaybeTenure)) {
+  // to don't tenure, maybe tenure, or tenure. Don't tenure sites keep
+  // allocating mementos, so they may be revisited on request.
+  if (current_decision == AllocationSite::kUndecided ||
+      current_decision == AllocationSite::kMaybeTenure ||
+      (FLAG_allocation_site_pretenuring_revisit &&
+       current_decision == AllocationSite::kDontTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
       // maximum capacity.
@@ -739,6 +748,10 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
                  site->PretenureDecisionName(current_decision),
                  site->PretenureDecisionName(site->pretenure_decision()));
   }
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                       "V8.GCAllocationSitePretenuring",
+                       TRACE_EVENT_SCOPE_THREAD, "created", create_count,
+                       "found", found_count);
 
   // Clear feedback calculation fields until the next gc.
   site->set_memento_found_count(0);
@@ -1162,6 +1175,14 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
         attempt + 1 >= kMinNumberOfAttempts) {
       break;
     }
+    // Deduplicate once only live strings are left; the following attempts
+    // then reclaim the space given up by the duplicates. Growing the string
+    // table allocates, so skip the pass when that could fail.
+    if (attempt == 0 && FLAG_string_deduplication &&
+        gc_reason != GarbageCollectionReason::kLastResort &&
+        CanExpandOldGeneration(2 * string_table()->Size())) {
+      DeduplicateStrings();
+    }
   }
 
   set_current_gc_flags(kNoGCFlags);
@@ -1681,7 +1702,8 @@ bool Heap::PerformGarbageCollection(
         break;
       case SCAVENGER:
         if ((fast_promotion_mode_ &&
-             CanExpandOldGeneration(new_space()->Size()))) {
+             CanExpandOldGeneration(new_space()->Size() +
+                                    new_lo_space()->Size()))) {
           tracer()->NotifyYoungGenerationHandling(
               YoungGenerationHandling::kFastPromotionDuringScavenge);
           EvacuateYoungGeneration();
@@ -1760,22 +1782,22 @@ bool Heap::PerformGarbageCollection(
         isolate()->isolate_data()->external_memory_ +
         kExternalAllocationSoftLimit;
 
-    double max_factor =
-        heap_controller()->MaxGrowingFactor(max_old_generation_size_);
+    const size_t max_size = OldGenerationGrowingMaxSize(old_gen_size);
+    double max_factor = heap_controller()->MaxGrowingFactor(max_size);
     size_t new_limit = heap_controller()->CalculateAllocationLimit(
-        old_gen_size, max_old_generation_size_, max_factor, gc_speed,
-        mutator_speed, new_space()->Capacity(), CurrentHeapGrowingMode());
+        old_gen_size, max_size, max_factor, gc_speed, mutator_speed,
+        new_space()->Capacity(), CurrentHeapGrowingMode());
     old_generation_allocation_limit_ = new_limit;
 
     CheckIneffectiveMarkCompact(
         old_gen_size, tracer()->AverageMarkCompactMutatorUtilization());
   } else if (HasLowYoungGenerationAllocationRate() &&
              old_generation_size_configured_) {
-    double max_factor =
-        heap_controller()->MaxGrowingFactor(max_old_generation_size_);
+    const size_t max_size = OldGenerationGrowingMaxSize(old_gen_size);
+    double max_factor = heap_controller()->MaxGrowingFactor(max_size);
     size_t new_limit = heap_controller()->CalculateAllocationLimit(
-        old_gen_size, max_old_generation_size_, max_factor, gc_speed,
-        mutator_speed, new_space()->Capacity(), CurrentHeapGrowingMode());
+        old_gen_size, max_size, max_factor, gc_speed, mutator_speed,
+        new_space()->Capacity(), CurrentHeapGrowingMode());
     if (new_limit < old_generation_allocation_limit_) {
       old_generation_allocation_limit_ = new_limit;
     }
@@ -1924,7 +1946,8 @@ void Heap::EvacuateYoungGeneration() {
   ConcurrentMarking::PauseScope pause_scope(concurrent_marking());
   if (!FLAG_concurrent_marking) {
     DCHECK(fast_promotion_mode_);
-    DCHECK(CanExpandOldGeneration(new_space()->Size()));
+    DCHECK(
+        CanExpandOldGeneration(new_space()->Size() + new_lo_space()->Size()));
   }
 
   mark_compact_collector()->sweeper()->EnsureIterabilityCompleted();
@@ -1942,6 +1965,17 @@ void Heap::EvacuateYoungGeneration() {
       mark_compact_collector()->RecordLiveSlotsOnPage(p);
   }
 
+  // Promote young generation large objects by relinking their pages.
+  size_t promoted_large_objects_size = new_lo_space()->SizeOfObjects();
+  new_lo_space()->Flip();
+  for (LargePage* current = new_lo_space()->first_page(); current != nullptr;) {
+    LargePage* next_current = current->next_page();
+    lo_space()->PromoteNewLargeObject(current);
+    if (incremental_marking()->IsMarking())
+      mark_compact_collector()->RecordLiveSlotsOnPage(current);
+    current = next_current;
+  }
+
   // Reset new space.
   if (!new_space()->Rebalance()) {
     FatalProcessOutOfMemory("NewSpace::Rebalance");
@@ -1953,8 +1987,10 @@ void Heap::EvacuateYoungGeneration() {
   external_string_table_.PromoteAllNewSpaceStrings();
   // GlobalHandles are updated in PostGarbageCollectonProcessing
 
-  IncrementYoungSurvivorsCounter(new_space()->Size());
-  IncrementPromotedObjectsSize(new_space()->Size());
+  IncrementYoungSurvivorsCounter(new_space()->Size() +
+                                 promoted_large_objects_size);
+  IncrementPromotedObjectsSize(new_space()->Size() +
+                               promoted_large_objects_size);
   IncrementSemiSpaceCopiedObjectSize(0);
 
   LOG(isolate_, ResourceEvent("scavenge", "end"));
@@ -2848,6 +2884,14 @@ void Heap::ActivateMemoryReducerIfNeeded() {
   }
 }
 
+void Heap::RequestMemoryReduction() {
+  if (memory_reducer_ == nullptr) return;
+  MemoryReducer::Event event;
+  event.type = MemoryReducer::kPossibleGarbage;
+  event.time_ms = MonotonicallyIncreasingTimeInMs();
+  memory_reducer_->NotifyPossibleGarbage(event);
+}
+
 void Heap::ReduceNewSpaceSize() {
   // TODO(ulan): Unify this constant with the similar constant in
   // GCIdleTimeHandler once the change is merged to 4.5.
@@ -3044,6 +3088,13 @@ GCIdleTimeHeapState Heap::ComputeHeapState() {
       tracer()->ContextDisposalRateInMilliseconds();
   heap_state.size_of_objects = static_cast<size_t>(SizeOfObjects());
   heap_state.incremental_marking_stopped = incremental_marking()->IsStopped();
+  heap_state.new_space_capacity = new_space_->Capacity();
+  heap_state.used_new_space_size = new_space_->Size();
+  heap_state.scavenge_speed_in_bytes_per_ms =
+      tracer()->ScavengeSpeedInBytesPerMillisecond();
+  heap_state.final_incremental_mark_compact_speed_in_bytes_per_ms =
+      tracer()->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond();
+  heap_state.incremental_marking_limit_reached = false;
   return heap_state;
 }
 
@@ -3061,13 +3112,25 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
           incremental_marking()->AdvanceIncrementalMarking(
               deadline_in_ms, IncrementalMarking::NO_GC_VIA_STACK_GUARD,
               StepOrigin::kTask);
-      if (remaining_idle_time_in_ms > 0.0) {
+      if (remaining_idle_time_in_ms > 0.0 &&
+          (!action.strict_deadline ||
+           !incremental_marking()->IsComplete() ||
+           GCIdleTimeHandler::ShouldDoFinalIncrementalMarkCompact(
+               remaining_idle_time_in_ms, heap_state.size_of_objects,
+               heap_state
+                   .final_incremental_mark_compact_speed_in_bytes_per_ms))) {
         FinalizeIncrementalMarkingIfComplete(
             GarbageCollectionReason::kFinalizeMarkingViaTask);
       }
       result = incremental_marking()->IsStopped();
       break;
     }
+    case DO_SCAVENGE:
+      CollectGarbage(NEW_SPACE, GarbageCollectionReason::kIdleTask);
+      break;
+    case DO_START_INCREMENTAL_MARKING:
+      StartIncrementalMarking(kNoGCFlags, GarbageCollectionReason::kIdleTask);
+      break;
     case DO_FULL_GC: {
       DCHECK_LT(0, contexts_disposed_);
       HistogramTimerScope scope(isolate_->counters()->gc_context());
@@ -3151,6 +3214,37 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
 }
 
 
+bool Heap::IdleNotificationBetweenRequests(double deadline_in_seconds,
+                                           bool may_start_marking) {
+  CHECK(HasBeenSetUp());
+  double deadline_in_ms =
+      deadline_in_seconds *
+      static_cast<double>(base::Time::kMillisecondsPerSecond);
+  HistogramTimerScope idle_notification_scope(
+      isolate_->counters()->gc_idle_notification());
+  TRACE_EVENT0("v8", "V8.GCIdleNotificationBetweenRequests");
+  double start_ms = MonotonicallyIncreasingTimeInMs();
+  double idle_time_in_ms = deadline_in_ms - start_ms;
+
+  tracer()->SampleAllocation(start_ms, NewSpaceAllocationCounter(),
+                             OldGenerationAllocationCounter());
+
+  GCIdleTimeHeapState heap_state = ComputeHeapState();
+  if (may_start_marking && heap_state.incremental_marking_stopped) {
+    heap_state.incremental_marking_limit_reached =
+        IncrementalMarkingLimitReached() != IncrementalMarkingLimit::kNoLimit;
+  }
+
+  GCIdleTimeAction action = gc_idle_time_handler_->ComputeForIdlePeriod(
+      idle_time_in_ms, heap_state, may_start_marking);
+
+  bool result = PerformIdleTimeAction(action, heap_state, deadline_in_ms);
+
+  IdleNotificationEpilogue(action, heap_state, start_ms, deadline_in_ms);
+  return result;
+}
+
+
 bool Heap::RecentIdleNotificationHappened() {
   return (last_idle_notification_time_ +
           GCIdleTimeHandler::kMaxScheduledIdleTime) >
@@ -3183,6 +3277,9 @@ void Heap::CheckMemoryPressure() {
   // the finalizers.
   memory_pressure_level_ = MemoryPressureLevel::kNone;
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
+    if (FLAG_flush_bytecode_on_memory_pressure) {
+      FlushOldBytecodeOnMemoryPressure();
+    }
     CollectGarbageOnMemoryPressure();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
@@ -3198,6 +3295,135 @@ void Heap::CheckMemoryPressure() {
   }
 }
 
+void Heap::FlushOldBytecodeOnMemoryPressure() {
+  // The stacks of archived threads cannot be inspected here.
+  if (isolate()->thread_manager()->FirstThreadStateInUse() != nullptr) return;
+  if (isolate()->debug()->is_active() || isolate()->is_block_code_coverage() ||
+      isolate()->is_precise_count_code_coverage() ||
+      isolate()->is_collecting_type_profile()) {
+    return;
+  }
+  // Concurrent jobs read the bytecode of the functions they compile.
+  isolate()->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+
+  HandleScope scope(isolate());
+  std::vector<Handle<SharedFunctionInfo>> flushed_shareds;
+  std::vector<Handle<JSFunction>> flushed_functions;
+  {
+    // Interpreter frames and deoptimization of optimized frames need the
+    // bytecode of their functions. When the flush runs from an interrupt,
+    // JavaScript is on the stack.
+    std::unordered_set<Address> pinned;
+    for (JavaScriptFrameIterator it(isolate()); !it.done(); it.Advance()) {
+      std::vector<SharedFunctionInfo> shareds;
+      it.frame()->GetFunctions(&shareds);
+      for (SharedFunctionInfo shared : shareds) pinned.insert(shared.ptr());
+    }
+    // Optimized code may deoptimize into any of the functions it inlined.
+    Code::OptimizedCodeIterator code_iterator(isolate());
+    for (Code code = code_iterator.Next(); !code.is_null();
+         code = code_iterator.Next()) {
+      DeoptimizationData const data =
+          DeoptimizationData::cast(code->deoptimization_data());
+      if (data->length() == 0) continue;
+      pinned.insert(
+          data->GetInlinedFunction(DeoptimizationData::kNotInlinedIndex).ptr());
+      int const inlined_count = data->InlinedFunctionCount()->value();
+      for (int i = 0; i < inlined_count; ++i) {
+        pinned.insert(data->GetInlinedFunction(i).ptr());
+      }
+    }
+
+    auto is_flushable = [&pinned](SharedFunctionInfo shared) {
+      return shared->HasBytecodeArray() && !shared->HasAsmWasmData() &&
+             shared->GetBytecodeArray()->IsOld() && !shared->is_toplevel() &&
+             shared->IsUserJavaScript() && !shared->HasDebugInfo() &&
+             !IsResumableFunction(shared->kind()) &&
+             pinned.count(shared.ptr()) == 0;
+    };
+
+    HeapIterator iterator(this);
+    for (HeapObject* obj = iterator.next(); obj != nullptr;
+         obj = iterator.next()) {
+      if (obj->IsSharedFunctionInfo()) {
+        SharedFunctionInfo shared = SharedFunctionInfo::cast(obj);
+        if (is_flushable(shared)) {
+          flushed_shareds.emplace_back(shared, isolate());
+        }
+      } else if (obj->IsJSFunction()) {
+        JSFunction* function = JSFunction::cast(obj);
+        if (is_flushable(function->shared())) {
+          flushed_functions.emplace_back(function, isolate());
+        }
+      }
+    }
+  }
+
+  Code lazy = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+  for (Handle<JSFunction> function : flushed_functions) {
+    function->set_code(lazy);
+    // The vector is recreated with the new bytecode's feedback metadata.
+    if (function->feedback_cell() != many_closures_cell()) {
+      function->feedback_cell()->set_value(
+          ReadOnlyRoots(isolate()).undefined_value());
+    }
+  }
+  for (Handle<SharedFunctionInfo> shared : flushed_shareds) {
+    SharedFunctionInfo::DiscardCompiled(isolate(), shared);
+  }
+
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Flushed bytecode of %" PRIuS " functions on memory pressure\n",
+        flushed_shareds.size());
+  }
+}
+
+void Heap::DeduplicateStrings() {
+  if (!FLAG_thin_strings) return;
+  HandleScope scope(isolate());
+  // Internalizing allocates, which is not allowed while iterating the heap,
+  // so collect the candidates first.
+  std::vector<Handle<String>> candidates;
+  {
+    const size_t budget =
+        static_cast<size_t>(std::max(0, FLAG_string_deduplication_budget));
+    HeapIterator iterator(this);
+    for (HeapObject* obj = iterator.next();
+         obj != nullptr && candidates.size() < budget; obj = iterator.next()) {
+      // Only old space strings are internalized in place. Young strings
+      // would need a fresh internalized copy.
+      if (!obj->IsSeqOneByteString() || !InOldSpace(obj)) continue;
+      SeqOneByteString string = SeqOneByteString::cast(obj);
+      if (string->IsInternalizedString() ||
+          string->length() > FLAG_string_deduplication_max_length ||
+          string->Size() <= ThinString::kSize) {
+        continue;
+      }
+      candidates.push_back(handle(string, isolate()));
+    }
+  }
+  // The first copy of a value is internalized in place. Only later copies
+  // become ThinStrings forwarding to it.
+  size_t internalized = 0;
+  size_t deduplicated = 0;
+  for (Handle<String> string : candidates) {
+    if (!string->IsSeqOneByteString()) continue;
+    StringTable::LookupString(isolate(), string);
+    if (string->IsThinString()) {
+      deduplicated++;
+    } else if (string->IsInternalizedString()) {
+      internalized++;
+    }
+  }
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Deduplicated %" PRIuS " of %" PRIuS
+        " candidate strings, internalized %" PRIuS "\n",
+        deduplicated, candidates.size(), internalized);
+  }
+}
+
 void Heap::CollectGarbageOnMemoryPressure() {
   const int kGarbageThresholdInBytes = 8 * MB;
   const double kGarbageThresholdAsFractionOfTotalMemory = 0.1;
@@ -3292,6 +3518,31 @@ void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   UNREACHABLE();
 }
 
+void Heap::SetHeapGrowingPolicy(double gc_time_budget_ms_per_second,
+                                size_t memory_envelope) {
+  heap_controller()->SetGCTimeBudget(gc_time_budget_ms_per_second);
+  old_generation_memory_envelope_ = memory_envelope;
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Heap growing policy: mu=%.3f, envelope=%" PRIuS " KB\n",
+        heap_controller()->target_mutator_utilization(),
+        memory_envelope / KB);
+  }
+}
+
+size_t Heap::OldGenerationGrowingMaxSize(size_t old_gen_size) {
+  if (old_generation_memory_envelope_ == 0) return max_old_generation_size_;
+  // The allocation limit moves at most halfway towards the maximum size. Once
+  // the old generation exceeds the soft envelope, keep that halfway point at
+  // least one growing step above the current size. Otherwise the limit would
+  // drop below the live size and trigger back-to-back full GCs.
+  const size_t min_max_size =
+      old_gen_size + 2 * heap_controller()->MinimumAllocationLimitGrowingStep(
+                             CurrentHeapGrowingMode());
+  return Min(max_old_generation_size_,
+             Max(old_generation_memory_envelope_, min_max_size));
+}
+
 bool Heap::InvokeNearHeapLimitCallback() {
   if (near_heap_limit_callbacks_.size() > 0) {
     HandleScope scope(isolate());
@@ -4384,7 +4635,8 @@ void Heap::SetUp() {
     space_[i] = nullptr;
   }
 
-  space_[RO_SPACE] = read_only_space_ = new ReadOnlySpace(this);
+  read_only_heap_ = ReadOnlyHeap::SetUp(this);
+  space_[RO_SPACE] = read_only_space_ = read_only_heap_->read_only_space();
   space_[NEW_SPACE] = new_space_ =
       new NewSpace(this, memory_allocator_->data_page_allocator(),
                    initial_semispace_size_, max_semi_space_size_);
@@ -4392,7 +4644,8 @@ void Heap::SetUp() {
   space_[CODE_SPACE] = code_space_ = new CodeSpace(this);
   space_[MAP_SPACE] = map_space_ = new MapSpace(this);
   space_[LO_SPACE] = lo_space_ = new LargeObjectSpace(this);
-  space_[NEW_LO_SPACE] = new_lo_space_ = new NewLargeObjectSpace(this);
+  space_[NEW_LO_SPACE] = new_lo_space_ =
+      new NewLargeObjectSpace(this, new_space_->MaximumCapacity());
   space_[CODE_LO_SPACE] = code_lo_space_ = new CodeLargeObjectSpace(this);
 
   for (int i = 0; i < static_cast<int>(v8::Isolate::kUseCounterFeatureCount);
@@ -4669,6 +4922,13 @@ void Heap::TearDown() {
   delete tracer_;
   tracer_ = nullptr;
 
+  // The read-only space is owned by the read-only heap.
+  space_[RO_SPACE] = read_only_space_ = nullptr;
+  if (read_only_heap_ != nullptr) {
+    read_only_heap_->OnHeapTearDown();
+    read_only_heap_ = nullptr;
+  }
+
   for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
     delete space_[i];
     space_[i] = nullptr;
@@ -5321,6 +5581,12 @@ size_t Heap::ObjectSizeAtLastGC(size_t index) {
   return live_object_stats_->object_size_last_gc(index);
 }
 
+size_t Heap::ObjectSizeErrorAtLastGC(size_t index) {
+  if (live_object_stats_ == nullptr || index >= ObjectStats::OBJECT_STATS_COUNT)
+    return 0;
+  return live_object_stats_->object_size_error_last_gc(index);
+}
+
 
 bool Heap::GetObjectTypeName(size_t index, const char** object_type,
                              const char** object_sub_type) {
@@ -5462,7 +5728,10 @@ bool Heap::AllowedToBeMigrated(HeapObject* obj, AllocationSpace dst) {
 }
 
 void Heap::CreateObjectStats() {
-  if (V8_LIKELY(FLAG_gc_stats == 0)) return;
+  if (V8_LIKELY(FLAG_gc_stats == 0 &&
+                FLAG_gc_object_stats_sampling_interval == 0)) {
+    return;
+  }
   if (!live_object_stats_) {
     live_object_stats_ = new ObjectStats(this);
   }
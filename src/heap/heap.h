@@ -77,6 +77,7 @@ class ObjectIterator;
 class ObjectStats;
 class Page;
 class PagedSpace;
+class ReadOnlyHeap;
 class RootVisitor;
 class ScavengeJob;
 class Scavenger;
@@ -497,6 +498,8 @@ class Heap {
   // Implements the corresponding V8 API function.
   bool IdleNotification(double deadline_in_seconds);
   bool IdleNotification(int idle_time_in_ms);
+  bool IdleNotificationBetweenRequests(double deadline_in_seconds,
+                                       bool may_start_marking);
 
   void MemoryPressureNotification(MemoryPressureLevel level,
                                   bool is_isolate_locked);
@@ -506,6 +509,10 @@ class Heap {
   void RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  // See v8::Isolate::SetHeapGrowingPolicy.
+  void SetHeapGrowingPolicy(double gc_time_budget_ms_per_second,
+                            size_t memory_envelope);
+
   double MonotonicallyIncreasingTimeInMs();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -565,6 +572,9 @@ class Heap {
 
   void ActivateMemoryReducerIfNeeded();
 
+  // Starts the memory reducer on behalf of the embedder.
+  void RequestMemoryReduction();
+
   bool ShouldOptimizeForMemoryUsage();
 
   bool HighMemoryPressure() {
@@ -977,6 +987,9 @@ class Heap {
   // instance types.
   size_t ObjectCountAtLastGC(size_t index);
   size_t ObjectSizeAtLastGC(size_t index);
+  // Half-width of the 95% confidence interval of ObjectSizeAtLastGC() if the
+  // statistics were sampled, and 0 otherwise.
+  size_t ObjectSizeErrorAtLastGC(size_t index);
 
   // Retrieves names of buckets used by object statistics tracking.
   bool GetObjectTypeName(size_t index, const char** object_type,
@@ -1005,6 +1018,10 @@ class Heap {
   size_t InitialSemiSpaceSize() { return initial_semispace_size_; }
   size_t MaxOldGenerationSize() { return max_old_generation_size_; }
 
+  // The maximum old generation size used by the heap growing heuristics,
+  // taking the embedder-provided memory envelope into account.
+  size_t OldGenerationGrowingMaxSize(size_t old_gen_size);
+
   V8_EXPORT_PRIVATE static size_t ComputeMaxOldGenerationSize(
       uint64_t physical_memory);
 
@@ -1521,8 +1538,17 @@ class Heap {
 
   void CollectGarbageOnMemoryPressure();
 
+  // Resets functions whose bytecode has aged (i.e. has not been executed for
+  // several full GCs) to lazy compilation, so that the next GC can reclaim
+  // the bytecode. Functions with activations on the stack are kept.
+  void FlushOldBytecodeOnMemoryPressure();
+
   void EagerlyFreeExternalMemory();
 
+  // Internalizes short non-internalized sequential one-byte strings, which
+  // turns duplicates into ThinStrings pointing at a single copy.
+  void DeduplicateStrings();
+
   bool InvokeNearHeapLimitCallback();
 
   void ComputeFastPromotionMode();
@@ -1773,6 +1799,9 @@ class Heap {
   size_t initial_semispace_size_ = kMinSemiSpaceSizeInKB * KB;
   size_t max_old_generation_size_ = 700ul * (kPointerSize / 4) * MB;
   size_t initial_max_old_generation_size_;
+  // Soft upper bound for the old generation set by the embedder. Zero if not
+  // set. See v8::Isolate::SetHeapGrowingPolicy.
+  size_t old_generation_memory_envelope_ = 0;
   size_t initial_old_generation_size_;
   bool old_generation_size_configured_ = false;
   size_t maximum_committed_ = 0;
@@ -1814,6 +1843,7 @@ class Heap {
   CodeLargeObjectSpace* code_lo_space_ = nullptr;
   NewLargeObjectSpace* new_lo_space_ = nullptr;
   ReadOnlySpace* read_only_space_ = nullptr;
+  ReadOnlyHeap* read_only_heap_ = nullptr;
   // Map from the space id to the space.
   Space* space_[LAST_SPACE + 1];
 
@@ -2033,6 +2063,7 @@ class Heap {
   friend class IncrementalMarking;
   friend class IncrementalMarkingJob;
   friend class LargeObjectSpace;
+  friend class NewLargeObjectSpace;
   template <FixedArrayVisitationMode fixed_array_mode,
             TraceRetainingPathMode retaining_path_mode, typename MarkingState>
   friend class MarkingVisitor;
@@ -2124,7 +2155,8 @@ class CodeSpaceMemoryModificationScope {
 
 // The CodePageCollectionMemoryModificationScope can only be used by the main
 // thread. It will not be enabled if a CodeSpaceMemoryModificationScope is
-// already active.
+// already active. Nested scopes are folded into the outermost one, which
+// re-protects all pages collected in the meantime.
 class CodePageCollectionMemoryModificationScope {
  public:
   explicit inline CodePageCollectionMemoryModificationScope(Heap* heap);
@@ -2132,6 +2164,7 @@ class CodePageCollectionMemoryModificationScope {
 
  private:
   Heap* heap_;
+  bool owns_registry_;
 };
 
 // The CodePageMemoryModificationScope does not check if tansitions to
@@ -58,8 +58,11 @@ ItemParallelJob::~ItemParallelJob() {
   }
 }
 
-void ItemParallelJob::Run(const std::shared_ptr<Counters>& async_counters) {
+void ItemParallelJob::ScheduleBackgroundTasks(
+    const std::shared_ptr<Counters>& async_counters) {
   DCHECK_GT(tasks_.size(), 0);
+  DCHECK(!background_tasks_scheduled_);
+  background_tasks_scheduled_ = true;
   const size_t num_items = items_.size();
   const size_t num_tasks = tasks_.size();
 
@@ -88,9 +91,7 @@ void ItemParallelJob::Run(const std::shared_ptr<Counters>& async_counters) {
   const size_t items_per_task = num_tasks_processing_items > 0
                                     ? num_items / num_tasks_processing_items
                                     : 0;
-  CancelableTaskManager::Id* task_ids =
-      new CancelableTaskManager::Id[num_tasks];
-  std::unique_ptr<Task> main_task;
+  task_ids_.resize(num_tasks);
   for (size_t i = 0, start_index = 0; i < num_tasks;
        i++, start_index += items_per_task + (i < items_remainder ? 1 : 0)) {
     auto task = std::move(tasks_[i]);
@@ -104,26 +105,31 @@ void ItemParallelJob::Run(const std::shared_ptr<Counters>& async_counters) {
     task->SetupInternal(pending_tasks_, &items_, start_index,
                         i > 0 ? gc_parallel_task_latency_histogram
                               : base::Optional<AsyncTimedHistogram>());
-    task_ids[i] = task->id();
+    task_ids_[i] = task->id();
     if (i > 0) {
       V8::GetCurrentPlatform()->CallBlockingTaskOnWorkerThread(std::move(task));
     } else {
-      main_task = std::move(task);
+      main_task_ = std::move(task);
     }
   }
+}
+
+void ItemParallelJob::Run(const std::shared_ptr<Counters>& async_counters) {
+  if (!background_tasks_scheduled_) ScheduleBackgroundTasks(async_counters);
 
   // Contribute on main thread.
+  std::unique_ptr<Task> main_task = std::move(main_task_);
   DCHECK(main_task);
   main_task->Run();
 
   // Wait for background tasks.
-  for (size_t i = 0; i < num_tasks; i++) {
-    if (cancelable_task_manager_->TryAbort(task_ids[i]) !=
+  for (CancelableTaskManager::Id task_id : task_ids_) {
+    if (cancelable_task_manager_->TryAbort(task_id) !=
         TryAbortResult::kTaskAborted) {
       pending_tasks_->Wait();
     }
   }
-  delete[] task_ids;
+  task_ids_.clear();
 }
 
 }  // namespace internal
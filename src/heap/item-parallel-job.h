@@ -135,6 +135,14 @@ class V8_EXPORT_PRIVATE ItemParallelJob {
   int NumberOfItems() const { return static_cast<int>(items_.size()); }
   int NumberOfTasks() const { return static_cast<int>(tasks_.size()); }
 
+  // Schedules all but the first task on background threads without
+  // contributing on the main thread, e.g., to overlap background processing
+  // with other main thread work. No tasks or items may be added afterwards.
+  // Run() still needs to be called to execute the first task and to wait for
+  // the background tasks.
+  void ScheduleBackgroundTasks(
+      const std::shared_ptr<Counters>& async_counters);
+
   // Runs this job. Reporting metrics in a thread-safe manner to
   // |async_counters|.
   void Run(const std::shared_ptr<Counters>& async_counters);
@@ -142,6 +150,9 @@ class V8_EXPORT_PRIVATE ItemParallelJob {
  private:
   std::vector<Item*> items_;
   std::vector<std::unique_ptr<Task>> tasks_;
+  std::unique_ptr<Task> main_task_;
+  std::vector<CancelableTaskManager::Id> task_ids_;
+  bool background_tasks_scheduled_ = false;
   CancelableTaskManager* cancelable_task_manager_;
   base::Semaphore* pending_tasks_;
   DISALLOW_COPY_AND_ASSIGN(ItemParallelJob);
@@ -599,6 +599,15 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_time_budget_ms > 0 && estimated_compaction_speed != 0) {
+      // Bound the evacuation part of the pause by time rather than by a fixed
+      // quota. Heavily fragmented heaps are then compacted over several
+      // cycles, a bounded set of the most fragmented pages at a time.
+      *max_evacuated_bytes = Max(
+          static_cast<size_t>(area_size),
+          static_cast<size_t>(FLAG_compaction_time_budget_ms *
+                              estimated_compaction_speed));
+    }
   }
 }
 
@@ -1729,6 +1738,16 @@ void MarkCompactCollector::RecordObjectStats() {
     }
     heap()->live_object_stats_->CheckpointObjectStats();
     heap()->dead_object_stats_->ClearObjectStats();
+  } else if (V8_UNLIKELY(FLAG_gc_object_stats_sampling_interval > 0) &&
+             heap()->ms_count() % FLAG_gc_object_stats_sampling_interval ==
+                 0) {
+    heap()->CreateObjectStats();
+    ObjectStatsCollector collector(heap(), heap()->live_object_stats_,
+                                   heap()->dead_object_stats_);
+    int percent = Max(1, Min(100, FLAG_gc_object_stats_sampling_percent));
+    collector.CollectSampled(percent / 100.0);
+    heap()->live_object_stats_->CheckpointObjectStats();
+    heap()->dead_object_stats_->ClearObjectStats();
   }
 }
 
@@ -2813,9 +2832,9 @@ class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
   }
 };
 
-void MarkCompactCollector::RecordLiveSlotsOnPage(Page* page) {
+void MarkCompactCollector::RecordLiveSlotsOnPage(MemoryChunk* chunk) {
   EvacuateRecordOnlyVisitor visitor(heap());
-  LiveObjectVisitor::VisitBlackObjectsNoFail(page, non_atomic_marking_state(),
+  LiveObjectVisitor::VisitBlackObjectsNoFail(chunk, non_atomic_marking_state(),
                                              &visitor,
                                              LiveObjectVisitor::kKeepMarking);
 }
@@ -639,7 +639,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                    HeapObject* target);
   V8_INLINE static void RecordSlot(HeapObject* object, HeapObjectSlot slot,
                                    HeapObject* target);
-  void RecordLiveSlotsOnPage(Page* page);
+  void RecordLiveSlotsOnPage(MemoryChunk* chunk);
 
   void UpdateSlots(SlotsBuffer* buffer);
   void UpdateSlotsRecordedIn(SlotsBuffer* buffer);
@@ -4,6 +4,7 @@
 
 #include "src/heap/memory-reducer.h"
 
+#include "src/base/lazy-instance.h"
 #include "src/flags.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
@@ -21,6 +22,49 @@ const int MemoryReducer::kMaxNumberOfGCs = 3;
 const double MemoryReducer::kCommittedMemoryFactor = 1.1;
 const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
 
+bool MemoryReducerCoordinator::TryAcquire(MemoryReducer* reducer,
+                                          size_t reclaimable_memory,
+                                          double time_ms) {
+  base::MutexGuard guard(&mutex_);
+  candidates_[reducer] = {reclaimable_memory, time_ms};
+  if (last_reducer_ != nullptr && reducer != last_reducer_ &&
+      time_ms < last_gc_start_ms_ + FLAG_memory_reducer_stagger_ms) {
+    return false;
+  }
+  // Yield to an isolate that recently asked for a slot and is expected to
+  // free more memory. Candidates that stopped asking expire after the long
+  // delay.
+  for (const auto& entry : candidates_) {
+    if (entry.first != reducer &&
+        entry.second.time_ms + MemoryReducer::kLongDelayMs >= time_ms &&
+        entry.second.reclaimable_memory > reclaimable_memory) {
+      return false;
+    }
+  }
+  candidates_.erase(reducer);
+  last_reducer_ = reducer;
+  last_gc_start_ms_ = time_ms;
+  return true;
+}
+
+void MemoryReducerCoordinator::RemoveCandidate(MemoryReducer* reducer) {
+  base::MutexGuard guard(&mutex_);
+  candidates_.erase(reducer);
+}
+
+void MemoryReducerCoordinator::TearDown(MemoryReducer* reducer) {
+  base::MutexGuard guard(&mutex_);
+  candidates_.erase(reducer);
+  if (last_reducer_ == reducer) last_reducer_ = nullptr;
+}
+
+namespace {
+
+base::LazyInstance<MemoryReducerCoordinator>::type coordinator =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 MemoryReducer::MemoryReducer(Heap* heap)
     : heap_(heap),
       taskrunner_(V8::GetCurrentPlatform()->GetForegroundTaskRunner(
@@ -66,7 +110,15 @@ void MemoryReducer::TimerTask::RunInternal() {
 void MemoryReducer::NotifyTimer(const Event& event) {
   DCHECK_EQ(kTimer, event.type);
   DCHECK_EQ(kWait, state_.action);
+  const State old_state = state_;
   state_ = Step(state_, event);
+  if (state_.action == kRun && !TryAcquireProcessWideGCSlot(event.time_ms)) {
+    // Another isolate in the process runs a memory reducing GC or is
+    // expected to free more memory. Check again after the stagger delay.
+    state_ = State(kWait, old_state.started_gcs,
+                   event.time_ms + FLAG_memory_reducer_stagger_ms,
+                   old_state.last_gc_time_ms, 0);
+  }
   if (state_.action == kRun) {
     DCHECK(heap()->incremental_marking()->IsStopped());
     DCHECK(FLAG_incremental_marking);
@@ -105,6 +157,9 @@ void MemoryReducer::NotifyTimer(const Event& event) {
 
 void MemoryReducer::NotifyMarkCompact(const Event& event) {
   DCHECK_EQ(kMarkCompact, event.type);
+  if (FLAG_memory_reducer_stagger_ms > 0) {
+    coordinator.Pointer()->RemoveCandidate(this);
+  }
   Action old_action = state_.action;
   state_ = Step(state_, event);
   if (old_action != kWait && state_.action == kWait) {
@@ -218,7 +273,26 @@ void MemoryReducer::ScheduleTimer(double delay_ms) {
       (delay_ms + kSlackMs) / 1000.0);
 }
 
-void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0.0, 0); }
+bool MemoryReducer::TryAcquireProcessWideGCSlot(double time_ms) {
+  if (FLAG_memory_reducer_stagger_ms <= 0) return true;
+  return coordinator.Pointer()->TryAcquire(this, EstimateReclaimableMemory(),
+                                           time_ms);
+}
+
+size_t MemoryReducer::EstimateReclaimableMemory() {
+  GCTracer* tracer = heap()->tracer();
+  // Without survival data assume that half of the memory is garbage.
+  const double survival_ratio = tracer->SurvivalEventsRecorded()
+                                    ? tracer->AverageSurvivalRatio() / 100.0
+                                    : 0.5;
+  return static_cast<size_t>(heap()->CommittedOldGenerationMemory() *
+                             Max(0.0, 1.0 - survival_ratio));
+}
+
+void MemoryReducer::TearDown() {
+  coordinator.Pointer()->TearDown(this);
+  state_ = State(kDone, 0, 0, 0.0, 0);
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -5,8 +5,11 @@
 #ifndef V8_HEAP_MEMORY_REDUCER_H_
 #define V8_HEAP_MEMORY_REDUCER_H_
 
+#include <map>
+
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/cancelable-task.h"
 #include "src/globals.h"
 
@@ -121,6 +124,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // Posts a timer task that will call NotifyTimer after the given delay.
   void ScheduleTimer(double delay_ms);
   void TearDown();
+  // Estimates the old generation memory a memory reducing GC would free based
+  // on the recorded survival ratios.
+  size_t EstimateReclaimableMemory();
   static const int kLongDelayMs;
   static const int kShortDelayMs;
   static const int kWatchdogDelayMs;
@@ -154,6 +160,12 @@ class V8_EXPORT_PRIVATE MemoryReducer {
 
   static bool WatchdogGC(const State& state, const Event& event);
 
+  // Returns whether this isolate may start a memory reducing GC now. With
+  // --memory-reducer-stagger-ms, isolates in a process start these GCs at
+  // least that far apart and the isolate expected to free the most memory
+  // goes first.
+  bool TryAcquireProcessWideGCSlot(double time_ms);
+
   Heap* heap_;
   std::shared_ptr<v8::TaskRunner> taskrunner_;
   State state_;
@@ -165,6 +177,38 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   DISALLOW_COPY_AND_ASSIGN(MemoryReducer);
 };
 
+// Staggers memory reducing GCs of all isolates in the process, so that
+// isolates going idle at the same time do not all start marking at once.
+// The MemoryReducer instances are only used as keys and are never
+// dereferenced.
+class V8_EXPORT_PRIVATE MemoryReducerCoordinator {
+ public:
+  MemoryReducerCoordinator() = default;
+
+  // Returns whether {reducer} may start a memory reducing GC at {time_ms}.
+  // A denied reducer stays a candidate, so that other reducers that expect
+  // to free less memory yield to it.
+  bool TryAcquire(MemoryReducer* reducer, size_t reclaimable_memory,
+                  double time_ms);
+  // Withdraws the pending request of {reducer}, if any.
+  void RemoveCandidate(MemoryReducer* reducer);
+  // Forgets {reducer}, including the stagger delay of its last GC.
+  void TearDown(MemoryReducer* reducer);
+
+ private:
+  struct Candidate {
+    size_t reclaimable_memory;
+    double time_ms;
+  };
+
+  base::Mutex mutex_;
+  std::map<MemoryReducer*, Candidate> candidates_;
+  MemoryReducer* last_reducer_ = nullptr;
+  double last_gc_start_ms_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(MemoryReducerCoordinator);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -5,10 +5,13 @@
 
 #include "src/heap/object-stats.h"
 
+#include <cmath>
 #include <unordered_set>
+#include <vector>
 
 #include "src/assembler-inl.h"
 #include "src/base/bits.h"
+#include "src/base/utils/random-number-generator.h"
 #include "src/compilation-cache.h"
 #include "src/counters.h"
 #include "src/globals.h"
@@ -131,9 +134,12 @@ void ObjectStats::ClearObjectStats(bool clear_last_time_stats) {
   memset(over_allocated_, 0, sizeof(over_allocated_));
   memset(size_histogram_, 0, sizeof(size_histogram_));
   memset(over_allocated_histogram_, 0, sizeof(over_allocated_histogram_));
+  memset(object_size_variances_, 0, sizeof(object_size_variances_));
   if (clear_last_time_stats) {
     memset(object_counts_last_time_, 0, sizeof(object_counts_last_time_));
     memset(object_sizes_last_time_, 0, sizeof(object_sizes_last_time_));
+    memset(object_size_errors_last_time_, 0,
+           sizeof(object_size_errors_last_time_));
   }
   tagged_fields_count_ = 0;
   embedder_fields_count_ = 0;
@@ -279,9 +285,39 @@ void ObjectStats::CheckpointObjectStats() {
   base::MutexGuard lock_guard(object_stats_mutex.Pointer());
   MemCopy(object_counts_last_time_, object_counts_, sizeof(object_counts_));
   MemCopy(object_sizes_last_time_, object_sizes_, sizeof(object_sizes_));
+  for (int i = 0; i < OBJECT_STATS_COUNT; i++) {
+    // Normal approximation of the 95% confidence interval.
+    object_size_errors_last_time_[i] =
+        static_cast<size_t>(1.96 * std::sqrt(object_size_variances_[i]));
+  }
   ClearObjectStats();
 }
 
+void ObjectStats::BeginSampledUnit() {
+  MemCopy(sampled_unit_counts_, object_counts_, sizeof(object_counts_));
+  MemCopy(sampled_unit_sizes_, object_sizes_, sizeof(object_sizes_));
+}
+
+void ObjectStats::EndSampledUnit(double inclusion_probability) {
+  DCHECK_LT(0, inclusion_probability);
+  DCHECK_LE(inclusion_probability, 1);
+  // Horvitz-Thompson estimator: every visited unit stands in for
+  // 1 / inclusion_probability units.
+  const double extra_weight = 1 / inclusion_probability - 1;
+  const double variance_factor =
+      (1 - inclusion_probability) /
+      (inclusion_probability * inclusion_probability);
+  for (int i = 0; i < OBJECT_STATS_COUNT; i++) {
+    size_t count = object_counts_[i] - sampled_unit_counts_[i];
+    size_t size = object_sizes_[i] - sampled_unit_sizes_[i];
+    if (size == 0 && count == 0) continue;
+    object_counts_[i] += static_cast<size_t>(count * extra_weight + 0.5);
+    object_sizes_[i] += static_cast<size_t>(size * extra_weight + 0.5);
+    object_size_variances_[i] +=
+        variance_factor * static_cast<double>(size) * static_cast<double>(size);
+  }
+}
+
 namespace {
 
 int Log2ForSize(size_t size) {
@@ -1013,6 +1049,39 @@ void IterateHeap(Heap* heap, ObjectStatsVisitor* visitor) {
   }
 }
 
+bool IsSampledSpace(AllocationSpace space) {
+  return space == OLD_SPACE || space == CODE_SPACE || space == MAP_SPACE;
+}
+
+// Visits all spaces that are not sampled completely, and the given pages of
+// the sampled spaces as separate units.
+void IterateSampledHeap(Heap* heap, ObjectStatsVisitor* visitor,
+                        const std::vector<Page*>& sampled_pages,
+                        double sampling_fraction, ObjectStats* live,
+                        ObjectStats* dead) {
+  SpaceIterator space_it(heap);
+  HeapObject* obj = nullptr;
+  while (space_it.has_next()) {
+    Space* space = space_it.next();
+    if (IsSampledSpace(space->identity())) continue;
+    std::unique_ptr<ObjectIterator> it(space->GetObjectIterator());
+    ObjectIterator* obj_it = it.get();
+    while ((obj = obj_it->Next()) != nullptr) {
+      visitor->Visit(obj, obj->Size());
+    }
+  }
+  for (Page* page : sampled_pages) {
+    live->BeginSampledUnit();
+    dead->BeginSampledUnit();
+    HeapObjectIterator obj_it(page);
+    while ((obj = obj_it.Next()) != nullptr) {
+      visitor->Visit(obj, obj->Size());
+    }
+    live->EndSampledUnit(sampling_fraction);
+    dead->EndSampledUnit(sampling_fraction);
+  }
+}
+
 }  // namespace
 
 void ObjectStatsCollector::Collect() {
@@ -1026,5 +1095,30 @@ void ObjectStatsCollector::Collect() {
   }
 }
 
+void ObjectStatsCollector::CollectSampled(double sampling_fraction) {
+  DCHECK_LT(0, sampling_fraction);
+  DCHECK_LE(sampling_fraction, 1);
+  // Pages are selected up front as all phases need to see the same pages.
+  base::RandomNumberGenerator* rng =
+      heap_->isolate()->random_number_generator();
+  std::vector<Page*> sampled_pages;
+  PagedSpaces spaces(heap_);
+  for (PagedSpace* space = spaces.next(); space != nullptr;
+       space = spaces.next()) {
+    DCHECK(IsSampledSpace(space->identity()));
+    for (Page* page : *space) {
+      if (rng->NextDouble() < sampling_fraction) sampled_pages.push_back(page);
+    }
+  }
+  ObjectStatsCollectorImpl live_collector(heap_, live_);
+  ObjectStatsCollectorImpl dead_collector(heap_, dead_);
+  for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+    ObjectStatsVisitor visitor(heap_, &live_collector, &dead_collector,
+                               static_cast<ObjectStatsCollectorImpl::Phase>(i));
+    IterateSampledHeap(heap_, &visitor, sampled_pages, sampling_fraction,
+                       live_, dead_);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
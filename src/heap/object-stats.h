@@ -118,6 +118,19 @@ class ObjectStats {
     return object_sizes_last_time_[index];
   }
 
+  // Half-width of the 95% confidence interval of object_size_last_gc() when
+  // the statistics were extrapolated from a sample, and 0 otherwise.
+  size_t object_size_error_last_gc(size_t index) {
+    return object_size_errors_last_time_[index];
+  }
+
+  // Sampled collection visits units (pages) with a given probability. Stats
+  // recorded between BeginSampledUnit() and EndSampledUnit() are weighted by
+  // the inverse of |inclusion_probability|, and the variance of the estimate
+  // is accumulated. Size histograms only reflect the visited objects.
+  void BeginSampledUnit();
+  void EndSampledUnit(double inclusion_probability);
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
@@ -145,6 +158,12 @@ class ObjectStats {
   size_t object_counts_last_time_[OBJECT_STATS_COUNT];
   size_t object_sizes_[OBJECT_STATS_COUNT];
   size_t object_sizes_last_time_[OBJECT_STATS_COUNT];
+  // Sampling state: counts and sizes at the start of the current unit and
+  // the estimated variance of the sizes.
+  size_t sampled_unit_counts_[OBJECT_STATS_COUNT];
+  size_t sampled_unit_sizes_[OBJECT_STATS_COUNT];
+  double object_size_variances_[OBJECT_STATS_COUNT];
+  size_t object_size_errors_last_time_[OBJECT_STATS_COUNT];
   // Approximation of overallocated memory by InstanceType.
   size_t over_allocated_[OBJECT_STATS_COUNT];
   // Detailed histograms by InstanceType.
@@ -172,6 +191,11 @@ class ObjectStatsCollector {
   // be present.
   void Collect();
 
+  // Like Collect() but only visits each page of the old, code, and map space
+  // with probability |sampling_fraction| and extrapolates the results. Global
+  // statistics that are not attributable to pages are skipped.
+  void CollectSampled(double sampling_fraction);
+
  private:
   Heap* const heap_;
   ObjectStats* const live_;
@@ -0,0 +1,41 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_READ_ONLY_HEAP_H_
+#define V8_HEAP_READ_ONLY_HEAP_H_
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class ReadOnlySpace;
+
+// This class manages the creation and destruction of read-only space for a
+// heap. Keeping ownership of the space out of Heap is the first step towards
+// sharing it between isolates.
+class ReadOnlyHeap {
+ public:
+  // Creates a new read-only heap and its space for |heap|.
+  static ReadOnlyHeap* SetUp(Heap* heap);
+
+  // Frees the read-only space and the read-only heap itself. Has to be called
+  // when the heap that created it is torn down.
+  void OnHeapTearDown();
+
+  ReadOnlySpace* read_only_space() const { return read_only_space_; }
+
+ private:
+  explicit ReadOnlyHeap(ReadOnlySpace* ro_space) : read_only_space_(ro_space) {}
+
+  ReadOnlySpace* read_only_space_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(ReadOnlyHeap);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_READ_ONLY_HEAP_H_
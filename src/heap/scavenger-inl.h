@@ -46,6 +46,10 @@ bool Scavenger::PromotionList::View::ShouldEagerlyProcessPromotionList() {
   return promotion_list_->ShouldEagerlyProcessPromotionList(task_id_);
 }
 
+void Scavenger::PromotionList::View::RequestWork() {
+  promotion_list_->RequestWork();
+}
+
 void Scavenger::PromotionList::PushRegularObject(int task_id,
                                                  HeapObject* object, int size) {
   regular_object_promotion_list_.Push(task_id, ObjectAndSize(object, size));
@@ -83,6 +87,11 @@ bool Scavenger::PromotionList::IsGlobalPoolEmpty() {
          large_object_promotion_list_.IsGlobalPoolEmpty();
 }
 
+void Scavenger::PromotionList::RequestWork() {
+  regular_object_promotion_list_.RequestWork();
+  large_object_promotion_list_.RequestWork();
+}
+
 bool Scavenger::PromotionList::ShouldEagerlyProcessPromotionList(int task_id) {
   // Threshold when to prioritize processing of the promotion list. Right
   // now we only look into the regular object list.
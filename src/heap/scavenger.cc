@@ -32,11 +32,15 @@ class PageScavengingItem final : public ItemParallelJob::Item {
 
 class ScavengingTask final : public ItemParallelJob::Task {
  public:
-  ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier)
+  // |barrier_pending| indicates that the task has already been registered
+  // with the barrier using OneshotBarrier::StartPending().
+  ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier,
+                 bool barrier_pending)
       : ItemParallelJob::Task(heap->isolate()),
         heap_(heap),
         scavenger_(scavenger),
-        barrier_(barrier) {}
+        barrier_(barrier),
+        barrier_pending_(barrier_pending) {}
 
   void RunInParallel() final {
     TRACE_BACKGROUND_GC(
@@ -44,7 +48,11 @@ class ScavengingTask final : public ItemParallelJob::Task {
         GCTracer::BackgroundScope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL);
     double scavenging_time = 0.0;
     {
-      barrier_->Start();
+      if (barrier_pending_) {
+        barrier_->Join();
+      } else {
+        barrier_->Start();
+      }
       TimedScope scope(&scavenging_time);
       PageScavengingItem* item = nullptr;
       while ((item = GetItem<PageScavengingItem>()) != nullptr) {
@@ -53,6 +61,9 @@ class ScavengingTask final : public ItemParallelJob::Task {
       }
       do {
         scavenger_->Process(barrier_);
+        // Busy tasks split their local segments and wake up waiting tasks
+        // once shared work shows up in the global pools.
+        scavenger_->RequestWork();
       } while (!barrier_->Wait());
       scavenger_->Process();
     }
@@ -68,6 +79,7 @@ class ScavengingTask final : public ItemParallelJob::Task {
   Heap* const heap_;
   Scavenger* const scavenger_;
   OneshotBarrier* const barrier_;
+  const bool barrier_pending_;
 };
 
 class IterateAndScavengePromotedObjectsVisitor final : public ObjectVisitor {
@@ -159,14 +171,26 @@ void ScavengerCollector::CollectGarbage() {
   const int kMainThreadId = 0;
   Scavenger* scavengers[kMaxScavengerTasks];
   const bool is_logging = isolate_->LogObjectRelocation();
-  const int num_scavenge_tasks = NumberOfScavengeTasks();
+  int old_to_new_pages = 0;
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      heap_, [&old_to_new_pages](MemoryChunk* chunk) { old_to_new_pages++; });
+  const int num_scavenge_tasks = NumberOfScavengeTasks(old_to_new_pages);
   OneshotBarrier barrier(base::TimeDelta::FromMilliseconds(kMaxWaitTimeMs));
   Scavenger::CopiedList copied_list(num_scavenge_tasks);
   Scavenger::PromotionList promotion_list(num_scavenge_tasks);
+  // With early parallel scavenging, background tasks start processing
+  // old-to-new pages while the main thread is still scavenging the roots. The
+  // main thread registers with the barrier upfront as pending, so that the
+  // background tasks neither terminate nor time out before it joins.
+  const bool early_start =
+      FLAG_early_parallel_scavenge && num_scavenge_tasks > 1;
+  if (early_start) barrier.StartPending();
   for (int i = 0; i < num_scavenge_tasks; i++) {
     scavengers[i] = new Scavenger(this, heap_, is_logging, &copied_list,
                                   &promotion_list, i);
-    job.AddTask(new ScavengingTask(heap_, scavengers[i], &barrier));
+    const bool barrier_pending = early_start && i == kMainThreadId;
+    job.AddTask(
+        new ScavengingTask(heap_, scavengers[i], &barrier, barrier_pending));
   }
 
   {
@@ -196,10 +220,16 @@ void ScavengerCollector::CollectGarbage() {
       isolate_->global_handles()->IdentifyWeakUnmodifiedObjects(
           &JSObject::IsUnmodifiedApiObject);
     }
+    if (early_start) {
+      // The graph may be modified from here on.
+      job.ScheduleBackgroundTasks(isolate_->async_counters());
+    }
     {
       // Copy roots.
       TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS);
       heap_->IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+      // Wake up background tasks that wait for work produced by the roots.
+      if (early_start) barrier.NotifyAll();
     }
     {
       // Parallel phase scavenging all copied and promoted objects.
@@ -296,6 +326,7 @@ void ScavengerCollector::HandleSurvivingNewLargeObjects() {
     object->set_map_word(MapWord::FromMap(map));
     LargePage* page = LargePage::FromHeapObject(object);
     heap_->lo_space()->PromoteNewLargeObject(page);
+    heap_->IncrementPromotedObjectsSize(object->SizeFromMap(map));
   }
   surviving_new_large_objects_.clear();
 }
@@ -309,10 +340,14 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
   }
 }
 
-int ScavengerCollector::NumberOfScavengeTasks() {
+int ScavengerCollector::NumberOfScavengeTasks(int old_to_new_pages) {
   if (!FLAG_parallel_scavenge) return 1;
+  // Both the size of the new space and the number of pages with old-to-new
+  // slots (which are processed as independent work items) bound the amount
+  // of parallelism available.
   const int num_scavenge_tasks =
-      static_cast<int>(heap_->new_space()->TotalCapacity()) / MB;
+      Max(static_cast<int>(heap_->new_space()->TotalCapacity()) / MB,
+          old_to_new_pages / kPagesPerScavengeTask);
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
   int tasks =
       Max(1, Min(Min(num_scavenge_tasks, kMaxScavengerTasks), num_cores));
@@ -417,6 +452,11 @@ void Scavenger::Process(OneshotBarrier* barrier) {
   } while (!done);
 }
 
+void Scavenger::RequestWork() {
+  copied_list_.RequestWork();
+  promotion_list_.RequestWork();
+}
+
 void Scavenger::Finalize() {
   heap()->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
   heap()->IncrementSemiSpaceCopiedObjectSize(copied_size_);
@@ -28,7 +28,10 @@ using SurvivingNewLargeObjectMapEntry = std::pair<HeapObject*, Map>;
 
 class ScavengerCollector {
  public:
-  static const int kMaxScavengerTasks = 8;
+  static const int kMaxScavengerTasks = 16;
+  // Number of old-to-new remembered set pages that justify an additional
+  // scavenging task.
+  static const int kPagesPerScavengeTask = 8;
   static const int kMaxWaitTimeMs = 2;
 
   explicit ScavengerCollector(Heap* heap);
@@ -39,7 +42,7 @@ class ScavengerCollector {
   void MergeSurvivingNewLargeObjects(
       const SurvivingNewLargeObjectsMap& objects);
 
-  int NumberOfScavengeTasks();
+  int NumberOfScavengeTasks(int old_to_new_pages);
 
   void HandleSurvivingNewLargeObjects();
 
@@ -73,6 +76,7 @@ class Scavenger {
       inline bool Pop(struct PromotionListEntry* entry);
       inline bool IsGlobalPoolEmpty();
       inline bool ShouldEagerlyProcessPromotionList();
+      inline void RequestWork();
 
      private:
       PromotionList* promotion_list_;
@@ -91,6 +95,7 @@ class Scavenger {
     inline bool Pop(int task_id, struct PromotionListEntry* entry);
     inline bool IsGlobalPoolEmpty();
     inline bool ShouldEagerlyProcessPromotionList(int task_id);
+    inline void RequestWork();
 
    private:
     static const int kRegularObjectPromotionListSegmentSize = 256;
@@ -121,6 +126,10 @@ class Scavenger {
   // manually scavenged using ScavengeObject or CheckAndScavengeObject.
   void Process(OneshotBarrier* barrier = nullptr);
 
+  // Asks other scavenging tasks to share parts of their local copied and
+  // promotion lists. Used by tasks that ran out of work.
+  void RequestWork();
+
   // Finalize the Scavenger. Needs to be called from the main thread.
   void Finalize();
 
@@ -23,7 +23,11 @@ enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
 // operation.
 // The data structure assumes that the slots are pointer size aligned and
 // splits the valid slot offset range into kBuckets buckets.
-// Each bucket is a bitmap with a bit corresponding to a single slot offset.
+// A bucket starts out sparse, as a small array of slot indices, and is
+// upgraded to a bitmap with a bit corresponding to a single slot offset once
+// it holds more than kSparseBucketCapacity slots. Both representations are
+// accessed with atomic operations. Buckets are installed with compare-and-swap
+// like bitmap buckets always were.
 class SlotSet : public Malloced {
  public:
   enum EmptyBucketMode {
@@ -50,8 +54,9 @@ class SlotSet : public Malloced {
   void SetPageStart(Address page_start) { page_start_ = page_start; }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
-  // This method should only be called on the main thread because concurrent
-  // allocation of the bucket is not thread-safe.
+  // Buckets are allocated and upgraded with compare-and-swap, so this method
+  // can be called concurrently as long as no slot in the bucket is removed
+  // and the bucket is not freed at the same time.
   //
   // AccessMode defines whether there can be concurrent access on the buckets
   // or not.
@@ -60,16 +65,18 @@ class SlotSet : public Malloced {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
-    if (bucket == nullptr) {
-      bucket = AllocateBucket();
-      if (!SwapInNewBucket<access_mode>(&buckets_[bucket_index], bucket)) {
-        DeleteArray<uint32_t>(bucket);
-        bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
+    if (bucket == nullptr || IsSparseBucket(bucket)) {
+      if (InsertIntoSparseBucket<access_mode>(
+              bucket_index, ToBucketSlot(cell_index, bit_index))) {
+        return;
       }
+      // The bucket was upgraded to a bitmap.
+      bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
     }
     // Check that monotonicity is preserved, i.e., once a bucket is set we do
     // not free it concurrently.
     DCHECK_NOT_NULL(bucket);
+    DCHECK(!IsSparseBucket(bucket));
     DCHECK_EQ(bucket, LoadBucket<access_mode>(&buckets_[bucket_index]));
     uint32_t mask = 1u << bit_index;
     if ((LoadCell<access_mode>(&bucket[cell_index]) & mask) == 0) {
@@ -79,25 +86,23 @@ class SlotSet : public Malloced {
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   // Returns true if the set contains the slot.
-  bool Contains(int slot_offset) {
-    int bucket_index, cell_index, bit_index;
-    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-    if (bucket == nullptr) return false;
-    return (LoadCell(&bucket[cell_index]) & (1u << bit_index)) != 0;
-  }
+  bool Contains(int slot_offset) { return Lookup(slot_offset); }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   void Remove(int slot_offset) {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-    if (bucket != nullptr) {
-      uint32_t cell = LoadCell(&bucket[cell_index]);
-      uint32_t bit_mask = 1u << bit_index;
-      if (cell & bit_mask) {
-        ClearCellBits(&bucket[cell_index], bit_mask);
-      }
+    if (bucket == nullptr) return;
+    if (IsSparseBucket(bucket)) {
+      RemoveFromSparseBucket(ToSparseBucket(bucket),
+                             ToBucketSlot(cell_index, bit_index));
+      return;
+    }
+    uint32_t cell = LoadCell(&bucket[cell_index]);
+    uint32_t bit_mask = 1u << bit_index;
+    if (cell & bit_mask) {
+      ClearCellBits(&bucket[cell_index], bit_mask);
     }
   }
 
@@ -110,11 +115,13 @@ class SlotSet : public Malloced {
     SlotToIndices(start_offset, &start_bucket, &start_cell, &start_bit);
     int end_bucket, end_cell, end_bit;
     SlotToIndices(end_offset, &end_bucket, &end_cell, &end_bit);
+    RemoveRangeFromSparseBuckets(start_offset >> kPointerSizeLog2,
+                                 end_offset >> kPointerSizeLog2);
     uint32_t start_mask = (1u << start_bit) - 1;
     uint32_t end_mask = ~((1u << end_bit) - 1);
     Bucket bucket;
     if (start_bucket == end_bucket && start_cell == end_cell) {
-      bucket = LoadBucket(&buckets_[start_bucket]);
+      bucket = LoadBitmapBucket(start_bucket);
       if (bucket != nullptr) {
         ClearCellBits(&bucket[start_cell], ~(start_mask | end_mask));
       }
@@ -122,7 +129,7 @@ class SlotSet : public Malloced {
     }
     int current_bucket = start_bucket;
     int current_cell = start_cell;
-    bucket = LoadBucket(&buckets_[current_bucket]);
+    bucket = LoadBitmapBucket(current_bucket);
     if (bucket != nullptr) {
       ClearCellBits(&bucket[current_cell], ~start_mask);
     }
@@ -145,7 +152,7 @@ class SlotSet : public Malloced {
         ReleaseBucket(current_bucket);
       } else {
         DCHECK(mode == KEEP_EMPTY_BUCKETS);
-        bucket = LoadBucket(&buckets_[current_bucket]);
+        bucket = LoadBitmapBucket(current_bucket);
         if (bucket != nullptr) {
           ClearBucket(bucket, 0, kCellsPerBucket);
         }
@@ -153,11 +160,10 @@ class SlotSet : public Malloced {
       current_bucket++;
     }
     // All buckets between start_bucket and end_bucket are cleared.
-    bucket = LoadBucket(&buckets_[current_bucket]);
     DCHECK(current_bucket == end_bucket && current_cell <= end_cell);
-    if (current_bucket == kBuckets || bucket == nullptr) {
-      return;
-    }
+    if (current_bucket == kBuckets) return;
+    bucket = LoadBitmapBucket(current_bucket);
+    if (bucket == nullptr) return;
     while (current_cell < end_cell) {
       StoreCell(&bucket[current_cell], 0);
       current_cell++;
@@ -173,6 +179,10 @@ class SlotSet : public Malloced {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
     if (bucket == nullptr) return false;
+    if (IsSparseBucket(bucket)) {
+      return SparseBucketContains(ToSparseBucket(bucket),
+                                  ToBucketSlot(cell_index, bit_index));
+    }
     return (LoadCell(&bucket[cell_index]) & (1u << bit_index)) != 0;
   }
 
@@ -192,30 +202,10 @@ class SlotSet : public Malloced {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
       if (bucket != nullptr) {
-        int in_bucket_count = 0;
-        int cell_offset = bucket_index * kBitsPerBucket;
-        for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
-          uint32_t cell = LoadCell(&bucket[i]);
-          if (cell) {
-            uint32_t old_cell = cell;
-            uint32_t mask = 0;
-            while (cell) {
-              int bit_offset = base::bits::CountTrailingZeros(cell);
-              uint32_t bit_mask = 1u << bit_offset;
-              uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
-              if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
-                ++in_bucket_count;
-              } else {
-                mask |= bit_mask;
-              }
-              cell ^= bit_mask;
-            }
-            uint32_t new_cell = old_cell & ~mask;
-            if (old_cell != new_cell) {
-              ClearCellBits(&bucket[i], mask);
-            }
-          }
-        }
+        int in_bucket_count =
+            IsSparseBucket(bucket)
+                ? IterateSparseBucket(bucket_index, callback)
+                : IterateBitmapBucket(bucket, bucket_index, callback);
         if (mode == PREFREE_EMPTY_BUCKETS && in_bucket_count == 0) {
           PreFreeEmptyBucket(bucket_index);
         }
@@ -234,7 +224,11 @@ class SlotSet : public Malloced {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
       if (bucket != nullptr) {
-        if (IsEmptyBucket(bucket)) {
+        if (IsSparseBucket(bucket)) {
+          if (IsEmptySparseBucket(ToSparseBucket(bucket))) {
+            PreFreeEmptyBucket(bucket_index);
+          }
+        } else if (IsEmptyBucket(bucket)) {
           PreFreeEmptyBucket(bucket_index);
         }
       }
@@ -245,7 +239,9 @@ class SlotSet : public Malloced {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
       if (bucket != nullptr) {
-        if (IsEmptyBucket(bucket)) {
+        if (IsSparseBucket(bucket)) {
+          ReleaseSparseBucket(bucket_index, true);
+        } else if (IsEmptyBucket(bucket)) {
           ReleaseBucket(bucket_index);
         }
       }
@@ -260,6 +256,10 @@ class SlotSet : public Malloced {
       DeleteArray<uint32_t>(top);
     }
     DCHECK_EQ(0u, to_be_freed_buckets_.size());
+    while (!upgraded_sparse_buckets_.empty()) {
+      DeleteArray<uint32_t>(upgraded_sparse_buckets_.top());
+      upgraded_sparse_buckets_.pop();
+    }
   }
 
  private:
@@ -273,6 +273,274 @@ class SlotSet : public Malloced {
   static const int kBitsPerBucketLog2 = kCellsPerBucketLog2 + kBitsPerCellLog2;
   static const int kBuckets = kMaxSlots / kCellsPerBucket / kBitsPerCell;
 
+  // A sparse bucket holds two 16-bit entries per cell and fits into a quarter
+  // of a bitmap bucket.
+  static const int kSparseBucketCells = 8;
+  static const int kSparseBucketCapacity = 2 * kSparseBucketCells;
+  static const int kBitsPerSparseEntry = 16;
+  static const uint32_t kSparseEntryMask = (1u << kBitsPerSparseEntry) - 1;
+  // Sparse buckets are stored in buckets_ with the lowest bit set.
+  static const uintptr_t kSparseBucketTag = 1;
+  STATIC_ASSERT(kBitsPerBucket < (1 << kBitsPerSparseEntry));
+
+  static int ToBucketSlot(int cell_index, int bit_index) {
+    return (cell_index << kBitsPerCellLog2) | bit_index;
+  }
+
+  static bool IsSparseBucket(Bucket bucket) {
+    return (reinterpret_cast<uintptr_t>(bucket) & kSparseBucketTag) != 0;
+  }
+
+  static Bucket ToSparseBucket(Bucket bucket) {
+    DCHECK(IsSparseBucket(bucket));
+    return reinterpret_cast<Bucket>(reinterpret_cast<uintptr_t>(bucket) &
+                                    ~kSparseBucketTag);
+  }
+
+  static Bucket FromSparseBucket(Bucket sparse) {
+    DCHECK_EQ(0, reinterpret_cast<uintptr_t>(sparse) & kSparseBucketTag);
+    return reinterpret_cast<Bucket>(reinterpret_cast<uintptr_t>(sparse) |
+                                    kSparseBucketTag);
+  }
+
+  // An entry holds the in-bucket slot index plus one, or zero if it is free.
+  static uint32_t ToSparseEntry(int bucket_slot) { return bucket_slot + 1; }
+
+  static int SparseEntryShift(int index) {
+    return (index & 1) * kBitsPerSparseEntry;
+  }
+
+  static uint32_t LoadSparseEntry(Bucket sparse, int index) {
+    uint32_t cell = base::AsAtomic32::Acquire_Load(&sparse[index >> 1]);
+    return (cell >> SparseEntryShift(index)) & kSparseEntryMask;
+  }
+
+  static void ClearSparseEntry(Bucket sparse, int index) {
+    base::AsAtomic32::SetBits(&sparse[index >> 1], 0u,
+                              kSparseEntryMask << SparseEntryShift(index));
+  }
+
+  // Stores the entry into the free entry at |index|. Returns false if the
+  // entry is already taken.
+  static bool TryClaimSparseEntry(Bucket sparse, int index, uint32_t entry) {
+    uint32_t* cell = &sparse[index >> 1];
+    const int shift = SparseEntryShift(index);
+    uint32_t old_cell = base::AsAtomic32::Acquire_Load(cell);
+    while (((old_cell >> shift) & kSparseEntryMask) == 0) {
+      uint32_t new_cell = old_cell | (entry << shift);
+      uint32_t actual =
+          base::AsAtomic32::Release_CompareAndSwap(cell, old_cell, new_cell);
+      if (actual == old_cell) return true;
+      old_cell = actual;
+    }
+    return false;
+  }
+
+  static bool SparseBucketContains(Bucket sparse, int bucket_slot) {
+    const uint32_t entry = ToSparseEntry(bucket_slot);
+    for (int i = 0; i < kSparseBucketCapacity; i++) {
+      if (LoadSparseEntry(sparse, i) == entry) return true;
+    }
+    return false;
+  }
+
+  static void RemoveFromSparseBucket(Bucket sparse, int bucket_slot) {
+    const uint32_t entry = ToSparseEntry(bucket_slot);
+    for (int i = 0; i < kSparseBucketCapacity; i++) {
+      if (LoadSparseEntry(sparse, i) == entry) ClearSparseEntry(sparse, i);
+    }
+  }
+
+  static bool IsEmptySparseBucket(Bucket sparse) {
+    for (int i = 0; i < kSparseBucketCells; i++) {
+      if (base::AsAtomic32::Acquire_Load(&sparse[i])) return false;
+    }
+    return true;
+  }
+
+  Bucket AllocateSparseBucket() {
+    Bucket result = NewArray<uint32_t>(kSparseBucketCells);
+    for (int i = 0; i < kSparseBucketCells; i++) {
+      result[i] = 0;
+    }
+    return result;
+  }
+
+  // Inserts the slot into the sparse bucket at bucket_index, allocating the
+  // bucket if needed. Returns false if the bucket is (or has just been
+  // upgraded to) a bitmap bucket, in which case the caller has to set the
+  // bit itself.
+  template <AccessMode access_mode>
+  bool InsertIntoSparseBucket(int bucket_index, int bucket_slot) {
+    Bucket bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
+    if (bucket == nullptr) {
+      Bucket sparse = AllocateSparseBucket();
+      if (!SwapInNewBucket<access_mode>(&buckets_[bucket_index], nullptr,
+                                        FromSparseBucket(sparse))) {
+        DeleteArray<uint32_t>(sparse);
+      }
+      bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
+    }
+    if (!IsSparseBucket(bucket)) return false;
+    Bucket sparse = ToSparseBucket(bucket);
+    const uint32_t entry = ToSparseEntry(bucket_slot);
+    if (SparseBucketContains(sparse, bucket_slot)) return true;
+    for (int i = 0; i < kSparseBucketCapacity; i++) {
+      if (!TryClaimSparseEntry(sparse, i, entry)) continue;
+      // Concurrent inserts of the same slot may claim several entries. Only
+      // the one with the lowest index is kept.
+      for (int j = 0; j < i; j++) {
+        if (LoadSparseEntry(sparse, j) == entry) {
+          ClearSparseEntry(sparse, i);
+          break;
+        }
+      }
+      // An upgrade that raced with this insert may have copied the entries
+      // before this one was claimed.
+      return LoadBucket<access_mode>(&buckets_[bucket_index]) == bucket;
+    }
+    UpgradeSparseBucket<access_mode>(bucket_index, bucket);
+    return false;
+  }
+
+  // Replaces the full sparse bucket at bucket_index with a bitmap bucket. The
+  // bitmap is installed before the entries are copied, so that an entry
+  // claimed concurrently is either copied or also set in the bitmap by its
+  // inserter.
+  template <AccessMode access_mode>
+  void UpgradeSparseBucket(int bucket_index, Bucket bucket) {
+    Bucket bitmap = AllocateBucket();
+    if (!SwapInNewBucket<access_mode>(&buckets_[bucket_index], bucket,
+                                      bitmap)) {
+      // Another thread upgraded the bucket.
+      DeleteArray<uint32_t>(bitmap);
+      return;
+    }
+    Bucket sparse = ToSparseBucket(bucket);
+    for (int i = 0; i < kSparseBucketCapacity; i++) {
+      uint32_t entry = LoadSparseEntry(sparse, i);
+      if (entry == 0) continue;
+      int slot = entry - 1;
+      SetCellBits<access_mode>(&bitmap[slot >> kBitsPerCellLog2],
+                               1u << (slot & (kBitsPerCell - 1)));
+    }
+    // Concurrent readers may still access the sparse bucket, so it is freed
+    // together with the pre-freed buckets.
+    base::MutexGuard guard(&to_be_freed_buckets_mutex_);
+    upgraded_sparse_buckets_.push(sparse);
+  }
+
+  // Removes the slots in [start_slot, end_slot) from all sparse buckets
+  // overlapping that range.
+  void RemoveRangeFromSparseBuckets(int start_slot, int end_slot) {
+    int start_bucket = start_slot >> kBitsPerBucketLog2;
+    int end_bucket = Min(end_slot >> kBitsPerBucketLog2, kBuckets - 1);
+    for (int bucket_index = start_bucket; bucket_index <= end_bucket;
+         bucket_index++) {
+      Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+      if (!IsSparseBucket(bucket)) continue;
+      Bucket sparse = ToSparseBucket(bucket);
+      int bucket_start = bucket_index << kBitsPerBucketLog2;
+      for (int i = 0; i < kSparseBucketCapacity; i++) {
+        uint32_t entry = LoadSparseEntry(sparse, i);
+        if (entry == 0) continue;
+        int slot = bucket_start + static_cast<int>(entry) - 1;
+        if (slot >= start_slot && slot < end_slot) {
+          ClearSparseEntry(sparse, i);
+        }
+      }
+    }
+  }
+
+  // Must not be called concurrently with any other operation on the bucket.
+  void ReleaseSparseBucket(int bucket_index, bool only_if_empty) {
+    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    if (!IsSparseBucket(bucket)) return;
+    Bucket sparse = ToSparseBucket(bucket);
+    if (only_if_empty && !IsEmptySparseBucket(sparse)) return;
+    StoreBucket(&buckets_[bucket_index], nullptr);
+    DeleteArray<uint32_t>(sparse);
+  }
+
+  // Returns the bitmap bucket at bucket_index or nullptr if the bucket is
+  // not allocated or sparse.
+  Bucket LoadBitmapBucket(int bucket_index) {
+    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    return IsSparseBucket(bucket) ? nullptr : bucket;
+  }
+
+  template <typename Callback>
+  int IterateSparseBucket(int bucket_index, Callback callback) {
+    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    if (bucket == nullptr) return 0;
+    if (!IsSparseBucket(bucket)) {
+      // The bucket was upgraded concurrently.
+      return IterateBitmapBucket(bucket, bucket_index, callback);
+    }
+    // The callback may insert slots into this set, so it is invoked on a
+    // sorted copy of the bucket without duplicates.
+    Bucket sparse = ToSparseBucket(bucket);
+    int slots[kSparseBucketCapacity];
+    int length = 0;
+    for (int i = 0; i < kSparseBucketCapacity; i++) {
+      uint32_t entry = LoadSparseEntry(sparse, i);
+      if (entry == 0) continue;
+      int slot = static_cast<int>(entry) - 1;
+      int index = length;
+      while (index > 0 && slots[index - 1] > slot) {
+        slots[index] = slots[index - 1];
+        index--;
+      }
+      if (index > 0 && slots[index - 1] == slot) {
+        // Drop the duplicate and undo the shift.
+        for (int j = index; j < length; j++) slots[j] = slots[j + 1];
+        continue;
+      }
+      slots[index] = slot;
+      length++;
+    }
+    int in_bucket_count = 0;
+    int bucket_offset = bucket_index * kBitsPerBucket;
+    for (int i = 0; i < length; i++) {
+      uint32_t slot = (bucket_offset + slots[i]) << kPointerSizeLog2;
+      if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
+        ++in_bucket_count;
+      } else {
+        Remove(slot);
+      }
+    }
+    return in_bucket_count;
+  }
+
+  template <typename Callback>
+  int IterateBitmapBucket(Bucket bucket, int bucket_index, Callback callback) {
+    int in_bucket_count = 0;
+    int cell_offset = bucket_index * kBitsPerBucket;
+    for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
+      uint32_t cell = LoadCell(&bucket[i]);
+      if (cell) {
+        uint32_t old_cell = cell;
+        uint32_t mask = 0;
+        while (cell) {
+          int bit_offset = base::bits::CountTrailingZeros(cell);
+          uint32_t bit_mask = 1u << bit_offset;
+          uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
+          if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
+            ++in_bucket_count;
+          } else {
+            mask |= bit_mask;
+          }
+          cell ^= bit_mask;
+        }
+        uint32_t new_cell = old_cell & ~mask;
+        if (old_cell != new_cell) {
+          ClearCellBits(&bucket[i], mask);
+        }
+      }
+    }
+    return in_bucket_count;
+  }
+
   Bucket AllocateBucket() {
     Bucket result = NewArray<uint32_t>(kCellsPerBucket);
     for (int i = 0; i < kCellsPerBucket; i++) {
@@ -291,17 +559,23 @@ class SlotSet : public Malloced {
     }
   }
 
+  // Sparse buckets are pre-freed like bitmap buckets, as concurrent threads
+  // may still read or clear their entries.
   void PreFreeEmptyBucket(int bucket_index) {
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-    if (bucket != nullptr) {
-      base::MutexGuard guard(&to_be_freed_buckets_mutex_);
-      to_be_freed_buckets_.push(bucket);
-      StoreBucket(&buckets_[bucket_index], nullptr);
-    }
+    if (bucket == nullptr) return;
+    base::MutexGuard guard(&to_be_freed_buckets_mutex_);
+    to_be_freed_buckets_.push(IsSparseBucket(bucket) ? ToSparseBucket(bucket)
+                                                     : bucket);
+    StoreBucket(&buckets_[bucket_index], nullptr);
   }
 
   void ReleaseBucket(int bucket_index) {
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    if (IsSparseBucket(bucket)) {
+      ReleaseSparseBucket(bucket_index, false);
+      return;
+    }
     StoreBucket(&buckets_[bucket_index], nullptr);
     DeleteArray<uint32_t>(bucket);
   }
@@ -313,6 +587,18 @@ class SlotSet : public Malloced {
     return *bucket;
   }
 
+  template <AccessMode access_mode = AccessMode::ATOMIC>
+  bool SwapInNewBucket(Bucket* bucket, Bucket expected, Bucket value) {
+    if (access_mode == AccessMode::ATOMIC) {
+      return base::AsAtomicPointer::Release_CompareAndSwap(bucket, expected,
+                                                           value) == expected;
+    } else {
+      DCHECK_EQ(expected, *bucket);
+      *bucket = value;
+      return true;
+    }
+  }
+
   template <AccessMode access_mode = AccessMode::ATOMIC>
   void StoreBucket(Bucket* bucket, Bucket value) {
     if (access_mode == AccessMode::ATOMIC) {
@@ -331,18 +617,6 @@ class SlotSet : public Malloced {
     return true;
   }
 
-  template <AccessMode access_mode = AccessMode::ATOMIC>
-  bool SwapInNewBucket(Bucket* bucket, Bucket value) {
-    if (access_mode == AccessMode::ATOMIC) {
-      return base::AsAtomicPointer::Release_CompareAndSwap(bucket, nullptr,
-                                                           value) == nullptr;
-    } else {
-      DCHECK_NULL(*bucket);
-      *bucket = value;
-      return true;
-    }
-  }
-
   template <AccessMode access_mode = AccessMode::ATOMIC>
   uint32_t LoadCell(uint32_t* cell) {
     if (access_mode == AccessMode::ATOMIC)
@@ -382,6 +656,9 @@ class SlotSet : public Malloced {
   Address page_start_;
   base::Mutex to_be_freed_buckets_mutex_;
   std::stack<uint32_t*> to_be_freed_buckets_;
+  // Sparse buckets replaced by bitmap buckets. Guarded by
+  // to_be_freed_buckets_mutex_.
+  std::stack<uint32_t*> upgraded_sparse_buckets_;
 };
 
 enum SlotType {
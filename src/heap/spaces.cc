@@ -200,6 +200,15 @@ void MemoryAllocator::InitializeCodePageAllocator(
                 MemoryChunk::kPageSize);
   DCHECK(IsAligned(aligned_base, kMinExpectedOSPageSize));
 
+  // Large amounts of JIT code suffer from iTLB misses. Transparent huge
+  // pages only apply to the parts of the range that end up committed.
+  if (FLAG_huge_pages_for_code_range &&
+      !base::OS::AdviseHugePages(reinterpret_cast<void*>(aligned_base),
+                                 size) &&
+      FLAG_trace_gc_verbose) {
+    isolate_->PrintWithTimestamp("CodeRange: huge pages not available\n");
+  }
+
   LOG(isolate_,
       NewEvent("CodeRange", reinterpret_cast<void*>(reservation.address()),
                requested));
@@ -261,6 +270,15 @@ class MemoryAllocator::Unmapper::UnmapFreeMemoryTask : public CancelableTask {
 };
 
 void MemoryAllocator::Unmapper::FreeQueuedChunks() {
+  // Decide on the main thread whether freed large chunks may be pooled. The
+  // unmapper tasks must not read the heap state themselves.
+  const bool reduce_memory =
+      heap_->IsTearingDown() || heap_->ShouldReduceMemory();
+  {
+    base::MutexGuard guard(&mutex_);
+    pool_large_chunks_ = !reduce_memory;
+  }
+  if (reduce_memory) ReleasePooledLargeChunks();
   if (!heap_->IsTearingDown() && FLAG_concurrent_sweeping) {
     if (!MakeRoomForNewTasks()) {
       // kMaxUnmapperTasks are already running. Avoid creating any more.
@@ -314,6 +332,7 @@ void MemoryAllocator::Unmapper::PrepareForMarkCompact() {
 void MemoryAllocator::Unmapper::EnsureUnmappingCompleted() {
   CancelAndWaitForPendingTasks();
   PerformFreeMemoryOnQueuedChunks<FreeMode::kReleasePooled>();
+  ReleasePooledLargeChunks();
 }
 
 bool MemoryAllocator::Unmapper::MakeRoomForNewTasks() {
@@ -330,10 +349,71 @@ bool MemoryAllocator::Unmapper::MakeRoomForNewTasks() {
 void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedNonRegularChunks() {
   MemoryChunk* chunk = nullptr;
   while ((chunk = GetMemoryChunkSafe<kNonRegular>()) != nullptr) {
+    if (heap_->IsLargeMemoryChunk(chunk) &&
+        chunk->executable() != EXECUTABLE) {
+      // Pooled chunks keep their memory committed but must not hold on to
+      // any side data.
+      chunk->ReleaseAllocatedMemory();
+      if (AddLargeChunkToPoolSafe(chunk)) continue;
+    }
     allocator_->PerformFreeMemory(chunk);
   }
 }
 
+int MemoryAllocator::Unmapper::LargeChunkSizeClass(size_t chunk_size) {
+  DCHECK_GT(chunk_size, 0);
+  const int log2 =
+      63 - static_cast<int>(base::bits::CountLeadingZeros64(chunk_size));
+  const int size_class = Max(0, log2 - kMinLargeChunkSizeClassLog2);
+  return size_class < kNumberOfLargeChunkSizeClasses ? size_class : -1;
+}
+
+bool MemoryAllocator::Unmapper::AddLargeChunkToPoolSafe(MemoryChunk* chunk) {
+  DCHECK(chunk->IsFlagSet(MemoryChunk::PRE_FREED));
+  VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved()) return false;
+  const size_t chunk_size = reservation->size();
+  const int size_class = LargeChunkSizeClass(chunk_size);
+  if (size_class < 0) return false;
+  base::MutexGuard guard(&mutex_);
+  if (!pool_large_chunks_ ||
+      pooled_large_chunk_bytes_ + chunk_size > FLAG_large_page_pool_size * MB) {
+    return false;
+  }
+  large_chunks_[size_class].push_back(chunk);
+  pooled_large_chunk_bytes_ += chunk_size;
+  return true;
+}
+
+MemoryChunk* MemoryAllocator::Unmapper::TryGetPooledLargeMemoryChunkSafe(
+    size_t chunk_size) {
+  const int size_class = LargeChunkSizeClass(chunk_size);
+  if (size_class < 0) return nullptr;
+  base::MutexGuard guard(&mutex_);
+  std::vector<MemoryChunk*>& chunks = large_chunks_[size_class];
+  for (size_t i = 0; i < chunks.size(); i++) {
+    MemoryChunk* chunk = chunks[i];
+    const size_t pooled_size = chunk->reserved_memory()->size();
+    if (pooled_size < chunk_size) continue;
+    chunks[i] = chunks.back();
+    chunks.pop_back();
+    pooled_large_chunk_bytes_ -= pooled_size;
+    return chunk;
+  }
+  return nullptr;
+}
+
+void MemoryAllocator::Unmapper::ReleasePooledLargeChunks() {
+  base::MutexGuard guard(&mutex_);
+  for (int i = 0; i < kNumberOfLargeChunkSizeClasses; i++) {
+    for (MemoryChunk* chunk : large_chunks_[i]) {
+      chunk->reserved_memory()->Free();
+    }
+    large_chunks_[i].clear();
+  }
+  pooled_large_chunk_bytes_ = 0;
+}
+
 template <MemoryAllocator::Unmapper::FreeMode mode>
 void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   MemoryChunk* chunk = nullptr;
@@ -363,6 +443,7 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
 void MemoryAllocator::Unmapper::TearDown() {
   CHECK_EQ(0, pending_unmapping_tasks_);
   PerformFreeMemoryOnQueuedChunks<FreeMode::kReleasePooled>();
+  ReleasePooledLargeChunks();
   for (int i = 0; i < kNumberOfChunkQueues; i++) {
     DCHECK(chunks_[i].empty());
   }
@@ -394,9 +475,16 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   for (auto& chunk : chunks_[kNonRegular]) {
     sum += chunk->size();
   }
+  // Pooled large chunks stay committed.
+  sum += pooled_large_chunk_bytes_;
   return sum;
 }
 
+size_t MemoryAllocator::Unmapper::PooledLargeChunkMemoryForTesting() {
+  base::MutexGuard guard(&mutex_);
+  return pooled_large_chunk_bytes_;
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
   Address base = reservation->address();
   size_t size = reservation->size();
@@ -1156,11 +1244,44 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
 LargePage* MemoryAllocator::AllocateLargePage(size_t size,
                                               LargeObjectSpace* owner,
                                               Executability executable) {
-  MemoryChunk* chunk = AllocateChunk(size, size, executable, owner);
+  MemoryChunk* chunk = nullptr;
+  if (executable == NOT_EXECUTABLE) {
+    chunk = AllocateLargePagePooled(size, owner);
+  }
+  if (chunk == nullptr) {
+    chunk = AllocateChunk(size, size, executable, owner);
+  }
   if (chunk == nullptr) return nullptr;
   return LargePage::Initialize(isolate_->heap(), chunk, executable);
 }
 
+MemoryChunk* MemoryAllocator::AllocateLargePagePooled(size_t object_size,
+                                                      Space* owner) {
+  const size_t chunk_size = ::RoundUp(
+      MemoryChunkLayout::ObjectStartOffsetInDataPage() + object_size,
+      GetCommitPageSize());
+  MemoryChunk* chunk =
+      unmapper()->TryGetPooledLargeMemoryChunkSafe(chunk_size);
+  if (chunk == nullptr) return nullptr;
+  // The reservation of a pooled chunk is still fully committed.
+  VirtualMemory reservation;
+  reservation.TakeControl(chunk->reserved_memory());
+  const Address start = reservation.address();
+  const size_t size = reservation.size();
+  const Address area_start =
+      start + MemoryChunkLayout::ObjectStartOffsetInDataPage();
+  const Address area_end = area_start + object_size;
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(start, area_end - start, kZapValue);
+  }
+  size_ += size;
+  isolate_->counters()->memory_allocated()->Increment(static_cast<int>(size));
+  LOG(isolate_, NewEvent("MemoryChunk", reinterpret_cast<void*>(start), size));
+  return MemoryChunk::Initialize(isolate_->heap(), start, size, area_start,
+                                 area_end, NOT_EXECUTABLE, owner,
+                                 std::move(reservation));
+}
+
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
@@ -3722,11 +3843,19 @@ void Page::Print() {
 
 #endif  // DEBUG
 
-NewLargeObjectSpace::NewLargeObjectSpace(Heap* heap)
-    : LargeObjectSpace(heap, NEW_LO_SPACE) {}
+NewLargeObjectSpace::NewLargeObjectSpace(Heap* heap, size_t capacity)
+    : LargeObjectSpace(heap, NEW_LO_SPACE), capacity_(capacity) {}
 
 AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
-  // TODO(hpayer): Add heap growing strategy here.
+  // Do not allocate more objects if promoting the existing objects would
+  // exceed the old generation capacity.
+  if (!heap()->CanExpandOldGeneration(SizeOfObjects())) {
+    return AllocationResult::Retry(identity());
+  }
+  // Allocation for the first object must succeed independent of the capacity.
+  if (SizeOfObjects() > 0 && static_cast<size_t>(object_size) > Available()) {
+    return AllocationResult::Retry(identity());
+  }
   LargePage* page = AllocateLargePage(object_size, NOT_EXECUTABLE);
   if (page == nullptr) return AllocationResult::Retry(identity());
   page->SetYoungGenerationPageFlags(heap()->incremental_marking()->IsMarking());
@@ -3736,8 +3865,8 @@ AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
 }
 
 size_t NewLargeObjectSpace::Available() {
-  // TODO(hpayer): Update as soon as we have a growing strategy.
-  return 0;
+  size_t size = SizeOfObjects();
+  return capacity_ > size ? capacity_ - size : 0;
 }
 
 void NewLargeObjectSpace::Flip() {
@@ -1202,6 +1202,12 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       return chunk;
     }
 
+    // Returns a committed large chunk of at least |chunk_size| bytes that
+    // was freed before, or nullptr if no such chunk is available. Large
+    // chunks are grouped by size class so that reusing a chunk wastes at
+    // most half of its size.
+    MemoryChunk* TryGetPooledLargeMemoryChunkSafe(size_t chunk_size);
+
     V8_EXPORT_PRIVATE void FreeQueuedChunks();
     void CancelAndWaitForPendingTasks();
     void PrepareForMarkCompact();
@@ -1210,10 +1216,15 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
     size_t NumberOfCommittedChunks();
     int NumberOfChunks();
     size_t CommittedBufferedMemory();
+    size_t PooledLargeChunkMemoryForTesting();
 
    private:
     static const int kReservedQueueingSlots = 64;
     static const int kMaxUnmapperTasks = 4;
+    // Size classes for pooled large chunks are powers of two starting at
+    // 256KB. Larger chunks than the last class are never pooled.
+    static const int kMinLargeChunkSizeClassLog2 = 18;
+    static const int kNumberOfLargeChunkSizeClasses = 8;
 
     enum ChunkQueueType {
       kRegular,     // Pages of kPageSize that do not live in a CodeRange and
@@ -1243,6 +1254,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       return chunk;
     }
 
+    // Returns the size class of a large chunk or -1 if chunks of this size
+    // are not pooled.
+    static int LargeChunkSizeClass(size_t chunk_size);
+
     bool MakeRoomForNewTasks();
 
     template <FreeMode mode>
@@ -1250,10 +1265,21 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
 
     void PerformFreeMemoryOnQueuedNonRegularChunks();
 
+    // Adds a pre-freed large data chunk to the pool if the pool has room for
+    // it. Returns false if the chunk needs to be freed instead.
+    bool AddLargeChunkToPoolSafe(MemoryChunk* chunk);
+
+    void ReleasePooledLargeChunks();
+
     Heap* const heap_;
     MemoryAllocator* const allocator_;
     base::Mutex mutex_;
     std::vector<MemoryChunk*> chunks_[kNumberOfChunkQueues];
+    std::vector<MemoryChunk*> large_chunks_[kNumberOfLargeChunkSizeClasses];
+    size_t pooled_large_chunk_bytes_ = 0;
+    // Set by FreeQueuedChunks() on the main thread. False while the heap
+    // reduces memory or tears down. Guarded by |mutex_|.
+    bool pool_large_chunks_ = true;
     CancelableTaskManager::Id task_ids_[kMaxUnmapperTasks];
     base::Semaphore pending_unmapping_tasks_semaphore_;
     intptr_t pending_unmapping_tasks_;
@@ -1407,6 +1433,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   template <typename SpaceType>
   MemoryChunk* AllocatePagePooled(SpaceType* owner);
 
+  // Tries to reuse a previously freed NOT_EXECUTABLE large chunk for an
+  // object of |object_size| bytes.
+  MemoryChunk* AllocateLargePagePooled(size_t object_size, Space* owner);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -3058,7 +3088,7 @@ class LargeObjectSpace : public Space {
 
 class NewLargeObjectSpace : public LargeObjectSpace {
  public:
-  explicit NewLargeObjectSpace(Heap* heap);
+  NewLargeObjectSpace(Heap* heap, size_t capacity);
 
   V8_WARN_UNUSED_RESULT AllocationResult AllocateRaw(int object_size);
 
@@ -3068,6 +3098,11 @@ class NewLargeObjectSpace : public LargeObjectSpace {
   void Flip();
 
   void FreeAllObjects();
+
+ private:
+  // Young large objects are limited to what a fully grown semi-space could
+  // hold. Exceeding this capacity triggers a scavenge.
+  const size_t capacity_;
 };
 
 class CodeLargeObjectSpace : public LargeObjectSpace {
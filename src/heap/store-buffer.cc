@@ -20,11 +20,17 @@ namespace v8 {
 namespace internal {
 
 StoreBuffer::StoreBuffer(Heap* heap)
-    : heap_(heap), top_(nullptr), current_(0), mode_(NOT_IN_GC) {
+    : heap_(heap),
+      top_(nullptr),
+      current_(0),
+      overflows_(0),
+      blocking_overflows_(0),
+      mode_(NOT_IN_GC) {
   for (int i = 0; i < kStoreBuffers; i++) {
     start_[i] = nullptr;
     limit_[i] = nullptr;
     lazy_top_[i] = nullptr;
+    processing_[i] = false;
   }
   task_running_ = false;
   insertion_callback = &InsertDuringRuntime;
@@ -43,6 +49,7 @@ void StoreBuffer::SetUp() {
   // Allocate buffer memory aligned at least to kStoreBufferSize. This lets us
   // use a bit test to detect the ends of the buffers.
   STATIC_ASSERT(base::bits::IsPowerOfTwo(kStoreBufferSize));
+  STATIC_ASSERT(kStoreBuffers <= 4);
   const size_t alignment =
       std::max<size_t>(kStoreBufferSize, page_allocator->AllocatePageSize());
   void* hint = AlignedAddress(heap_->GetRandomMmapAddr(), alignment);
@@ -54,10 +61,10 @@ void StoreBuffer::SetUp() {
   Address start = reservation.address();
   const size_t allocated_size = reservation.size();
 
-  start_[0] = reinterpret_cast<Address*>(start);
-  limit_[0] = start_[0] + (kStoreBufferSize / kPointerSize);
-  start_[1] = limit_[0];
-  limit_[1] = start_[1] + (kStoreBufferSize / kPointerSize);
+  for (int i = 0; i < kStoreBuffers; i++) {
+    start_[i] = i == 0 ? reinterpret_cast<Address*>(start) : limit_[i - 1];
+    limit_[i] = start_[i] + (kStoreBufferSize / kPointerSize);
+  }
 
   // Sanity check the buffers.
   Address* vm_limit = reinterpret_cast<Address*>(start + allocated_size);
@@ -142,10 +149,16 @@ int StoreBuffer::StoreBufferOverflow(Isolate* isolate) {
 
 void StoreBuffer::FlipStoreBuffers() {
   base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
-  MoveEntriesToRememberedSet(other);
+  int next = (current_ + 1) % kStoreBuffers;
+  WaitForConcurrentProcessing(next);
+  overflows_++;
+  if (lazy_top_[next]) {
+    blocking_overflows_++;
+    heap_->isolate()->counters()->store_buffer_stalls()->Increment();
+    MoveEntriesToRememberedSet(next);
+  }
   lazy_top_[current_] = top_;
-  current_ = other;
+  current_ = next;
   top_ = start_[current_];
 
   if (!task_running_ && FLAG_concurrent_store_buffer) {
@@ -155,8 +168,15 @@ void StoreBuffer::FlipStoreBuffers() {
   }
 }
 
+void StoreBuffer::WaitForConcurrentProcessing(int index) {
+  while (processing_[index]) {
+    processing_done_.Wait(&mutex_);
+  }
+}
+
 void StoreBuffer::MoveEntriesToRememberedSet(int index) {
-  if (!lazy_top_[index]) return;
+  Address* lazy_top = lazy_top_[index].load();
+  if (!lazy_top) return;
   DCHECK_GE(index, 0);
   DCHECK_LT(index, kStoreBuffers);
   Address last_inserted_addr = kNullAddress;
@@ -164,8 +184,7 @@ void StoreBuffer::MoveEntriesToRememberedSet(int index) {
   // We are taking the chunk map mutex here because the page lookup of addr
   // below may require us to check if addr is part of a large page.
   base::MutexGuard guard(heap_->lo_space()->chunk_map_mutex());
-  for (Address* current = start_[index]; current < lazy_top_[index];
-       current++) {
+  for (Address* current = start_[index]; current < lazy_top; current++) {
     Address addr = *current;
     MemoryChunk* chunk = MemoryChunk::FromAnyPointerAddress(heap_, addr);
     if (IsDeletionAddress(addr)) {
@@ -193,8 +212,12 @@ void StoreBuffer::MoveEntriesToRememberedSet(int index) {
 
 void StoreBuffer::MoveAllEntriesToRememberedSet() {
   base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
-  MoveEntriesToRememberedSet(other);
+  // Process the buffers from oldest to newest.
+  for (int i = 1; i < kStoreBuffers; i++) {
+    int index = (current_ + i) % kStoreBuffers;
+    WaitForConcurrentProcessing(index);
+    MoveEntriesToRememberedSet(index);
+  }
   lazy_top_[current_] = top_;
   MoveEntriesToRememberedSet(current_);
   top_ = start_[current_];
@@ -202,8 +225,26 @@ void StoreBuffer::MoveAllEntriesToRememberedSet() {
 
 void StoreBuffer::ConcurrentlyProcessStoreBuffer() {
   base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
-  MoveEntriesToRememberedSet(other);
+  while (true) {
+    // Claim the oldest buffer that still needs processing. All older buffers
+    // have been processed already, so its entries can be moved without
+    // holding the mutex.
+    int index = -1;
+    for (int i = 1; i < kStoreBuffers; i++) {
+      int candidate = (current_ + i) % kStoreBuffers;
+      if (lazy_top_[candidate]) {
+        index = candidate;
+        break;
+      }
+    }
+    if (index == -1) break;
+    processing_[index] = true;
+    mutex_.Unlock();
+    MoveEntriesToRememberedSet(index);
+    mutex_.Lock();
+    processing_[index] = false;
+    processing_done_.NotifyAll();
+  }
   task_running_ = false;
 }
 
@@ -5,8 +5,11 @@
 #ifndef V8_HEAP_STORE_BUFFER_H_
 #define V8_HEAP_STORE_BUFFER_H_
 
+#include <atomic>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/platform.h"
 #include "src/cancelable-task.h"
 #include "src/globals.h"
@@ -27,9 +30,11 @@ class StoreBuffer {
  public:
   enum StoreBufferMode { IN_GC, NOT_IN_GC };
 
-  static const int kStoreBuffers = 2;
+  static const int kStoreBuffers = 3;
+  // The size of each buffer has to be a power of two, so the page is split
+  // into the next power of two greater than or equal to kStoreBuffers parts.
   static const int kStoreBufferSize =
-      Max(static_cast<int>(kMinExpectedOSPageSize / kStoreBuffers),
+      Max(static_cast<int>(kMinExpectedOSPageSize / 4),
           1 << (11 + kPointerSizeLog2));
   static const int kStoreBufferMask = kStoreBufferSize - 1;
   static const intptr_t kDeletionTag = 1;
@@ -52,8 +57,8 @@ class StoreBuffer {
   // Used to add entries from generated code.
   inline Address* top_address() { return reinterpret_cast<Address*>(&top_); }
 
-  // Moves entries from a specific store buffer to the remembered set. This
-  // method takes a lock.
+  // Moves entries from a specific store buffer to the remembered set. The
+  // caller either holds mutex_ or has claimed the buffer via processing_.
   void MoveEntriesToRememberedSet(int index);
 
   // This method ensures that all used store buffer entries are transferred to
@@ -98,6 +103,12 @@ class StoreBuffer {
   // store buffer to the remembered set.
   void ConcurrentlyProcessStoreBuffer();
 
+  // Number of overflows since SetUp and the number of those overflows where
+  // the main thread had to move entries to the remembered set itself because
+  // the concurrent task had not caught up.
+  int overflows() const { return overflows_; }
+  int blocking_overflows() const { return blocking_overflows_; }
+
   bool Empty() {
     for (int i = 0; i < kStoreBuffers; i++) {
       if (lazy_top_[i]) {
@@ -110,13 +121,15 @@ class StoreBuffer {
   Heap* heap() { return heap_; }
 
  private:
-  // There are two store buffers. If one store buffer fills up, the main thread
-  // publishes the top pointer of the store buffer that needs processing in its
-  // global lazy_top_ field. After that it start the concurrent processing
-  // thread. The concurrent processing thread uses the pointer in lazy_top_.
-  // It will grab the given mutex and transfer its entries to the remembered
-  // set. If the concurrent thread does not make progress, the main thread will
-  // perform the work.
+  // The store buffers are used as a ring. If one store buffer fills up, the
+  // main thread publishes the top pointer of the store buffer that needs
+  // processing in its global lazy_top_ field, moves on to the next buffer and
+  // starts the concurrent processing thread. The concurrent processing thread
+  // claims the oldest buffer with a set lazy_top_ under the mutex and
+  // transfers its entries to the remembered set without holding the mutex, so
+  // the main thread only blocks if it wraps around to a buffer that is still
+  // being processed. If the concurrent thread does not make progress, the
+  // main thread will perform the work.
   // Important: there is an ordering constrained. The store buffer with the
   // older entries has to be processed first.
   class Task : public CancelableTask {
@@ -142,6 +155,10 @@ class StoreBuffer {
 
   void FlipStoreBuffers();
 
+  // Blocks until the concurrent task is done with the given buffer. Has to be
+  // called with mutex_ held.
+  void WaitForConcurrentProcessing(int index);
+
   Heap* heap_;
 
   Address* top_;
@@ -153,9 +170,13 @@ class StoreBuffer {
   Address* start_[kStoreBuffers];
   Address* limit_[kStoreBuffers];
 
-  // At most one lazy_top_ pointer is set at any time.
-  Address* lazy_top_[kStoreBuffers];
+  // Set for every full buffer whose entries were not yet moved to the
+  // remembered set. The concurrent task clears it without holding mutex_.
+  std::atomic<Address*> lazy_top_[kStoreBuffers];
+  // Set while the concurrent task processes a buffer without holding mutex_.
+  bool processing_[kStoreBuffers];
   base::Mutex mutex_;
+  base::ConditionVariable processing_done_;
 
   // We only want to have at most one concurrent processing tas running.
   bool task_running_;
@@ -163,6 +184,9 @@ class StoreBuffer {
   // Points to the current buffer in use.
   int current_;
 
+  int overflows_;
+  int blocking_overflows_;
+
   // During GC, entries are directly added to the remembered set without
   // going through the store buffer. This is signaled by a special
   // IN_GC mode.
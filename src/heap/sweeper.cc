@@ -88,6 +88,7 @@ class Sweeper::SweeperTask final : public CancelableTask {
         pending_sweeper_tasks_(pending_sweeper_tasks),
         num_sweeping_tasks_(num_sweeping_tasks),
         space_to_start_(space_to_start),
+        sweep_code_space_(!isolate->heap()->write_protect_code_memory()),
         tracer_(isolate->heap()->tracer()) {}
 
   ~SweeperTask() override = default;
@@ -102,8 +103,10 @@ class Sweeper::SweeperTask final : public CancelableTask {
       const AllocationSpace space_id = static_cast<AllocationSpace>(
           FIRST_GROWABLE_PAGED_SPACE +
           ((i + offset) % kNumberOfSweepingSpaces));
-      // Do not sweep code space concurrently.
-      if (space_id == CODE_SPACE) continue;
+      // Sweeping a write protected code page requires flipping it from rx
+      // to rw, which would break code running on the main thread. Such pages
+      // are swept incrementally on the main thread instead.
+      if (space_id == CODE_SPACE && !sweep_code_space_) continue;
       DCHECK(IsValidSweepingSpace(space_id));
       sweeper_->SweepSpaceFromTask(space_id);
     }
@@ -115,6 +118,7 @@ class Sweeper::SweeperTask final : public CancelableTask {
   base::Semaphore* const pending_sweeper_tasks_;
   std::atomic<intptr_t>* const num_sweeping_tasks_;
   AllocationSpace space_to_start_;
+  const bool sweep_code_space_;
   GCTracer* const tracer_;
 
   DISALLOW_COPY_AND_ASSIGN(SweeperTask);
@@ -22,8 +22,9 @@ namespace internal {
 // corresponding push segments. Full push segments are published to a global
 // pool of segments and replaced with empty segments.
 //
-// Work stealing is best effort, i.e., there is no way to inform other tasks
-// of the need of items.
+// Work stealing is cooperative: a task that runs out of work can request
+// work via RequestWork(). Busy tasks check for pending requests on Push and
+// share half of their private push segment through the global pool.
 template <typename EntryType, int SEGMENT_SIZE>
 class Worklist {
  public:
@@ -47,6 +48,9 @@ class Worklist {
 
     bool IsGlobalPoolEmpty() { return worklist_->IsGlobalPoolEmpty(); }
 
+    // Asks other tasks to share some of their local work.
+    void RequestWork() { worklist_->RequestWork(); }
+
     size_t LocalPushSegmentSize() {
       return worklist_->LocalPushSegmentSize(task_id_);
     }
@@ -56,7 +60,7 @@ class Worklist {
     int task_id_;
   };
 
-  static const int kMaxNumTasks = 8;
+  static const int kMaxNumTasks = 16;
   static const size_t kSegmentCapacity = SEGMENT_SIZE;
 
   Worklist() : Worklist(kMaxNumTasks) {}
@@ -96,6 +100,8 @@ class Worklist {
       bool success = private_push_segment(task_id)->Push(entry);
       USE(success);
       DCHECK(success);
+    } else if (V8_UNLIKELY(IsWorkRequested())) {
+      ShareWork(task_id);
     }
     return true;
   }
@@ -129,6 +135,17 @@ class Worklist {
 
   bool IsGlobalPoolEmpty() { return global_pool_.IsEmpty(); }
 
+  // Signals that some task ran out of work. The next task that pushes an
+  // entry while having more than one entry in its push segment publishes
+  // half of that segment to the global pool.
+  void RequestWork() {
+    base::AsAtomic32::Relaxed_Store(&work_requested_, 1);
+  }
+
+  bool IsWorkRequested() {
+    return base::AsAtomic32::Relaxed_Load(&work_requested_) != 0;
+  }
+
   bool IsEmpty() {
     if (!AreLocalsEmpty()) return false;
     return global_pool_.IsEmpty();
@@ -214,6 +231,7 @@ class Worklist {
   FRIEND_TEST(WorkListTest, SegmentEmptyPopFails);
   FRIEND_TEST(WorkListTest, SegmentUpdateFalse);
   FRIEND_TEST(WorkListTest, SegmentUpdate);
+  FRIEND_TEST(WorkListTest, SegmentSplit);
 
   class Segment {
    public:
@@ -233,6 +251,17 @@ class Worklist {
       return true;
     }
 
+    // Moves the upper half of the entries into |other|, which has to be
+    // empty.
+    void Split(Segment* other) {
+      DCHECK(other->IsEmpty());
+      size_t half = index_ / 2;
+      for (size_t i = half; i < index_; i++) {
+        other->entries_[other->index_++] = entries_[i];
+      }
+      index_ = half;
+    }
+
     size_t Size() const { return index_; }
     bool IsEmpty() const { return index_ == 0; }
     bool IsFull() const { return index_ == kCapacity; }
@@ -400,6 +429,17 @@ class Worklist {
     }
   }
 
+  void ShareWork(int task_id) {
+    Segment* segment = private_push_segment(task_id);
+    if (segment->Size() < 2) return;
+    // Multiple tasks may race on resetting the flag. This is fine as sharing
+    // is best effort and only costs an additional segment.
+    base::AsAtomic32::Relaxed_Store(&work_requested_, 0);
+    Segment* shared = NewSegment();
+    segment->Split(shared);
+    global_pool_.Push(shared);
+  }
+
   V8_INLINE bool StealPopSegmentFromGlobal(int task_id) {
     if (global_pool_.IsEmpty()) return false;
     Segment* new_segment = nullptr;
@@ -419,6 +459,7 @@ class Worklist {
   PrivateSegmentHolder private_segments_[kMaxNumTasks];
   GlobalPool global_pool_;
   int num_tasks_;
+  int32_t work_requested_ = 0;
 };
 
 }  // namespace internal
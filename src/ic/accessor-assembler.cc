@@ -2267,7 +2267,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
+Node* AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                Node* name, Node* map) {
   // See v8::internal::StubCache::PrimaryOffset().
   STATIC_ASSERT(StubCache::kCacheIndexShift == Name::kHashShift);
   // Compute the hash of the name (use entire hash field).
@@ -2283,21 +2284,24 @@ Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
   Node* map32 = TruncateIntPtrToInt32(BitcastTaggedToWord(map));
   // Base the offset on a simple combination of name and map.
   Node* hash = Int32Add(hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference::Create(
+                        stub_cache->mask_reference(StubCache::kPrimary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
-Node* AccessorAssembler::StubCacheSecondaryOffset(Node* name, Node* seed) {
+Node* AccessorAssembler::StubCacheSecondaryOffset(StubCache* stub_cache,
+                                                  Node* name, Node* seed) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
   Node* name32 = TruncateIntPtrToInt32(BitcastTaggedToWord(name));
   Node* hash = Int32Sub(TruncateIntPtrToInt32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference::Create(
+                        stub_cache->mask_reference(StubCache::kSecondary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
 void AccessorAssembler::TryProbeStubCacheTable(
@@ -2359,14 +2363,15 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache, Node* receiver,
   Node* receiver_map = LoadMap(receiver);
 
   // Probe the primary table.
-  Node* primary_offset = StubCachePrimaryOffset(name, receiver_map);
+  Node* primary_offset = StubCachePrimaryOffset(stub_cache, name, receiver_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          receiver_map, if_handler, var_handler, &try_secondary);
 
   BIND(&try_secondary);
   {
     // Probe the secondary table.
-    Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
+    Node* secondary_offset =
+        StubCacheSecondaryOffset(stub_cache, name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            receiver_map, if_handler, var_handler, &miss);
   }
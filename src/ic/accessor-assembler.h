@@ -57,11 +57,13 @@ class AccessorAssembler : public CodeStubAssembler {
                          Label* if_handler, TVariable<MaybeObject>* var_handler,
                          Label* if_miss);
 
-  Node* StubCachePrimaryOffsetForTesting(Node* name, Node* map) {
-    return StubCachePrimaryOffset(name, map);
+  Node* StubCachePrimaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                         Node* map) {
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  Node* StubCacheSecondaryOffsetForTesting(Node* name, Node* map) {
-    return StubCacheSecondaryOffset(name, map);
+  Node* StubCacheSecondaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                           Node* map) {
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
   struct LoadICParameters {
@@ -306,8 +308,9 @@ class AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  Node* StubCachePrimaryOffset(Node* name, Node* map);
-  Node* StubCacheSecondaryOffset(Node* name, Node* seed);
+  Node* StubCachePrimaryOffset(StubCache* stub_cache, Node* name, Node* map);
+  Node* StubCacheSecondaryOffset(StubCache* stub_cache, Node* name,
+                                 Node* seed);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               Node* entry_offset, Node* name, Node* map,
@@ -4,31 +4,60 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/counters.h"
+#include "src/flags.h"
 #include "src/heap/heap.h"
 #include "src/ic/ic-inl.h"
 
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+namespace {
+
+int TableSizeFromFlag(int bits) {
+  return 1 << std::max(StubCache::kMinTableBits,
+                       std::min(StubCache::kMaxTableBits, bits));
+}
+
+}  // namespace
+
+// The tables are allocated here rather than in Initialize(), since their
+// addresses are recorded in the external reference table before the stub
+// caches are initialized.
+StubCache::StubCache(Isolate* isolate)
+    : primary_table_size_(
+          TableSizeFromFlag(FLAG_stub_cache_primary_table_bits)),
+      secondary_table_size_(
+          TableSizeFromFlag(FLAG_stub_cache_secondary_table_bits)),
+      primary_mask_((primary_table_size_ - 1) << kCacheIndexShift),
+      secondary_mask_((secondary_table_size_ - 1) << kCacheIndexShift),
+      isolate_(isolate) {
   // Ensure the nullptr (aka Smi::kZero) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  primary_ = new Entry[primary_table_size_];
+  secondary_ = new Entry[secondary_table_size_];
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size_));
   Clear();
 }
 
 // Hash algorithm for the primary table.  This algorithm is replicated in
 // assembler for every architecture.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Name name, Map map) {
+int StubCache::PrimaryOffset(Name name, Map map) const {
   STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
   // Compute the hash of the name (use entire hash field).
   DCHECK(name->HasHashCode());
@@ -39,24 +68,24 @@ int StubCache::PrimaryOffset(Name name, Map map) {
   uint32_t map_low32bits = static_cast<uint32_t>(map.ptr());
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler for every architecture.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Name name, int seed) {
+int StubCache::SecondaryOffset(Name name, int seed) const {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
-int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
+int StubCache::PrimaryOffsetForTesting(Name name, Map map) const {
   return PrimaryOffset(name, map);
 }
 
-int StubCache::SecondaryOffsetForTesting(Name name, int seed) {
+int StubCache::SecondaryOffsetForTesting(Name name, int seed) const {
   return SecondaryOffset(name, seed);
 }
 
@@ -96,6 +125,9 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     int secondary_offset =
         SecondaryOffset(Name::cast(ObjectPtr(primary->key)), seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (secondary->map != kNullAddress) {
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -125,12 +157,12 @@ void StubCache::Clear() {
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = empty_string.ptr();
     primary_[i].map = kNullAddress;
     primary_[i].value = empty.ptr();
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = empty_string.ptr();
     secondary_[j].map = kNullAddress;
     secondary_[j].value = empty.ptr();
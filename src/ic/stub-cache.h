@@ -67,6 +67,13 @@ class StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The offset masks are read by generated code, since the table sizes are
+  // only known when the isolate is created.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -84,19 +91,23 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The table sizes are taken from --stub-cache-primary-table-bits and
+  // --stub-cache-secondary-table-bits, clamped to this range.
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 20;
+
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
 
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map) const;
+  int SecondaryOffsetForTesting(Name name, int seed) const;
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -109,12 +120,12 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed) const;
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -128,8 +139,13 @@ class StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_;
+  Entry* secondary_;
+  int primary_table_size_;
+  int secondary_table_size_;
+  // (table size - 1) << kCacheIndexShift.
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -724,6 +724,8 @@ class PreviewPropertyAccumulator : public ValueMirror::PropertyAccumulator {
     return true;
   }
 
+  bool OwnPropertiesOnly() const override { return true; }
+
  private:
   std::vector<String16> m_blacklist;
   int m_skipIndex;
@@ -1167,6 +1169,13 @@ bool ValueMirror::getProperties(v8::Local<v8::Context> context,
        !iterator->Done(); iterator->Advance()) {
     bool isOwn = iterator->is_own();
     if (!isOwn && ownProperties) break;
+    // Inherited properties can only be reported as own below when native
+    // accessors are formatted as properties; otherwise don't build mirrors
+    // for the whole prototype chain just to have them dropped.
+    if (!isOwn && !formatAccessorsAsProperties &&
+        accumulator->OwnPropertiesOnly()) {
+      break;
+    }
     v8::Local<v8::Name> v8Name = iterator->name();
     v8::Maybe<bool> result = set->Has(context, v8Name);
     if (result.IsNothing()) return false;
@@ -64,6 +64,9 @@ class ValueMirror {
    public:
     virtual ~PropertyAccumulator() = default;
     virtual bool Add(PropertyMirror mirror) = 0;
+    // Returns true if the accumulator drops every property that is not
+    // reported as own, so inherited ones need not be looked at.
+    virtual bool OwnPropertiesOnly() const { return false; }
   };
   static bool getProperties(v8::Local<v8::Context> context,
                             v8::Local<v8::Object> object, bool ownProperties,
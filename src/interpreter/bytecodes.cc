@@ -266,6 +266,8 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaZero:
       case Bytecode::kLdaSmi:
       case Bytecode::kLdaNull:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
@@ -277,8 +279,21 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseXor:
+      case Bytecode::kBitwiseAnd:
+      case Bytecode::kShiftLeft:
+      case Bytecode::kShiftRight:
+      case Bytecode::kShiftRightLogical:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftLeftSmi:
+      case Bytecode::kShiftRightSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
@@ -12,6 +12,7 @@
 #include "src/ast/ast.h"
 #include "src/ast/scopes.h"
 #include "src/base/functional.h"
+#include "src/conversions.h"
 #include "src/isolate.h"
 #include "src/objects-inl.h"
 
@@ -379,6 +380,15 @@ Handle<Object> ConstantArrayBuilder::Entry::ToHandle(Isolate* isolate) const {
     case Tag::kRawString:
       return raw_string_->string();
     case Tag::kHeapNumber:
+      // Share the read-only heap numbers instead of allocating a copy of
+      // them in every constant pool that needs one.
+      if (IsMinusZero(heap_number_)) {
+        return isolate->factory()->minus_zero_value();
+      } else if (heap_number_ == V8_INFINITY) {
+        return isolate->factory()->infinity_value();
+      } else if (heap_number_ == -V8_INFINITY) {
+        return isolate->factory()->minus_infinity_value();
+      }
       return isolate->factory()->NewNumber(heap_number_, TENURED);
     case Tag::kBigInt:
       // This should never fail: the parser will never create a BigInt
@@ -20,6 +20,7 @@
 #include "src/interpreter/interpreter-assembler.h"
 #include "src/interpreter/interpreter-intrinsics-generator.h"
 #include "src/objects-inl.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/js-generator.h"
 #include "src/objects/module.h"
 
@@ -2901,8 +2902,35 @@ IGNITION_HANDLER(IncBlockCounter, InterpreterAssembler) {
   Node* coverage_array_slot = BytecodeOperandIdxSmi(0);
   Node* context = GetContext();
 
+  // Bump the count in the CoverageInfo directly if there is one, and leave
+  // all other cases to the runtime.
+  Label call_runtime(this, Label::kDeferred), done(this);
+  TNode<HeapObject> shared = CAST(
+      LoadObjectField(closure, JSFunction::kSharedFunctionInfoOffset));
+  TNode<HeapObject> script_or_debug_info = CAST(LoadObjectField(
+      shared, SharedFunctionInfo::kScriptOrDebugInfoOffset));
+  GotoIfNot(HasInstanceType(script_or_debug_info, DEBUG_INFO_TYPE),
+            &call_runtime);
+  TNode<Smi> flags =
+      CAST(LoadObjectField(script_or_debug_info, DebugInfo::kFlagsOffset));
+  GotoIfNot(IsSetSmi(flags, DebugInfo::kHasCoverageInfo), &call_runtime);
+  TNode<FixedArray> coverage_info = CAST(
+      LoadObjectField(script_or_debug_info, DebugInfo::kCoverageInfoOffset));
+  TNode<IntPtrT> index = IntPtrAdd(
+      IntPtrConstant(CoverageInfo::kFirstSlotIndex +
+                     CoverageInfo::kSlotBlockCountIndex),
+      IntPtrMul(SmiUntag(coverage_array_slot),
+                IntPtrConstant(CoverageInfo::kSlotIndexCount)));
+  TNode<Smi> count = CAST(LoadFixedArrayElement(coverage_info, index));
+  TNode<Smi> new_count = TrySmiAdd(count, SmiConstant(1), &call_runtime);
+  StoreFixedArrayElement(coverage_info, index, new_count, SKIP_WRITE_BARRIER);
+  Goto(&done);
+
+  BIND(&call_runtime);
   CallRuntime(Runtime::kIncBlockCounter, context, closure, coverage_array_slot);
+  Goto(&done);
 
+  BIND(&done);
   Dispatch();
 }
 
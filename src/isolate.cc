@@ -1452,6 +1452,8 @@ Object* Isolate::Throw(Object* raw_exception, MessageLocation* location) {
   //    captures messages or is verbose (which reports despite the catch).
   // 3) ReThrow from v8::TryCatch: The message from a previous throw still
   //    exists and we preserve it instead of creating a new message.
+  // 4) JavaScript try-catch on top: Entering the catch block clears the
+  //    pending message, so it would never be observed.
   bool requires_message = try_catch_handler() == nullptr ||
                           try_catch_handler()->is_verbose_ ||
                           try_catch_handler()->capture_message_;
@@ -1459,11 +1461,18 @@ Object* Isolate::Throw(Object* raw_exception, MessageLocation* location) {
 
   thread_local_top()->rethrowing_message_ = false;
 
+  bool catchable_by_js = is_catchable_by_javascript(raw_exception);
+
   // Notify debugger of exception.
-  if (is_catchable_by_javascript(raw_exception)) {
+  if (catchable_by_js) {
     debug()->OnThrow(exception);
   }
 
+  if (requires_message && !rethrowing_message && catchable_by_js &&
+      PredictExceptionCatcher() == CAUGHT_BY_JAVASCRIPT) {
+    requires_message = false;
+  }
+
   // Generate the message if required.
   if (requires_message && !rethrowing_message) {
     MessageLocation computed_location;
@@ -148,6 +148,10 @@ JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
   // Optimized fast case where we only have Latin1 characters.
   if (seq_one_byte) {
     seq_source_ = Handle<SeqOneByteString>::cast(source_);
+    if (source_length_ >= kTransitionCacheMinSourceLength) {
+      transition_cache_ = factory()->NewFixedArray(
+          kTransitionCacheSize * kTransitionCacheEntrySize);
+    }
   }
 }
 
@@ -400,17 +404,30 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // First check whether there is a single expected transition. If so, try
       // to parse it first.
       bool follow_expected = false;
+      bool has_expected_transition = false;
       Handle<Map> target;
       if (seq_one_byte) {
         DisallowHeapAllocation no_gc;
         TransitionsAccessor transitions(isolate(), *map, &no_gc);
         key = transitions.ExpectedTransitionKey();
-        follow_expected = !key.is_null() && ParseJsonString(key);
+        has_expected_transition = !key.is_null();
+        follow_expected = has_expected_transition && ParseJsonString(key);
         // If the expected transition hits, follow it.
         if (follow_expected) {
           target = transitions.ExpectedTransitionTarget();
         }
       }
+      if (seq_one_byte && !has_expected_transition) {
+        // Maps with several transitions have no expected key, but repeated
+        // objects of one shape tend to take the same transition again.
+        key = CachedTransitionKey(map);
+        if (!key.is_null() && ParseJsonString(key)) {
+          follow_expected = true;
+          transitioning = TransitionsAccessor(isolate(), map)
+                              .FindTransitionToField(key)
+                              .ToHandle(&target);
+        }
+      }
       if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
@@ -421,6 +438,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
         transitioning = TransitionsAccessor(isolate(), map)
                             .FindTransitionToField(key)
                             .ToHandle(&target);
+        if (transitioning && seq_one_byte && !has_expected_transition) {
+          CacheTransitionKey(map, key);
+        }
       }
       if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -512,6 +532,32 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
   return scope.CloseAndEscape(json_object);
 }
 
+template <bool seq_one_byte>
+Handle<String> JsonParser<seq_one_byte>::CachedTransitionKey(Handle<Map> map) {
+  if (transition_cache_.is_null()) return Handle<String>::null();
+  int index = static_cast<int>((map->ptr() >> kPointerSizeLog2) &
+                               (kTransitionCacheSize - 1)) *
+              kTransitionCacheEntrySize;
+  if (transition_cache_->get(index + kTransitionCacheMapOffset) != *map) {
+    return Handle<String>::null();
+  }
+  return handle(
+      String::cast(transition_cache_->get(index + kTransitionCacheKeyOffset)),
+      isolate());
+}
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::CacheTransitionKey(Handle<Map> map,
+                                                  Handle<String> key) {
+  if (transition_cache_.is_null()) return;
+  // Maps can move during GC; entries at stale indices just miss.
+  int index = static_cast<int>((map->ptr() >> kPointerSizeLog2) &
+                               (kTransitionCacheSize - 1)) *
+              kTransitionCacheEntrySize;
+  transition_cache_->set(index + kTransitionCacheMapOffset, *map);
+  transition_cache_->set(index + kTransitionCacheKeyOffset, *key);
+}
+
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::CommitStateToJsonObject(
     Handle<JSObject> json_object, Handle<Map> map,
@@ -142,6 +142,18 @@ class JsonParser {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                Vector<const Handle<Object>> properties);
 
+  // Returns the key last followed from {map}, which has no single expected
+  // transition, during this parse, or a null handle.
+  Handle<String> CachedTransitionKey(Handle<Map> map);
+  void CacheTransitionKey(Handle<Map> map, Handle<String> key);
+
+  // The transition key cache is only worth allocating for larger inputs.
+  static const int kTransitionCacheMinSourceLength = 1024;
+  static const int kTransitionCacheSize = 64;
+  static const int kTransitionCacheMapOffset = 0;
+  static const int kTransitionCacheKeyOffset = 1;
+  static const int kTransitionCacheEntrySize = 2;
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -155,6 +167,9 @@ class JsonParser {
 
   // Property handles are stored here inside ParseJsonObject.
   ZoneVector<Handle<Object>> properties_;
+
+  // Direct-mapped (map, key) pairs, see CachedTransitionKey.
+  Handle<FixedArray> transition_cache_;
 };
 
 }  // namespace internal
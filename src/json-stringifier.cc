@@ -84,6 +84,9 @@ class JsonStringifier {
 
   void SerializeString(Handle<String> object);
 
+  // Appends a quoted key that is known not to need escaping, if possible.
+  V8_INLINE bool TrySerializeCachedKey(Handle<String> key);
+
   template <typename SrcChar, typename DestChar>
   V8_INLINE static void SerializeStringUnchecked_(
       Vector<const SrcChar> src,
@@ -117,6 +120,11 @@ class JsonStringifier {
   uc16* gap_;
   int indent_;
 
+  // One-byte internalized keys found not to need escaping, indexed by hash.
+  // Objects mostly repeat the same few keys.
+  Handle<FixedArray> key_cache_;
+  static const int kKeyCacheSize = 64;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -208,6 +216,9 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
     return MaybeHandle<Object>();
   }
+  if (object->IsJSReceiver()) {
+    key_cache_ = factory()->NewFixedArray(kKeyCacheSize);
+  }
   Result result = SerializeObject(object);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) return builder_.Finish();
@@ -893,11 +904,40 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
-  SerializeString(Handle<String>::cast(deferred_key));
+  Handle<String> key = Handle<String>::cast(deferred_key);
+  if (!TrySerializeCachedKey(key)) SerializeString(key);
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+bool JsonStringifier::TrySerializeCachedKey(Handle<String> key) {
+  if (key_cache_.is_null() ||
+      builder_.CurrentEncoding() != String::ONE_BYTE_ENCODING ||
+      !key->IsInternalizedString() || !key->IsSeqOneByteString()) {
+    return false;
+  }
+  int length = key->length();
+  int quoted_length = length + 2;
+  if (builder_.EscapedLengthIfCurrentPartFits(quoted_length) == 0) {
+    return false;
+  }
+  DisallowHeapAllocation no_gc;
+  const uint8_t* chars = SeqOneByteString::cast(*key)->GetChars(no_gc);
+  int index = static_cast<int>(key->Hash() & (kKeyCacheSize - 1));
+  if (key_cache_->get(index) != *key) {
+    for (int i = 0; i < length; i++) {
+      if (!DoNotEscape(chars[i])) return false;
+    }
+    key_cache_->set(index, *key);
+  }
+  IncrementalStringBuilder::NoExtendBuilder<uint8_t> no_extend(
+      &builder_, quoted_length, no_gc);
+  no_extend.Append('"');
+  for (int i = 0; i < length; i++) no_extend.Append(chars[i]);
+  no_extend.Append('"');
+  return true;
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
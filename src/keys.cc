@@ -236,7 +236,29 @@ void TrySettingEmptyEnumCache(JSReceiver* object) {
   map->SetEnumLength(0);
 }
 
+// Dictionary-mode objects never get an enum cache, but as prototypes they
+// usually only hold non-enumerable properties such as methods.
+bool HasNoEnumerableDictionaryProperties(JSObject* object) {
+  DCHECK(object->map()->is_dictionary_map());
+  NameDictionary dictionary = object->property_dictionary();
+  ReadOnlyRoots roots = object->GetReadOnlyRoots();
+  int capacity = dictionary->Capacity();
+  for (int i = 0; i < capacity; i++) {
+    Object* key;
+    if (!dictionary->ToKey(roots, i, &key)) continue;
+    if (key->IsSymbol()) continue;
+    if (!dictionary->DetailsAt(i).IsDontEnum()) return false;
+  }
+  return true;
+}
+
 bool CheckAndInitalizeEmptyEnumCache(JSReceiver* object) {
+  Map map = object->map();
+  if (map->is_dictionary_map() && !map->IsSpecialReceiverMap()) {
+    JSObject* js_object = JSObject::cast(object);
+    return HasNoEnumerableDictionaryProperties(js_object) &&
+           !js_object->HasEnumerableElements();
+  }
   if (object->map()->EnumLength() == kInvalidEnumCacheSentinel) {
     TrySettingEmptyEnumCache(object);
   }
@@ -63,11 +63,17 @@ bool DefaultForegroundTaskRunner::IdleTasksEnabled() {
 std::unique_ptr<Task> DefaultForegroundTaskRunner::PopTaskFromQueue(
     MessageLoopBehavior wait_for_work) {
   base::MutexGuard guard(&lock_);
-  // Move delayed tasks that hit their deadline to the main queue.
-  std::unique_ptr<Task> task = PopTaskFromDelayedQueueLocked(guard);
-  while (task) {
-    PostTaskLocked(std::move(task), guard);
-    task = PopTaskFromDelayedQueueLocked(guard);
+  // Move delayed tasks that hit their deadline to the main queue. All of them
+  // are moved as one batch against a single reading of the clock, and there
+  // is no need to wake the event loop since it is the caller.
+  std::unique_ptr<Task> task;
+  if (!delayed_task_queue_.empty()) {
+    double now = MonotonicallyIncreasingTime();
+    task = PopTaskFromDelayedQueueLocked(guard, now);
+    while (task) {
+      task_queue_.push(std::move(task));
+      task = PopTaskFromDelayedQueueLocked(guard, now);
+    }
   }
 
   while (task_queue_.empty()) {
@@ -83,10 +89,9 @@ std::unique_ptr<Task> DefaultForegroundTaskRunner::PopTaskFromQueue(
 
 std::unique_ptr<Task>
 DefaultForegroundTaskRunner::PopTaskFromDelayedQueueLocked(
-    const base::MutexGuard&) {
+    const base::MutexGuard&, double now) {
   if (delayed_task_queue_.empty()) return {};
 
-  double now = MonotonicallyIncreasingTime();
   const DelayedEntry& deadline_and_task = delayed_task_queue_.top();
   if (deadline_and_task.first > now) return {};
   // The const_cast here is necessary because there does not exist a clean way
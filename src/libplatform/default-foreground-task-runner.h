@@ -49,8 +49,10 @@ class V8_PLATFORM_EXPORT DefaultForegroundTaskRunner
   void PostTaskLocked(std::unique_ptr<Task> task, const base::MutexGuard&);
 
   // A caller of this function has to hold {lock_}. The {guard} parameter should
-  // make sure that the caller is holding the lock.
-  std::unique_ptr<Task> PopTaskFromDelayedQueueLocked(const base::MutexGuard&);
+  // make sure that the caller is holding the lock. Returns a delayed task whose
+  // deadline is not after {now}, if any.
+  std::unique_ptr<Task> PopTaskFromDelayedQueueLocked(const base::MutexGuard&,
+                                                      double now);
 
   bool terminated_ = false;
   base::Mutex lock_;
@@ -193,6 +193,20 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   worker_threads_task_runner_->PostTask(std::move(task));
 }
 
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(
+      std::move(task), TaskQueue::Priority::kHigh);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(std::move(task),
+                                                    TaskQueue::Priority::kLow);
+}
+
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
   EnsureBackgroundTaskRunnerInitialized();
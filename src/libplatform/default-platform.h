@@ -59,6 +59,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
   void CallOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override;
   void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override;
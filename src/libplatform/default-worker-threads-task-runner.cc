@@ -32,19 +32,22 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
+  PostTaskWithPriority(std::move(task), TaskQueue::Priority::kNormal);
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTaskWithPriority(
+    std::unique_ptr<Task> task, TaskQueue::Priority priority) {
+  queue_.Append(std::move(task), priority);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
   if (delay_in_seconds == 0) {
     queue_.Append(std::move(task));
     return;
   }
+  // Like all other tasks, delayed tasks are dropped after termination.
+  if (terminated_) return;
   // There is no use case for this function with non zero delay_in_second on a
   // worker thread at the moment, but it is still part of the interface.
   UNIMPLEMENTED();
@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+
 #include "include/v8-platform.h"
 #include "src/libplatform/task-queue.h"
 
@@ -26,6 +28,11 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
+  // Posts a task that is taken by the worker threads before (high priority)
+  // or after (low priority) tasks posted with PostTask.
+  void PostTaskWithPriority(std::unique_ptr<Task> task,
+                            TaskQueue::Priority priority);
+
   void PostDelayedTask(std::unique_ptr<Task> task,
                        double delay_in_seconds) override;
 
@@ -34,8 +41,11 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   bool IdleTasksEnabled() override;
 
  private:
-  bool terminated_ = false;
+  // Only guards termination. Posting relies on the queue's own lock, which
+  // drops tasks once the queue is terminated.
   base::Mutex lock_;
+  // Lets PostDelayedTask drop tasks after termination without taking the lock.
+  std::atomic<bool> terminated_{false};
   TaskQueue queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
 };
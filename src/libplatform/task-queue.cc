@@ -18,23 +18,36 @@ TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
 TaskQueue::~TaskQueue() {
   base::MutexGuard guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(IsEmpty());
 }
 
-void TaskQueue::Append(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+bool TaskQueue::IsEmpty() const {
+  for (const auto& task_queue : task_queues_) {
+    if (!task_queue.empty()) return false;
+  }
+  return true;
+}
+
+bool TaskQueue::Append(std::unique_ptr<Task> task, Priority priority) {
+  {
+    base::MutexGuard guard(&lock_);
+    if (terminated_) return false;
+    task_queues_[static_cast<size_t>(priority)].push(std::move(task));
+  }
+  // Waking a worker does not need the lock, so a woken worker does not
+  // immediately contend with the poster.
   process_queue_semaphore_.Signal();
+  return true;
 }
 
 std::unique_ptr<Task> TaskQueue::GetNext() {
   for (;;) {
     {
       base::MutexGuard guard(&lock_);
-      if (!task_queue_.empty()) {
-        std::unique_ptr<Task> result = std::move(task_queue_.front());
-        task_queue_.pop();
+      for (auto& task_queue : task_queues_) {
+        if (task_queue.empty()) continue;
+        std::unique_ptr<Task> result = std::move(task_queue.front());
+        task_queue.pop();
         return result;
       }
       if (terminated_) {
@@ -58,7 +71,7 @@ void TaskQueue::BlockUntilQueueEmptyForTesting() {
   for (;;) {
     {
       base::MutexGuard guard(&lock_);
-      if (task_queue_.empty()) return;
+      if (IsEmpty()) return;
     }
     base::OS::Sleep(base::TimeDelta::FromMilliseconds(5));
   }
@@ -21,14 +21,19 @@ namespace platform {
 
 class V8_PLATFORM_EXPORT TaskQueue {
  public:
+  enum class Priority { kHigh, kNormal, kLow };
+
   TaskQueue();
   ~TaskQueue();
 
-  // Appends a task to the queue. The queue takes ownership of |task|.
-  void Append(std::unique_ptr<Task> task);
+  // Appends a task to the queue. The queue takes ownership of |task|. Returns
+  // false and drops the task if the queue is already terminated.
+  bool Append(std::unique_ptr<Task> task,
+              Priority priority = Priority::kNormal);
 
-  // Returns the next task to process. Blocks if no task is available. Returns
-  // nullptr if the queue is terminated.
+  // Returns the next task to process, taking tasks of higher priority first.
+  // Blocks if no task is available. Returns nullptr if the queue is
+  // terminated.
   std::unique_ptr<Task> GetNext();
 
   // Terminate the queue.
@@ -39,9 +44,14 @@ class V8_PLATFORM_EXPORT TaskQueue {
 
   void BlockUntilQueueEmptyForTesting();
 
+  static constexpr size_t kNumPriorities =
+      static_cast<size_t>(Priority::kLow) + 1;
+
+  bool IsEmpty() const;
+
   base::Semaphore process_queue_semaphore_;
   base::Mutex lock_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
+  std::queue<std::unique_ptr<Task>> task_queues_[kNumPriorities];
   bool terminated_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
@@ -13,29 +13,48 @@ namespace v8 {
 namespace internal {
 
 // static
-int DescriptorLookupCache::Hash(Map source, Name name) {
+int DescriptorLookupCache::SetStart(Map source, Name name) {
   DCHECK(name->IsUniqueName());
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash =
       static_cast<uint32_t>(source.ptr()) >> kPointerSizeLog2;
   uint32_t name_hash = name->hash_field();
-  return (source_hash ^ name_hash) % kLength;
+  return ((source_hash ^ name_hash) % kSets) * kWays;
+}
+
+void DescriptorLookupCache::MoveToFront(int start, int index) {
+  Key key = keys_[index];
+  int result = results_[index];
+  for (int i = index; i > start; i--) {
+    keys_[i] = keys_[i - 1];
+    results_[i] = results_[i - 1];
+  }
+  keys_[start] = key;
+  results_[start] = result;
 }
 
 int DescriptorLookupCache::Lookup(Map source, Name name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  if ((key.source == source) && (key.name == name)) return results_[index];
+  int start = SetStart(source, name);
+  for (int index = start; index < start + kWays; index++) {
+    Key& key = keys_[index];
+    if ((key.source == source) && (key.name == name)) {
+      int result = results_[index];
+      if (index != start) MoveToFront(start, index);
+      return result;
+    }
+  }
   return kAbsent;
 }
 
 void DescriptorLookupCache::Update(Map source, Name name, int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
+  int start = SetStart(source, name);
+  // Evict the least recently used entry of the set.
+  MoveToFront(start, start + kWays - 1);
+  Key& key = keys_[start];
   key.source = source;
   key.name = name;
-  results_[index] = result;
+  results_[start] = result;
 }
 
 }  // namespace internal
@@ -39,9 +39,18 @@ class DescriptorLookupCache {
     }
   }
 
-  static inline int Hash(Map source, Name name);
+  // Returns the index of the first entry of the set for (source, name).
+  static inline int SetStart(Map source, Name name);
 
-  static const int kLength = 64;
+  // Moves the entry at {index} to the front of the set starting at {start},
+  // shifting the more recently used entries back by one.
+  inline void MoveToFront(int start, int index);
+
+  // The cache is set associative: each (map, name) pair hashes to a set of
+  // kWays entries kept in most recently used order.
+  static const int kWays = 4;
+  static const int kSets = 64;
+  static const int kLength = kSets * kWays;
   struct Key {
     Map source;
     Name name;
@@ -51,6 +60,7 @@ class DescriptorLookupCache {
   int results_[kLength];
 
   friend class Isolate;
+  friend class DescriptorLookupCacheTester;
   DISALLOW_COPY_AND_ASSIGN(DescriptorLookupCache);
 };
 
@@ -11893,6 +11893,14 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  // Compare ropes piecewise instead of flattening them: flattening copies
+  // the whole tree, which only pays off if the string is read again.
+  if (one->IsConsString() || two->IsConsString()) {
+    DisallowHeapAllocation no_gc;
+    StringComparator comparator;
+    return comparator.Equals(*one, *two);
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
@@ -13343,6 +13351,28 @@ bool CanSubclassHaveInobjectProperties(InstanceType instance_type) {
 #endif
 
 
+namespace {
+
+// Class fields are defined by the instance members initializer rather than
+// by the constructor body, so their count is added to the constructor's own
+// estimate.
+int AddExpectedNofPropertiesOfClassFields(Isolate* isolate,
+                                          Handle<JSFunction> constructor,
+                                          int expected_nof_properties) {
+  if (!constructor->shared()->requires_instance_members_initializer()) {
+    return expected_nof_properties;
+  }
+  Handle<Object> initializer = JSReceiver::GetDataProperty(
+      constructor, isolate->factory()->class_fields_symbol());
+  if (!initializer->IsJSFunction()) return expected_nof_properties;
+  int count =
+      JSFunction::cast(*initializer)->shared()->expected_nof_properties();
+  return std::min(expected_nof_properties + count,
+                  JSObject::kMaxInObjectProperties);
+}
+
+}  // namespace
+
 void JSFunction::EnsureHasInitialMap(Handle<JSFunction> function) {
   DCHECK(function->has_prototype_slot());
   DCHECK(function->IsConstructor() ||
@@ -13370,6 +13400,8 @@ void JSFunction::EnsureHasInitialMap(Handle<JSFunction> function) {
                         &is_compiled_scope)) {
     DCHECK(function->shared()->is_compiled());
     expected_nof_properties = function->shared()->expected_nof_properties();
+    expected_nof_properties = AddExpectedNofPropertiesOfClassFields(
+        isolate, function, expected_nof_properties);
   }
 
   int instance_size;
@@ -14225,7 +14257,8 @@ bool JSFunction::CalculateInstanceSizeForDerivedClass(
         Compiler::Compile(func, Compiler::CLEAR_EXCEPTION,
                           &is_compiled_scope)) {
       DCHECK(shared->is_compiled());
-      int count = shared->expected_nof_properties();
+      int count = AddExpectedNofPropertiesOfClassFields(
+          isolate, func, shared->expected_nof_properties());
       // Check that the estimate is sane.
       if (expected_nof_properties <= JSObject::kMaxInObjectProperties - count) {
         expected_nof_properties += count;
@@ -121,6 +121,20 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                   digit_t summand, int n, MutableBigInt result);
   void InplaceMultiplyAdd(uintptr_t factor, uintptr_t summand);
 
+  // Specialized helpers for Multiply of long operands. These work on raw
+  // digit arrays so that recursion does not need to allocate on the heap.
+  static const int kKaratsubaThreshold = 34;
+  static void MultiplyKaratsuba(const digit_t* x, int x_length,
+                                const digit_t* y, int y_length, digit_t* z);
+  static void MultiplySchoolbook(const digit_t* x, int x_length,
+                                 const digit_t* y, int y_length, digit_t* z);
+  static void DigitsAdd(const digit_t* x, int x_length, const digit_t* y,
+                        int y_length, digit_t* z);
+  static void DigitsAddInto(digit_t* z, int z_length, const digit_t* x,
+                            int x_length);
+  static void DigitsSubtractFrom(digit_t* z, int z_length, const digit_t* x,
+                                 int x_length);
+
   // Specialized helpers for Divide/Remainder.
   static void AbsoluteDivSmall(Isolate* isolate, Handle<BigIntBase> x,
                                digit_t divisor, Handle<MutableBigInt>* quotient,
@@ -478,9 +492,23 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
   if (!MutableBigInt::New(isolate, result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
-  result->InitializeDigits(result_length);
-  for (int i = 0; i < x->length(); i++) {
-    MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+  if (Min(x->length(), y->length()) >= MutableBigInt::kKaratsubaThreshold) {
+    std::vector<digit_t> x_digits(x->length());
+    std::vector<digit_t> y_digits(y->length());
+    std::vector<digit_t> z_digits(result_length);
+    for (int i = 0; i < x->length(); i++) x_digits[i] = x->digit(i);
+    for (int i = 0; i < y->length(); i++) y_digits[i] = y->digit(i);
+    MutableBigInt::MultiplyKaratsuba(x_digits.data(), x->length(),
+                                     y_digits.data(), y->length(),
+                                     z_digits.data());
+    for (int i = 0; i < result_length; i++) {
+      result->set_digit(i, z_digits[i]);
+    }
+  } else {
+    result->InitializeDigits(result_length);
+    for (int i = 0; i < x->length(); i++) {
+      MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+    }
   }
   result->set_sign(x->sign() != y->sign());
   return MutableBigInt::MakeImmutable(result);
@@ -1401,6 +1429,150 @@ void MutableBigInt::MultiplyAccumulate(Handle<BigIntBase> multiplicand,
   }
 }
 
+// Computes {z} = {x} * {y}, where {z} must have room for
+// {x_length} + {y_length} digits. Uses Karatsuba's algorithm, falling back
+// to schoolbook multiplication for short operands.
+void MutableBigInt::MultiplyKaratsuba(const digit_t* x, int x_length,
+                                      const digit_t* y, int y_length,
+                                      digit_t* z) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  if (y_length < kKaratsubaThreshold) {
+    MultiplySchoolbook(x, x_length, y, y_length, z);
+    return;
+  }
+  int z_length = x_length + y_length;
+  if (x_length >= 2 * y_length) {
+    // Unbalanced operands: multiply {y} with {y_length}-sized chunks of {x}.
+    std::fill(z, z + z_length, 0);
+    std::vector<digit_t> part(2 * y_length);
+    for (int i = 0; i < x_length; i += y_length) {
+      int chunk_length = Min(y_length, x_length - i);
+      MultiplyKaratsuba(x + i, chunk_length, y, y_length, part.data());
+      DigitsAddInto(z + i, z_length - i, part.data(), chunk_length + y_length);
+    }
+    return;
+  }
+  // Split both operands at {m} digits: x = x1 * B^m + x0, and likewise for
+  // y. Since x_length < 2 * y_length, {y1} is non-empty.
+  int m = x_length / 2;
+  DCHECK_LT(m, y_length);
+  // z0 = x0 * y0 goes into z[0, 2m), z2 = x1 * y1 into z[2m, z_length).
+  MultiplyKaratsuba(x, m, y, m, z);
+  MultiplyKaratsuba(x + m, x_length - m, y + m, y_length - m, z + 2 * m);
+  // z1 = (x0 + x1) * (y0 + y1) - z0 - z2.
+  int sx_length = Max(m, x_length - m) + 1;
+  int sy_length = Max(m, y_length - m) + 1;
+  std::vector<digit_t> sx(sx_length);
+  std::vector<digit_t> sy(sy_length);
+  DigitsAdd(x, m, x + m, x_length - m, sx.data());
+  DigitsAdd(y, m, y + m, y_length - m, sy.data());
+  int z1_length = sx_length + sy_length;
+  std::vector<digit_t> z1(z1_length);
+  MultiplyKaratsuba(sx.data(), sx_length, sy.data(), sy_length, z1.data());
+  DigitsSubtractFrom(z1.data(), z1_length, z, 2 * m);
+  DigitsSubtractFrom(z1.data(), z1_length, z + 2 * m, z_length - 2 * m);
+  DigitsAddInto(z + m, z_length - m, z1.data(), z1_length);
+}
+
+// Computes {z} = {x} * {y}, where {z} must have room for
+// {x_length} + {y_length} digits.
+void MutableBigInt::MultiplySchoolbook(const digit_t* x, int x_length,
+                                       const digit_t* y, int y_length,
+                                       digit_t* z) {
+  std::fill(z, z + x_length + y_length, 0);
+  for (int i = 0; i < x_length; i++) {
+    digit_t multiplier = x[i];
+    if (multiplier == 0) continue;
+    digit_t carry = 0;
+    digit_t high = 0;
+    for (int j = 0; j < y_length; j++) {
+      digit_t acc = z[i + j];
+      digit_t new_carry = 0;
+      acc = digit_add(acc, high, &new_carry);
+      acc = digit_add(acc, carry, &new_carry);
+      digit_t low = digit_mul(multiplier, y[j], &high);
+      acc = digit_add(acc, low, &new_carry);
+      z[i + j] = acc;
+      carry = new_carry;
+    }
+    // z[i + y_length] has not been written yet, and the partial product
+    // z[i, i + y_length] is known to fit.
+    z[i + y_length] = high + carry;
+  }
+}
+
+// Computes {z} = {x} + {y}, where {z} must have room for
+// max({x_length}, {y_length}) + 1 digits.
+void MutableBigInt::DigitsAdd(const digit_t* x, int x_length, const digit_t* y,
+                              int y_length, digit_t* z) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < y_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(x[i], y[i], &new_carry);
+    sum = digit_add(sum, carry, &new_carry);
+    z[i] = sum;
+    carry = new_carry;
+  }
+  for (; i < x_length; i++) {
+    digit_t new_carry = 0;
+    z[i] = digit_add(x[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  z[i] = carry;
+}
+
+// Adds {x} to {z} in place. The sum must fit into {z_length} digits; any
+// digits of {x} beyond that must be zero.
+void MutableBigInt::DigitsAddInto(digit_t* z, int z_length, const digit_t* x,
+                                  int x_length) {
+  while (x_length > 0 && x[x_length - 1] == 0) x_length--;
+  DCHECK_LE(x_length, z_length);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(z[i], x[i], &new_carry);
+    sum = digit_add(sum, carry, &new_carry);
+    z[i] = sum;
+    carry = new_carry;
+  }
+  for (; carry != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_carry = 0;
+    z[i] = digit_add(z[i], carry, &new_carry);
+    carry = new_carry;
+  }
+}
+
+// Subtracts {x} from {z} in place. The difference must not be negative.
+void MutableBigInt::DigitsSubtractFrom(digit_t* z, int z_length,
+                                       const digit_t* x, int x_length) {
+  DCHECK_LE(x_length, z_length);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = digit_sub(z[i], x[i], &new_borrow);
+    difference = digit_sub(difference, borrow, &new_borrow);
+    z[i] = difference;
+    borrow = new_borrow;
+  }
+  for (; borrow != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_borrow = 0;
+    z[i] = digit_sub(z[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+}
+
 // Multiplies {source} with {factor} and adds {summand} to the result.
 // {result} and {source} may be the same BigInt for inplace modification.
 void MutableBigInt::InternalMultiplyAdd(BigIntBase source, digit_t factor,
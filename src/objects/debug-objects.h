@@ -241,6 +241,15 @@ class CoverageInfo : public FixedArray {
     return slot_count * kSlotIndexCount + kFirstSlotIndex;
   }
 
+  static const int kFirstSlotIndex = 0;
+
+  // Each slot is assigned a group of indices starting at kFirstSlotIndex.
+  // Within this group, semantics are as follows:
+  static const int kSlotStartSourcePositionIndex = 0;
+  static const int kSlotEndSourcePositionIndex = 1;
+  static const int kSlotBlockCountIndex = 2;
+  static const int kSlotIndexCount = 3;
+
   DECL_CAST2(CoverageInfo)
 
   // Print debug info.
@@ -251,15 +260,6 @@ class CoverageInfo : public FixedArray {
     return kFirstSlotIndex + slot_index * kSlotIndexCount;
   }
 
-  static const int kFirstSlotIndex = 0;
-
-  // Each slot is assigned a group of indices starting at kFirstSlotIndex.
-  // Within this group, semantics are as follows:
-  static const int kSlotStartSourcePositionIndex = 0;
-  static const int kSlotEndSourcePositionIndex = 1;
-  static const int kSlotBlockCountIndex = 2;
-  static const int kSlotIndexCount = 3;
-
   OBJECT_CONSTRUCTORS(CoverageInfo, FixedArray);
 };
 
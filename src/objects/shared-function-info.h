@@ -404,6 +404,15 @@ class SharedFunctionInfo : public HeapObjectPtr {
   // [flags] Bit field containing various flags about the function.
   DECL_INT_ACCESSORS(flags)
 
+  // [flags2] Bit field containing additional flags about the function. All
+  // bits of |flags| are in use.
+  DECL_UINT8_ACCESSORS(flags2)
+
+  // Indicates that optimized code was installed for a closure of this
+  // function. The bit is preserved in the code cache and allows functions
+  // to tier up early after deserialization.
+  DECL_BOOLEAN_ACCESSORS(has_optimized_at_least_once)
+
   // Is this function a named function expression in the source code.
   DECL_BOOLEAN_ACCESSORS(is_named_expression)
 
@@ -612,6 +621,7 @@ class SharedFunctionInfo : public HeapObjectPtr {
   V(kBuiltinFunctionId, kUInt8Size)                       \
   V(kFunctionTokenOffsetOffset, kUInt16Size)              \
   V(kFlagsOffset, kInt32Size)                             \
+  V(kFlags2Offset, kUInt8Size)                            \
   /* Total size. */                                       \
   V(kSize, 0)
 
@@ -621,6 +631,12 @@ class SharedFunctionInfo : public HeapObjectPtr {
 
   static const int kAlignedSize = POINTER_SIZE_ALIGN(kSize);
 
+  // |flags2| only fits into alignment padding on 64-bit builds without unique
+  // ids. On 32-bit builds and with V8_SFI_HAS_UNIQUE_ID it grows the object
+  // by one word.
+  STATIC_ASSERT(kPointerSize == kInt32Size || kUniqueIdFieldSize != 0 ||
+                kAlignedSize == POINTER_SIZE_ALIGN(kFlags2Offset));
+
   typedef FixedBodyDescriptor<kStartOfPointerFieldsOffset,
                               kEndOfTaggedFieldsOffset, kAlignedSize>
       BodyDescriptor;
@@ -651,6 +667,11 @@ class SharedFunctionInfo : public HeapObjectPtr {
   DEFINE_BIT_FIELDS(FLAGS_BIT_FIELDS)
 #undef FLAGS_BIT_FIELDS
 
+// Bit positions in |flags2|.
+#define FLAGS2_BIT_FIELDS(V, _) V(HasOptimizedAtLeastOnceBit, bool, 1, _)
+  DEFINE_BIT_FIELDS(FLAGS2_BIT_FIELDS)
+#undef FLAGS2_BIT_FIELDS
+
   // Bailout reasons must fit in the DisabledOptimizationReason bitfield.
   STATIC_ASSERT(BailoutReason::kLastErrorMessage <=
                 DisabledOptimizationReasonBits::kMax);
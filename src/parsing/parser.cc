@@ -2531,9 +2531,15 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. Lazy top level function
+  // declarations are usually called soon after the script has run, so they
+  // can optionally be compiled ahead of their first call in the same way.
+  const bool is_predicted_top_level_function =
+      is_eager_top_level_function ||
+      (FLAG_parallel_compile_lazy_declarations && is_lazy_top_level_function &&
+       function_type == FunctionLiteral::kDeclaration);
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
+      parse_lazily() && is_predicted_top_level_function &&
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
@@ -3105,8 +3111,11 @@ FunctionLiteral* Parser::CreateInitializerFunction(
   InitializeClassMembersStatement* static_fields =
       factory()->NewInitializeClassMembersStatement(fields, kNoSourcePosition);
   statements.Add(static_fields);
+  // Each field defines one property on the receiver, which lets the class
+  // constructor's initial map reserve in-object space for them.
   return factory()->NewFunctionLiteral(
-      ast_value_factory()->GetOneByteString(name), scope, statements, 0, 0, 0,
+      ast_value_factory()->GetOneByteString(name), scope, statements,
+      fields->length(), 0, 0,
       FunctionLiteral::kNoDuplicateParameters,
       FunctionLiteral::kAnonymousExpression,
       FunctionLiteral::kShouldEagerCompile, scope->start_position(), false,
@@ -565,6 +565,21 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
   while (it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize) {
+    // Copy runs of ASCII characters without decoding them one by one.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_length =
+          Min(chunk.length - it,
+              static_cast<size_t>(buffer_start_ + kBufferSize - 1 - cursor));
+      size_t ascii_length = String::NonAsciiStart(
+          reinterpret_cast<const char*>(chunk.data + it),
+          static_cast<int>(max_length));
+      if (ascii_length > 0) {
+        CopyCharsUnsigned(cursor, chunk.data + it, ascii_length);
+        cursor += ascii_length;
+        it += ascii_length;
+        continue;
+      }
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (V8_LIKELY(t < kUtf8Bom)) {
@@ -354,24 +354,44 @@ void Scanner::TryToParseSourceURLComment() {
 
 Token::Value Scanner::SkipMultiLineComment() {
   DCHECK_EQ(c0_, '*');
-  Advance();
 
+  // Until we see the first line terminator, stop at '*' and at line
+  // terminators. AdvanceUntil scans the buffered characters directly, so
+  // the comment body is skipped without a call to Advance() per character.
+  if (!HasLineTerminatorBeforeNext()) {
+    do {
+      AdvanceUntil([](uc32 c0) {
+        return c0 == '*' || unibrow::IsLineTerminator(c0);
+      });
+
+      while (c0_ == '*') {
+        Advance();
+        if (c0_ == '/') {
+          Advance();
+          return Token::WHITESPACE;
+        }
+      }
+
+      if (unibrow::IsLineTerminator(c0_)) {
+        // Following ECMA-262, section 7.4, a comment containing
+        // a newline will make the comment count as a line-terminator.
+        next().after_line_terminator = true;
+        break;
+      }
+    } while (c0_ != kEndOfInput);
+  }
+
+  // After the first line terminator, only look for the closing "*/".
   while (c0_ != kEndOfInput) {
-    DCHECK(!unibrow::IsLineTerminator(kEndOfInput));
-    if (!HasLineTerminatorBeforeNext() && unibrow::IsLineTerminator(c0_)) {
-      // Following ECMA-262, section 7.4, a comment containing
-      // a newline will make the comment count as a line-terminator.
-      next().after_line_terminator = true;
-    }
+    AdvanceUntil([](uc32 c0) { return c0 == '*'; });
 
-    while (V8_UNLIKELY(c0_ == '*')) {
+    while (c0_ == '*') {
       Advance();
       if (c0_ == '/') {
         Advance();
         return Token::WHITESPACE;
       }
     }
-    Advance();
   }
 
   // Unterminated multi-line comment.
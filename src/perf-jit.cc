@@ -85,6 +85,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -116,6 +126,8 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+std::map<Address, PerfJitLogger::LoggedCode>* PerfJitLogger::logged_code_ =
+    nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -137,12 +149,15 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  logged_code_ = new std::map<Address, LoggedCode>();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  delete logged_code_;
+  logged_code_ = nullptr;
 }
 
 void* PerfJitLogger::OpenMarkerFile(int fd) {
@@ -232,6 +247,10 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode abstract_code,
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
 
+  // Remember the code index so that moves of this code can refer to it. Code
+  // logged before at the same memory is dead by now.
+  ForgetLoggedCode(code->address(), code->Size());
+  (*logged_code_)[code->InstructionStart()] = {code_index_, code_size};
   WriteJitCodeLoadEntry(code_pointer, code_size, code_name, length);
 }
 
@@ -422,9 +441,50 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from->IsBytecodeArray());
+  // BytecodeArray objects are not logged, so their moves do not matter.
+  if (from->IsBytecodeArray()) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+  if (perf_output_handle_ == nullptr) return;
+
+  // The GC reports the move before it installs the forwarding pointer, so
+  // {from} is still intact. Off-heap trampolines keep their instructions.
+  Address old_start = from->GetCode()->InstructionStart();
+  Address new_start = to->GetCode()->InstructionStart();
+  if (old_start == new_start) return;
+  auto it = logged_code_->find(old_start);
+  if (it == logged_code_->end()) return;
+  LoggedCode logged = it->second;
+  logged_code_->erase(it);
+  ForgetLoggedCode(to->address(), from->Size());
+  (*logged_code_)[new_start] = logged;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(new_start);
+  code_move.old_code_address_ = static_cast<uint64_t>(old_start);
+  code_move.new_code_address_ = static_cast<uint64_t>(new_start);
+  code_move.code_size_ = logged.code_size;
+  code_move.code_id_ = logged.code_index;
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
+void PerfJitLogger::ForgetLoggedCode(Address start, size_t size) {
+  auto it = logged_code_->lower_bound(start);
+  if (it != logged_code_->begin()) {
+    auto previous = std::prev(it);
+    if (previous->first + previous->second.code_size > start) {
+      logged_code_->erase(previous);
+    }
+  }
+  while (it != logged_code_->end() && it->first < start + size) {
+    it = logged_code_->erase(it);
+  }
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -28,6 +28,8 @@
 #ifndef V8_PERF_JIT_H_
 #define V8_PERF_JIT_H_
 
+#include <map>
+
 #include "src/log.h"
 
 namespace v8 {
@@ -111,6 +113,19 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+
+  // Code objects written to the dump, keyed by instruction start, so that
+  // code moves by the GC can be reported with the original code index.
+  // There are no code deletion events, so entries of dead code are dropped
+  // once other code is logged or moved to the same memory.
+  struct LoggedCode {
+    uint64_t code_index;
+    uint32_t code_size;
+  };
+  static std::map<Address, LoggedCode>* logged_code_;
+
+  // Forgets the logged code that overlaps [start, start + size).
+  static void ForgetLoggedCode(Address start, size_t size);
 };
 
 #else
@@ -427,6 +427,7 @@ void CpuProfiler::StopProcessor() {
   logger->RemoveCodeEventListener(profiler_listener_.get());
   processor_->StopSynchronously();
   processor_.reset();
+  if (FLAG_prof_bytecode_handlers) generator_->PrintBytecodeHandlerTicks();
   logger->is_logging_ = saved_is_logging_;
 }
 
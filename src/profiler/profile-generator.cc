@@ -5,6 +5,7 @@
 #include "src/profiler/profile-generator.h"
 
 #include "src/base/adapters.h"
+#include "src/base/bits.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/global-handles.h"
@@ -411,7 +412,12 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
   ProfileNode* top_frame_node =
       top_down_.AddPathFromEnd(path, src_line, update_stats, mode_);
 
-  if (record_samples_ && !timestamp.IsNull()) {
+  // Bounding the samples keeps the memory of a long-running profile fixed,
+  // while the call tree keeps aggregating every tick.
+  if (record_samples_ && !timestamp.IsNull() &&
+      (FLAG_cpu_profiler_max_samples <= 0 ||
+       samples_.size() <
+           static_cast<size_t>(FLAG_cpu_profiler_max_samples))) {
     timestamps_.push_back(timestamp);
     samples_.push_back(top_frame_node);
   }
@@ -526,6 +532,7 @@ CodeMap::~CodeMap() {
 }
 
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
+  generation_++;
   ClearCodesInRange(addr, addr + size);
   unsigned index = AddCodeEntry(addr, entry);
   code_map_.emplace(addr, CodeEntryMapInfo{index, size});
@@ -549,6 +556,18 @@ void CodeMap::ClearCodesInRange(Address start, Address end) {
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr) {
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kFindEntryCacheSize));
+  FindEntryCacheEntry& cached =
+      find_entry_cache_[addr & (kFindEntryCacheSize - 1)];
+  if (cached.generation == generation_ && cached.pc == addr) {
+    return cached.entry;
+  }
+  CodeEntry* result = FindEntryUncached(addr);
+  cached = {addr, result, generation_};
+  return result;
+}
+
+CodeEntry* CodeMap::FindEntryUncached(Address addr) {
   auto it = code_map_.upper_bound(addr);
   if (it == code_map_.begin()) return nullptr;
   --it;
@@ -566,6 +585,7 @@ void CodeMap::MoveCode(Address from, Address to) {
   if (from == to) return;
   auto it = code_map_.find(from);
   if (it == code_map_.end()) return;
+  generation_++;
   CodeEntryMapInfo info = it->second;
   code_map_.erase(it);
   DCHECK(from + info.size <= to || to + info.size <= from);
@@ -684,7 +704,9 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
 }
 
 ProfileGenerator::ProfileGenerator(CpuProfilesCollection* profiles)
-    : profiles_(profiles) {}
+    : profiles_(profiles),
+      bytecode_handler_ticks_(
+          Builtins::builtin_count - Builtins::kFirstBytecodeHandler, 0) {}
 
 void ProfileGenerator::RecordTickSample(const TickSample& sample) {
   ProfileStackTrace stack_trace;
@@ -734,6 +756,13 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
         src_line_not_found = false;
         stack_trace.push_back({pc_entry, src_line});
 
+        if (FLAG_prof_bytecode_handlers &&
+            pc_entry->builtin_id() >= Builtins::kFirstBytecodeHandler &&
+            pc_entry->builtin_id() < Builtins::builtin_count) {
+          bytecode_handler_ticks_[pc_entry->builtin_id() -
+                                  Builtins::kFirstBytecodeHandler]++;
+        }
+
         if (pc_entry->builtin_id() == Builtins::kFunctionPrototypeApply ||
             pc_entry->builtin_id() == Builtins::kFunctionPrototypeCall) {
           // When current function is either the Function.prototype.apply or the
@@ -802,6 +831,28 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
                                       sample.update_stats);
 }
 
+void ProfileGenerator::PrintBytecodeHandlerTicks() {
+  std::vector<std::pair<unsigned, int>> ticks;
+  unsigned total = 0;
+  for (size_t i = 0; i < bytecode_handler_ticks_.size(); ++i) {
+    if (bytecode_handler_ticks_[i] == 0) continue;
+    ticks.emplace_back(bytecode_handler_ticks_[i],
+                       Builtins::kFirstBytecodeHandler + static_cast<int>(i));
+    total += bytecode_handler_ticks_[i];
+    bytecode_handler_ticks_[i] = 0;
+  }
+  std::sort(ticks.begin(), ticks.end(),
+            [](const std::pair<unsigned, int>& a,
+               const std::pair<unsigned, int>& b) {
+              return a.first > b.first;
+            });
+  PrintF("[Bytecode handler ticks: %u]\n", total);
+  for (const std::pair<unsigned, int>& entry : ticks) {
+    PrintF("%10u %5.1f%%  %s\n", entry.first, 100.0 * entry.first / total,
+           Builtins::name(entry.second));
+  }
+}
+
 CodeEntry* ProfileGenerator::EntryForVMState(StateTag tag) {
   switch (tag) {
     case GC:
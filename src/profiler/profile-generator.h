@@ -384,8 +384,19 @@ class CodeMap {
     unsigned next_free_slot;
   };
 
+  // Sampled pcs repeat a lot, so the result of FindEntry is remembered in a
+  // small direct-mapped cache. Any change to the map bumps |generation_|,
+  // which invalidates all cached results at once.
+  struct FindEntryCacheEntry {
+    Address pc;
+    CodeEntry* entry;
+    unsigned generation;
+  };
+
   static constexpr unsigned kNoFreeSlot = std::numeric_limits<unsigned>::max();
+  static constexpr int kFindEntryCacheSize = 256;
 
+  CodeEntry* FindEntryUncached(Address addr);
   void ClearCodesInRange(Address start, Address end);
   unsigned AddCodeEntry(Address start, CodeEntry*);
   void DeleteCodeEntry(unsigned index);
@@ -395,6 +406,9 @@ class CodeMap {
   std::deque<CodeEntrySlotInfo> code_entries_;
   std::map<Address, CodeEntryMapInfo> code_map_;
   unsigned free_list_head_ = kNoFreeSlot;
+  // Starts at one so that the zero-initialized cache entries are invalid.
+  unsigned generation_ = 1;
+  FindEntryCacheEntry find_entry_cache_[kFindEntryCacheSize] = {};
 
   DISALLOW_COPY_AND_ASSIGN(CodeMap);
 };
@@ -444,12 +458,19 @@ class ProfileGenerator {
 
   CodeMap* code_map() { return &code_map_; }
 
+  // Prints the number of samples whose pc was inside each bytecode handler
+  // since the last call, collected under --prof-bytecode-handlers.
+  void PrintBytecodeHandlerTicks();
+
  private:
   CodeEntry* FindEntry(Address address);
   CodeEntry* EntryForVMState(StateTag tag);
 
   CpuProfilesCollection* profiles_;
   CodeMap code_map_;
+  // Indexed by builtin id minus Builtins::kFirstBytecodeHandler, so that
+  // the wide and extra-wide handlers are counted separately.
+  std::vector<unsigned> bytecode_handler_ticks_;
 
   DISALLOW_COPY_AND_ASSIGN(ProfileGenerator);
 };
@@ -0,0 +1,69 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PTR_COMPR_INL_H_
+#define V8_PTR_COMPR_INL_H_
+
+#include "src/globals.h"
+#include "src/ptr-compr.h"
+
+#if V8_TARGET_ARCH_64_BIT
+
+namespace v8 {
+namespace internal {
+
+// Compresses a full tagged value by dropping its upper 32 bits. Both smis and
+// heap object pointers inside the isolate's reservation are representable.
+V8_INLINE uint32_t CompressTagged(Address tagged) {
+  return static_cast<uint32_t>(tagged);
+}
+
+// Computes the isolate root from any address inside the isolate's heap
+// reservation. The root lies in the middle of the 4GB reservation, so adding
+// the bias and rounding down to the reservation alignment yields the root.
+V8_INLINE Address GetRootFromOnHeapAddress(Address addr) {
+  return RoundDown(addr + kPtrComprIsolateRootBias,
+                   kPtrComprIsolateRootAlignment);
+}
+
+// Decompresses a value that is known to be a smi.
+V8_INLINE Address DecompressTaggedSigned(uint32_t raw_value) {
+  // Current compression scheme requires |raw_value| to be sign-extended
+  // from int32_t to intptr_t.
+  return static_cast<Address>(
+      static_cast<intptr_t>(static_cast<int32_t>(raw_value)));
+}
+
+// Decompresses a value that is known to be a (strong or weak) heap object
+// pointer. |on_heap_addr| is any address inside the isolate's reservation,
+// usually the address of the slot the value was loaded from.
+V8_INLINE Address DecompressTaggedPointer(Address on_heap_addr,
+                                          uint32_t raw_value) {
+  // Current compression scheme requires |raw_value| to be sign-extended
+  // from int32_t to intptr_t.
+  intptr_t value = static_cast<intptr_t>(static_cast<int32_t>(raw_value));
+  Address root = GetRootFromOnHeapAddress(on_heap_addr);
+  return root + static_cast<Address>(value);
+}
+
+// Decompresses a value that may be either a smi or a heap object pointer.
+// The isolate root is only added for heap objects, which is computed without
+// branching on the smi tag.
+V8_INLINE Address DecompressTaggedAny(Address on_heap_addr,
+                                      uint32_t raw_value) {
+  // Current compression scheme requires |raw_value| to be sign-extended
+  // from int32_t to intptr_t.
+  intptr_t value = static_cast<intptr_t>(static_cast<int32_t>(raw_value));
+  // |root_mask| is 0 if the |value| was a smi or -1 otherwise.
+  Address root_mask = static_cast<Address>(-(value & kSmiTagMask));
+  Address root_or_zero = root_mask & GetRootFromOnHeapAddress(on_heap_addr);
+  return root_or_zero + static_cast<Address>(value);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_64_BIT
+
+#endif  // V8_PTR_COMPR_INL_H_
@@ -6791,21 +6791,21 @@ Object* RegExpResultsCache::Lookup(Heap* heap, String key_string,
     cache = heap->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) != key_string ||
-      cache->get(index + kPatternOffset) != key_pattern) {
-    index =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index + kStringOffset) != key_string ||
-        cache->get(index + kPatternOffset) != key_pattern) {
-      return Smi::kZero;
+  Counters* counters = heap->isolate()->counters();
+  int set_start = SetStart(key_string->Hash());
+  for (int way = 0; way < kWays; ++way) {
+    int index = set_start + way * kArrayEntriesPerCacheEntry;
+    if (cache->get(index + kStringOffset) == key_string &&
+        cache->get(index + kPatternOffset) == key_pattern) {
+      counters->regexp_results_cache_hits()->Increment();
+      MoveToFront(cache, set_start, way);
+      *last_match_cache =
+          FixedArray::cast(cache->get(set_start + kLastMatchOffset));
+      return cache->get(set_start + kArrayOffset);
     }
   }
-
-  *last_match_cache = FixedArray::cast(cache->get(index + kLastMatchOffset));
-  return cache->get(index + kArrayOffset);
+  counters->regexp_results_cache_misses()->Increment();
+  return Smi::kZero;
 }
 
 void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
@@ -6826,33 +6826,14 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     cache = factory->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == Smi::kZero) {
-    cache->set(index + kStringOffset, *key_string);
-    cache->set(index + kPatternOffset, *key_pattern);
-    cache->set(index + kArrayOffset, *value_array);
-    cache->set(index + kLastMatchOffset, *last_match_cache);
-  } else {
-    uint32_t index2 =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index2 + kStringOffset) == Smi::kZero) {
-      cache->set(index2 + kStringOffset, *key_string);
-      cache->set(index2 + kPatternOffset, *key_pattern);
-      cache->set(index2 + kArrayOffset, *value_array);
-      cache->set(index2 + kLastMatchOffset, *last_match_cache);
-    } else {
-      cache->set(index2 + kStringOffset, Smi::kZero);
-      cache->set(index2 + kPatternOffset, Smi::kZero);
-      cache->set(index2 + kArrayOffset, Smi::kZero);
-      cache->set(index2 + kLastMatchOffset, Smi::kZero);
-      cache->set(index + kStringOffset, *key_string);
-      cache->set(index + kPatternOffset, *key_pattern);
-      cache->set(index + kArrayOffset, *value_array);
-      cache->set(index + kLastMatchOffset, *last_match_cache);
-    }
-  }
+  // Evict the least recently used entry, i.e. the last way of the set, and
+  // insert the new entry at the front.
+  int set_start = SetStart(key_string->Hash());
+  MoveToFront(*cache, set_start, kWays - 1);
+  cache->set(set_start + kStringOffset, *key_string);
+  cache->set(set_start + kPatternOffset, *key_pattern);
+  cache->set(set_start + kArrayOffset, *value_array);
+  cache->set(set_start + kLastMatchOffset, *last_match_cache);
   // If the array is a reasonably short list of substrings, convert it into a
   // list of internalized strings.
   if (type == STRING_SPLIT_SUBSTRINGS && value_array->length() < 100) {
@@ -6867,6 +6848,26 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
       ReadOnlyRoots(isolate).fixed_cow_array_map());
 }
 
+int RegExpResultsCache::SetStart(uint32_t hash) {
+  return static_cast<int>(hash & (kNumSets - 1)) * kSetSize;
+}
+
+void RegExpResultsCache::MoveToFront(FixedArray cache, int set_start,
+                                     int way) {
+  DisallowHeapAllocation no_gc;
+  int index = set_start + way * kArrayEntriesPerCacheEntry;
+  Object* entry[kArrayEntriesPerCacheEntry];
+  for (int i = 0; i < kArrayEntriesPerCacheEntry; ++i) {
+    entry[i] = cache->get(index + i);
+  }
+  for (int i = index - 1; i >= set_start; --i) {
+    cache->set(i + kArrayEntriesPerCacheEntry, cache->get(i));
+  }
+  for (int i = 0; i < kArrayEntriesPerCacheEntry; ++i) {
+    cache->set(set_start + i, entry[i]);
+  }
+}
+
 void RegExpResultsCache::Clear(FixedArray cache) {
   for (int i = 0; i < kRegExpResultsCacheSize; i++) {
     cache->set(i, Smi::kZero);
@@ -1539,7 +1539,7 @@ class RegExpResultsCache : public AllStatic {
                     Handle<Object> key_pattern, Handle<FixedArray> value_array,
                     Handle<FixedArray> last_match_cache, ResultsCacheType type);
   static void Clear(FixedArray cache);
-  static const int kRegExpResultsCacheSize = 0x100;
+  static const int kRegExpResultsCacheSize = 0x400;
 
  private:
   static const int kArrayEntriesPerCacheEntry = 4;
@@ -1547,6 +1547,20 @@ class RegExpResultsCache : public AllStatic {
   static const int kPatternOffset = 1;
   static const int kArrayOffset = 2;
   static const int kLastMatchOffset = 3;
+
+  // The cache is split into sets of {kWays} entries selected by the hash of
+  // the subject string. Within a set, entries are ordered from most to least
+  // recently used.
+  static const int kWays = 4;
+  static const int kSetSize = kWays * kArrayEntriesPerCacheEntry;
+  static const int kNumSets = kRegExpResultsCacheSize / kSetSize;
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kNumSets));
+
+  // Returns the index of the first entry of the set for {hash}.
+  static int SetStart(uint32_t hash);
+  // Moves the entry at {way} to the front of the set, shifting the entries
+  // before it back by one.
+  static void MoveToFront(FixedArray cache, int set_start, int way);
 };
 
 }  // namespace internal
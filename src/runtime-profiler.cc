@@ -27,6 +27,13 @@ static const int kProfilerTicksBeforeOptimization = 2;
 // kProfilerTicksBeforeOptimization required for any function.
 static const int kBytecodeSizeAllowancePerTick = 1200;
 
+// Every deoptimization of a function raises the number of ticks it needs
+// before it is optimized again, so that its feedback can settle instead of
+// going through the same deopt and reopt cycle. The increase is capped so
+// that functions with many deopts still get optimized eventually.
+static const int kProfilerTicksPerDeopt = 1;
+static const int kMaxProfilerTicksForDeopts = 8;
+
 // Maximum size in bytes of generate code for a function to allow OSR.
 static const int kOSRBytecodeSizeAllowanceBase = 180;
 
@@ -39,10 +46,16 @@ static const int kMaxBytecodeSizeForEarlyOpt = 90;
 // Certain functions are simply too big to be worth optimizing.
 static const int kMaxBytecodeSizeForOpt = 60 * KB;
 
+// Number of times a function deserialized from the code cache has to be seen
+// on the stack before it is optimized, if it was already optimized when the
+// cache was created.
+static const int kProfilerTicksBeforeWarmStartOptimization = 1;
+
 #define OPTIMIZATION_REASON_LIST(V)                            \
   V(DoNotOptimize, "do not optimize")                          \
   V(HotAndStable, "hot and stable")                            \
-  V(SmallFunction, "small function")
+  V(SmallFunction, "small function")                           \
+  V(HotInCodeCache, "hot in code cache")
 
 enum class OptimizationReason : uint8_t {
 #define OPTIMIZATION_REASON_CONSTANTS(Constant, message) k##Constant,
@@ -179,7 +192,14 @@ bool RuntimeProfiler::MaybeOSR(JSFunction* function, InterpretedFrame* frame) {
         kOSRBytecodeSizeAllowanceBase +
         static_cast<int64_t>(ticks) * kOSRBytecodeSizeAllowancePerTick;
     if (function->shared()->GetBytecodeArray()->length() <= allowance) {
-      AttemptOnStackReplacement(frame);
+      // Once optimized code exists, the frame is only kept in the interpreter
+      // by the loop it is executing. Arm all back edges at once instead of
+      // one nesting level per tick, so that deeply nested loops do not have
+      // to wait several ticks before they can enter the optimized code.
+      int levels = (FLAG_osr_arm_all_levels && function->HasOptimizedCode())
+                       ? AbstractCode::kMaxLoopNestingMarker
+                       : 1;
+      AttemptOnStackReplacement(frame, levels);
     }
     return true;
   }
@@ -193,23 +213,54 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction* function,
     return OptimizationReason::kDoNotOptimize;
   }
 
+  SharedFunctionInfo shared = function->shared();
+  if (FLAG_code_cache_tier_up_hints && shared->deserialized() &&
+      shared->has_optimized_at_least_once() &&
+      function->feedback_vector()->deopt_count() == 0 &&
+      ticks >= kProfilerTicksBeforeWarmStartOptimization) {
+    // The function was hot in the process that created the code cache.
+    return OptimizationReason::kHotInCodeCache;
+  }
+
+  int deopt_count = function->feedback_vector()->deopt_count();
   int ticks_for_optimization =
       kProfilerTicksBeforeOptimization +
-      (bytecode->length() / kBytecodeSizeAllowancePerTick);
+      (bytecode->length() / kBytecodeSizeAllowancePerTick) +
+      Min(deopt_count * kProfilerTicksPerDeopt, kMaxProfilerTicksForDeopts);
   if (ticks >= ticks_for_optimization) {
+    // Wait for the feedback to fill in if too few ICs have seen any types
+    // yet, but give up waiting after as many ticks again.
+    if (FLAG_delay_opt_for_type_info && FLAG_type_info_threshold > 0 &&
+        ticks < 2 * ticks_for_optimization) {
+      int typeinfo, generic, total, type_percentage, generic_percentage;
+      GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
+                  &generic_percentage);
+      if (type_percentage < FLAG_type_info_threshold) {
+        if (FLAG_trace_opt_verbose) {
+          PrintF("[not yet optimizing ");
+          function->PrintName();
+          PrintF(", not enough type info: %d%%/%d%%]\n", type_percentage,
+                 FLAG_type_info_threshold);
+        }
+        return OptimizationReason::kDoNotOptimize;
+      }
+    }
     return OptimizationReason::kHotAndStable;
-  } else if (!any_ic_changed_ &&
+  } else if (!any_ic_changed_ && deopt_count == 0 &&
              bytecode->length() < kMaxBytecodeSizeForEarlyOpt) {
     // If no IC was patched since the last tick and this function is very
-    // small, optimistically optimize it now.
+    // small, optimistically optimize it now. Functions that deoptimized
+    // before wait for the full threshold instead.
     return OptimizationReason::kSmallFunction;
   } else if (FLAG_trace_opt_verbose) {
     PrintF("[not yet optimizing ");
     function->PrintName();
-    PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
+    PrintF(", not enough ticks: %d/%d (%d deopts) and ", ticks,
+           ticks_for_optimization, deopt_count);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
+    } else if (deopt_count > 0) {
+      PrintF("deoptimized before]\n");
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
              bytecode->length(), kMaxBytecodeSizeForEarlyOpt);
@@ -2,7 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+
 #include "src/arguments-inl.h"
+#include "src/cancelable-task.h"
 #include "src/counters.h"
 #include "src/elements.h"
 #include "src/heap/factory.h"
@@ -12,6 +15,8 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/runtime/runtime-utils.h"
 #include "src/runtime/runtime.h"
+#include "src/task-utils.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -102,6 +107,108 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Sorts 8-bit and 16-bit integers by counting occurrences of each value,
+// which is linear in the length of the array.
+template <typename T>
+void CountingSort(T* data, size_t length) {
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  std::vector<size_t> counts(size_t{1} << (8 * sizeof(T)));
+  for (size_t i = 0; i < length; i++) {
+    counts[static_cast<UnsignedT>(data[i])]++;
+  }
+  for (int32_t v = std::numeric_limits<T>::min();
+       v <= std::numeric_limits<T>::max(); v++) {
+    T value = static_cast<T>(v);
+    size_t count = counts[static_cast<UnsignedT>(value)];
+    std::fill(data, data + count, value);
+    data += count;
+  }
+}
+
+template <typename T>
+bool TryCountingSort(T* data, size_t length) {
+  return false;
+}
+bool TryCountingSort(int8_t* data, size_t length) {
+  CountingSort(data, length);
+  return true;
+}
+bool TryCountingSort(uint8_t* data, size_t length) {
+  CountingSort(data, length);
+  return true;
+}
+// The table of counts for 16-bit values only pays off for long arrays.
+const size_t kMinCountingSort16Length = 1 << 16;
+bool TryCountingSort(int16_t* data, size_t length) {
+  if (length < kMinCountingSort16Length) return false;
+  CountingSort(data, length);
+  return true;
+}
+bool TryCountingSort(uint16_t* data, size_t length) {
+  if (length < kMinCountingSort16Length) return false;
+  CountingSort(data, length);
+  return true;
+}
+
+// Sorts chunks of |data| on worker threads and the current thread, then
+// merges the sorted chunks on the current thread.
+template <typename T, typename Compare>
+void ParallelSort(T* data, size_t length, Compare compare) {
+  const size_t kMaxChunks = 16;
+  size_t threads = static_cast<size_t>(
+      std::max(0, V8::GetCurrentPlatform()->NumberOfWorkerThreads()));
+  size_t num_chunks = 1;
+  while (num_chunks * 2 <= threads + 1 && num_chunks * 2 <= kMaxChunks) {
+    num_chunks *= 2;
+  }
+  if (num_chunks == 1) {
+    std::sort(data, data + length, compare);
+    return;
+  }
+  auto chunk_start = [=](size_t chunk) {
+    return data + length / num_chunks * chunk +
+           std::min(chunk, length % num_chunks);
+  };
+
+  std::atomic<size_t> next_chunk{0};
+  auto sort_chunks = [&]() {
+    for (;;) {
+      size_t chunk = next_chunk.fetch_add(1);
+      if (chunk >= num_chunks) return;
+      std::sort(chunk_start(chunk), chunk_start(chunk + 1), compare);
+    }
+  };
+  CancelableTaskManager task_manager;
+  for (size_t i = 1; i < num_chunks; i++) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        MakeCancelableTask(&task_manager, sort_chunks));
+  }
+  sort_chunks();
+  // Tasks which did not start yet have nothing left to do; wait for the
+  // running ones.
+  task_manager.CancelAndWait();
+
+  for (size_t width = 1; width < num_chunks; width *= 2) {
+    for (size_t chunk = 0; chunk + width < num_chunks; chunk += 2 * width) {
+      std::inplace_merge(chunk_start(chunk), chunk_start(chunk + width),
+                         chunk_start(std::min(chunk + 2 * width, num_chunks)),
+                         compare);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void SortTypedArrayElements(T* data, size_t length, Compare compare) {
+  if (TryCountingSort(data, length)) return;
+  if (FLAG_typed_array_parallel_sort_threshold > 0 &&
+      length >=
+          static_cast<size_t>(FLAG_typed_array_parallel_sort_threshold)) {
+    ParallelSort(data, length, compare);
+    return;
+  }
+  std::sort(data, data + length, compare);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -125,15 +232,15 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   Handle<FixedTypedArrayBase> elements(
       FixedTypedArrayBase::cast(array->elements()), isolate);
   switch (array->type()) {
-#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)           \
-  case kExternal##Type##Array: {                            \
-    ctype* data = static_cast<ctype*>(elements->DataPtr()); \
-    if (kExternal##Type##Array == kExternalFloat64Array ||  \
-        kExternal##Type##Array == kExternalFloat32Array)    \
-      std::sort(data, data + length, CompareNum<ctype>);    \
-    else                                                    \
-      std::sort(data, data + length);                       \
-    break;                                                  \
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)                   \
+  case kExternal##Type##Array: {                                    \
+    ctype* data = static_cast<ctype*>(elements->DataPtr());         \
+    if (kExternal##Type##Array == kExternalFloat64Array ||          \
+        kExternal##Type##Array == kExternalFloat32Array)            \
+      SortTypedArrayElements(data, length, CompareNum<ctype>);      \
+    else                                                            \
+      SortTypedArrayElements(data, length, std::less<ctype>());     \
+    break;                                                          \
   }
 
     TYPED_ARRAYS(TYPED_ARRAY_SORT)
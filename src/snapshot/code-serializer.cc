@@ -4,7 +4,10 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include <unordered_set>
+
 #include "src/code-stubs.h"
+#include "src/compiler.h"
 #include "src/counters.h"
 #include "src/debug/debug.h"
 #include "src/log.h"
@@ -36,6 +39,49 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
 }
 
 // static
+ScriptCompiler::CachedData* CodeSerializer::Serialize(
+    Handle<SharedFunctionInfo> info,
+    const std::vector<int>& hot_function_positions) {
+  Isolate* isolate = info->GetIsolate();
+  Handle<Script> script(Script::cast(info->script()), isolate);
+  std::unordered_set<int> positions(hot_function_positions.begin(),
+                                    hot_function_positions.end());
+
+  // Inner functions only get a SharedFunctionInfo once their outer function
+  // is compiled, so keep going until no further hot function shows up.
+  std::vector<IsCompiledScope> compiled_scopes;
+  bool was_compiled;
+  do {
+    std::vector<Handle<SharedFunctionInfo>> candidates;
+    SharedFunctionInfo::ScriptIterator iterator(isolate, *script);
+    for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+         shared = iterator.Next()) {
+      if (shared->is_compiled() || !shared->allows_lazy_compilation()) {
+        continue;
+      }
+      // Match the function start positions reported by block coverage.
+      int start = shared->function_token_position();
+      if (start == kNoSourcePosition) start = shared->StartPosition();
+      if (positions.count(start) == 0) continue;
+      candidates.push_back(handle(shared, isolate));
+    }
+
+    was_compiled = false;
+    for (const auto& candidate : candidates) {
+      IsCompiledScope is_compiled_scope(candidate->is_compiled_scope());
+      if (!is_compiled_scope.is_compiled() &&
+          !Compiler::Compile(candidate, Compiler::CLEAR_EXCEPTION,
+                             &is_compiled_scope)) {
+        continue;
+      }
+      compiled_scopes.push_back(is_compiled_scope);
+      was_compiled = true;
+    }
+  } while (was_compiled);
+
+  return Serialize(info);
+}
+
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
   Isolate* isolate = info->GetIsolate();
@@ -46,6 +46,13 @@ class CodeSerializer : public Serializer {
  public:
   static ScriptCompiler::CachedData* Serialize(Handle<SharedFunctionInfo> info);
 
+  // Compiles the not yet compiled functions of the script whose start
+  // positions are listed in {hot_function_positions} before serializing, so
+  // that their bytecode is part of the resulting code cache.
+  static ScriptCompiler::CachedData* Serialize(
+      Handle<SharedFunctionInfo> info,
+      const std::vector<int>& hot_function_positions);
+
   ScriptData* SerializeSharedFunctionInfo(Handle<SharedFunctionInfo> info);
 
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded-data.h"
 
+#include <sstream>
+#include <unordered_map>
+
 #include "src/assembler-inl.h"
 #include "src/callable.h"
 #include "src/macro-assembler.h"
@@ -28,7 +31,9 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinAtLayoutPosition(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
@@ -37,15 +42,16 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin = d.BuiltinAtLayoutPosition(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin);
     }
   }
 
@@ -170,6 +176,44 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns all builtin ids in the order their instruction streams are laid out.
+// Builtins listed in --embedded-builtins-order come first, typically the hot
+// ones from a profile, so that they share i-cache lines and pages. All others
+// follow in id order.
+std::vector<uint32_t> ComputeLayoutOrder() {
+  std::vector<uint32_t> order;
+  order.reserve(Builtins::builtin_count);
+  std::vector<bool> placed(Builtins::builtin_count, false);
+
+  if (FLAG_embedded_builtins_order != nullptr) {
+    bool exists;
+    std::string profile = ReadFile(FLAG_embedded_builtins_order, &exists);
+    CHECK_WITH_MSG(exists, "Cannot read --embedded-builtins-order file.");
+    std::unordered_map<std::string, int> ids;
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      ids.emplace(Builtins::name(i), i);
+    }
+    std::istringstream lines(profile);
+    std::string name;
+    while (std::getline(lines, name)) {
+      if (name.empty()) continue;
+      auto it = ids.find(name);
+      if (it == ids.end()) {
+        FATAL("Unknown builtin in --embedded-builtins-order: %s", name.c_str());
+      }
+      if (placed[it->second]) continue;
+      placed[it->second] = true;
+      order.push_back(it->second);
+    }
+  }
+
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (!placed[i]) order.push_back(i);
+  }
+  DCHECK_EQ(static_cast<size_t>(Builtins::builtin_count), order.size());
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -178,10 +222,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct Metadata> metadata(kTableSize);
+  const std::vector<uint32_t> layout_order = ComputeLayoutOrder();
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_data_size = 0;
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (const uint32_t builtin : layout_order) {
+    const int i = static_cast<int>(builtin);
     Code code = builtins->builtin(i);
 
     if (Builtins::IsIsolateIndependent(i)) {
@@ -236,6 +282,9 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   // Write the metadata tables.
   DCHECK_EQ(MetadataSize(), sizeof(metadata[0]) * metadata.size());
   std::memcpy(blob + MetadataOffset(), metadata.data(), MetadataSize());
+  DCHECK_EQ(LayoutOrderSize(), sizeof(layout_order[0]) * layout_order.size());
+  std::memcpy(blob + LayoutOrderOffset(), layout_order.data(),
+              LayoutOrderSize());
 
   // Write the raw data section.
   for (int i = 0; i < Builtins::builtin_count; i++) {
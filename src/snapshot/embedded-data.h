@@ -59,6 +59,13 @@ class EmbeddedData final {
 
   bool ContainsBuiltin(int i) const { return InstructionSizeOfBuiltin(i) > 0; }
 
+  // Returns the id of the builtin whose instruction stream is at the given
+  // position in the blob. Instruction stream offsets increase with position.
+  int BuiltinAtLayoutPosition(int position) const {
+    DCHECK(Builtins::IsBuiltinId(position));
+    return LayoutOrder()[position];
+  }
+
   uint32_t AddressForHashing(Address addr) {
     Address start = reinterpret_cast<Address>(data_);
     DCHECK(IsInRange(addr, start, start + size_));
@@ -90,6 +97,7 @@ class EmbeddedData final {
   // [0] hash of the remaining blob
   // [1] metadata of instruction stream 0
   // ... metadata
+  // ... builtin ids in the order their instruction streams are laid out
   // ... instruction streams
 
   static constexpr uint32_t kTableSize = Builtins::builtin_count;
@@ -101,8 +109,14 @@ class EmbeddedData final {
   static constexpr uint32_t MetadataSize() {
     return sizeof(struct Metadata) * kTableSize;
   }
+  static constexpr uint32_t LayoutOrderOffset() {
+    return MetadataOffset() + MetadataSize();
+  }
+  static constexpr uint32_t LayoutOrderSize() {
+    return kUInt32Size * kTableSize;
+  }
   static constexpr uint32_t RawDataOffset() {
-    return PadAndAlign(MetadataOffset() + MetadataSize());
+    return PadAndAlign(LayoutOrderOffset() + LayoutOrderSize());
   }
 
  private:
@@ -114,6 +128,9 @@ class EmbeddedData final {
   const Metadata* Metadata() const {
     return reinterpret_cast<const struct Metadata*>(data_ + MetadataOffset());
   }
+  const uint32_t* LayoutOrder() const {
+    return reinterpret_cast<const uint32_t*>(data_ + LayoutOrderOffset());
+  }
   const uint8_t* RawData() const { return data_ + RawDataOffset(); }
 
   static constexpr int PadAndAlign(int size) {
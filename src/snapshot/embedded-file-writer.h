@@ -143,7 +143,10 @@ class EmbeddedFileWriter {
     const bool is_default_variant =
         std::strcmp(embedded_variant_, kDefaultEmbeddedVariant) == 0;
 
-    for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    // Instruction streams are emitted in layout order so that they end up at
+    // the offsets recorded in the metadata.
+    for (int position = 0; position < i::Builtins::builtin_count; position++) {
+      const int i = blob->BuiltinAtLayoutPosition(position);
       if (!blob->ContainsBuiltin(i)) continue;
 
       char builtin_symbol[kTemporaryStringLength];
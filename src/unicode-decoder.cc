@@ -7,6 +7,7 @@
 #include "src/unicode-decoder.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace unibrow {
 
@@ -50,6 +51,29 @@ bool Utf8Iterator::Done() {
   return offset_ == static_cast<size_t>(stream_.length());
 }
 
+size_t Utf8Iterator::SkipAscii() {
+  if (Done() || char_ > Utf8::kMaxOneByteChar) return 0;
+  DCHECK(!trailing_);
+  const uint8_t* start =
+      reinterpret_cast<const uint8_t*>(stream_.begin()) + offset_;
+  const uint8_t* limit = reinterpret_cast<const uint8_t*>(stream_.end());
+  const uint8_t* cursor = start;
+  // Check a word at a time while possible.
+  const uintptr_t non_ascii_mask = ~static_cast<uintptr_t>(0) / 0xFF * 0x80;
+  while (static_cast<size_t>(limit - cursor) >= sizeof(uintptr_t)) {
+    uintptr_t word;
+    memcpy(&word, cursor, sizeof(word));
+    if (word & non_ascii_mask) break;
+    cursor += sizeof(uintptr_t);
+  }
+  while (cursor < limit && *cursor <= Utf8::kMaxOneByteChar) ++cursor;
+  size_t run_length = cursor - start;
+  DCHECK_GT(run_length, 0);
+  cursor_ = offset_ + run_length;
+  ++*this;
+  return run_length;
+}
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const v8::internal::Vector<const char>& stream) {
   size_t utf16_length = 0;
@@ -67,6 +91,8 @@ void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
 
   // Now that writing to buffer is done, we just need to calculate utf16_length
   while (!it.Done()) {
+    utf16_length += it.SkipAscii();
+    if (it.Done()) break;
     ++it;
     utf16_length++;
   }
@@ -79,6 +105,15 @@ void Utf8DecoderBase::WriteUtf16Slow(
     bool trailing) {
   Utf8Iterator it = Utf8Iterator(stream, offset, trailing);
   while (!it.Done()) {
+    size_t ascii_start = it.Offset();
+    size_t ascii_length = it.SkipAscii();
+    DCHECK_LE(ascii_length, length);
+    v8::internal::CopyChars(
+        data, reinterpret_cast<const uint8_t*>(stream.begin()) + ascii_start,
+        ascii_length);
+    data += ascii_length;
+    length -= ascii_length;
+    if (it.Done()) break;
     DCHECK_GT(length--, 0);
     *data++ = *it;
     ++it;
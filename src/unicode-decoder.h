@@ -41,6 +41,10 @@ class Utf8Iterator {
   Utf8Iterator& operator++();
   Utf8Iterator operator++(int);
   bool Done();
+  // If the current character is ASCII, advances past it and the run of ASCII
+  // characters following it, and returns the length of the run. Otherwise
+  // returns 0 and leaves the iterator unchanged.
+  size_t SkipAscii();
   bool Trailing() { return trailing_; }
   size_t Offset() { return offset_; }
 
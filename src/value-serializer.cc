@@ -182,6 +182,40 @@ enum class WasmEncodingTag : uint8_t {
   kRawBytes = 'y',
 };
 
+// Writes an unsigned integer as a base-128 varint to |dest| and returns the
+// position after the last byte written.
+// The number is written, 7 bits at a time, from the least significant to the
+// most significant 7 bits. Each byte, except the last, has the MSB set.
+// See also https://developers.google.com/protocol-buffers/docs/encoding
+template <typename T>
+uint8_t* EncodeVarint(uint8_t* dest, T value) {
+  static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                "Only unsigned integer types can be written as varints.");
+  do {
+    *dest = (value & 0x7F) | 0x80;
+    dest++;
+    value >>= 7;
+  } while (value);
+  *(dest - 1) &= 0x7F;
+  return dest;
+}
+
+// Maps a signed integer to an unsigned one using ZigZag encoding (i.e. 0 is
+// encoded as 0, -1 as 1, 1 as 2, -2 as 3, and so on).
+// Note that this implementation relies on the right shift being arithmetic.
+template <typename T>
+typename std::make_unsigned<T>::type ZigZagEncode(T value) {
+  static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                "Only signed integer types can be written as zigzag.");
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  return (static_cast<UnsignedT>(value) << 1) ^ (value >> (8 * sizeof(T) - 1));
+}
+
+// Upper bounds on the encoded size of a tagged Smi and a tagged double, used
+// to reserve space for packed arrays in one step.
+constexpr size_t kMaxEncodedSmiSize = 1 + (sizeof(int32_t) * 8 / 7 + 1);
+constexpr size_t kEncodedDoubleSize = 1 + sizeof(double);
+
 }  // namespace
 
 ValueSerializer::ValueSerializer(Isolate* isolate,
@@ -219,34 +253,15 @@ void ValueSerializer::WriteTag(SerializationTag tag) {
 
 template <typename T>
 void ValueSerializer::WriteVarint(T value) {
-  // Writes an unsigned integer as a base-128 varint.
-  // The number is written, 7 bits at a time, from the least significant to the
-  // most significant 7 bits. Each byte, except the last, has the MSB set.
-  // See also https://developers.google.com/protocol-buffers/docs/encoding
-  static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
-                "Only unsigned integer types can be written as varints.");
   uint8_t stack_buffer[sizeof(T) * 8 / 7 + 1];
-  uint8_t* next_byte = &stack_buffer[0];
-  do {
-    *next_byte = (value & 0x7F) | 0x80;
-    next_byte++;
-    value >>= 7;
-  } while (value);
-  *(next_byte - 1) &= 0x7F;
-  WriteRawBytes(stack_buffer, next_byte - stack_buffer);
+  uint8_t* end = EncodeVarint(&stack_buffer[0], value);
+  WriteRawBytes(stack_buffer, end - stack_buffer);
 }
 
 template <typename T>
 void ValueSerializer::WriteZigZag(T value) {
-  // Writes a signed integer as a varint using ZigZag encoding (i.e. 0 is
-  // encoded as 0, -1 as 1, 1 as 2, -2 as 3, and so on).
   // See also https://developers.google.com/protocol-buffers/docs/encoding
-  // Note that this implementation relies on the right shift being arithmetic.
-  static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
-                "Only signed integer types can be written as zigzag.");
-  using UnsignedT = typename std::make_unsigned<T>::type;
-  WriteVarint((static_cast<UnsignedT>(value) << 1) ^
-              (value >> (8 * sizeof(T) - 1)));
+  WriteVarint(ZigZagEncode(value));
 }
 
 void ValueSerializer::WriteDouble(double value) {
@@ -623,9 +638,22 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
     // structure of the elements changing.
     switch (array->GetElementsKind()) {
       case PACKED_SMI_ELEMENTS: {
+        // Reserve the worst case once and encode straight into the buffer,
+        // instead of growing it element by element. The unused tail is
+        // given back afterwards.
+        static_assert(kSmiValueSize <= 32, "Expected SMI <= 32 bits.");
         Handle<FixedArray> elements(FixedArray::cast(array->elements()),
                                     isolate_);
-        for (; i < length; i++) WriteSmi(Smi::cast(elements->get(i)));
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * kMaxEncodedSmiSize).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
+        for (; i < length; i++) {
+          *dest++ = static_cast<uint8_t>(SerializationTag::kInt32);
+          dest = EncodeVarint(
+              dest, ZigZagEncode<int32_t>(Smi::ToInt(elements->get(i))));
+        }
+        buffer_size_ = dest - buffer_;
         break;
       }
       case PACKED_DOUBLE_ELEMENTS: {
@@ -634,10 +662,18 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
         if (length == 0) break;
         Handle<FixedDoubleArray> elements(
             FixedDoubleArray::cast(array->elements()), isolate_);
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * kEncodedDoubleSize).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
         for (; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
+          // Warning: this uses host endianness, like WriteDouble.
+          double value = elements->get_scalar(i);
+          *dest++ = static_cast<uint8_t>(SerializationTag::kDouble);
+          memcpy(dest, &value, sizeof(value));
+          dest += sizeof(value);
         }
+        DCHECK_EQ(dest, buffer_ + buffer_size_);
         break;
       }
       case PACKED_ELEMENTS: {
@@ -437,6 +437,16 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLoopLocals() {
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    auto& slot = cache_state_.stack_state[i];
+    // A register can only stay in the loop state if no other slot uses it,
+    // since back edges might bring different values for the two slots.
+    if (slot.is_reg() && cache_state_.get_use_count(slot.reg()) == 1) continue;
+    Spill(i);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
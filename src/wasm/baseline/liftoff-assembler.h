@@ -305,6 +305,9 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(uint32_t index);
   void SpillLocals();
+  // Spills the locals that cannot be kept in registers across a loop header:
+  // constants, and registers shared with other stack slots.
+  void SpillLoopLocals();
   void SpillAllRegisters();
 
   // Call this method whenever spilling something, such that the number of used
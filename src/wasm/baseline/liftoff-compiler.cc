@@ -458,7 +458,14 @@ class LiftoffCompiler {
     // into registers at branches.
     // TODO(clemensh): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    // With --liftoff-loop-register-locals, locals which are already in
+    // registers stay there instead, and back edges move the values back into
+    // those registers.
+    if (FLAG_liftoff_loop_register_locals) {
+      __ SpillLoopLocals();
+    } else {
+      __ SpillLocals();
+    }
 
     // Loop labels bind at the beginning of the block.
     __ bind(loop->label.get());
@@ -518,12 +518,14 @@ class WasmGraphBuildingInterface {
   void MemoryCopy(FullDecoder* decoder,
                   const MemoryIndexImmediate<validate>& imm,
                   Vector<Value> args) {
-    BUILD(Unreachable, decoder->position());
+    BUILD(MemoryCopy, args[0].node, args[1].node, args[2].node,
+          decoder->position());
   }
   void MemoryFill(FullDecoder* decoder,
                   const MemoryIndexImmediate<validate>& imm,
                   Vector<Value> args) {
-    BUILD(Unreachable, decoder->position());
+    BUILD(MemoryFill, args[0].node, args[1].node, args[2].node,
+          decoder->position());
   }
   void TableInit(FullDecoder* decoder, const TableInitImmediate<validate>& imm,
                  Vector<Value> args) {
@@ -132,6 +132,13 @@ class CompilationStateImpl {
     return outstanding_tiering_units_ > 0 || outstanding_baseline_units_ > 0;
   }
 
+  // Returns whether there are units left that no task has taken yet.
+  bool has_units_to_compile() const {
+    base::MutexGuard guard(&mutex_);
+    return !baseline_compilation_units_.empty() ||
+           !tiering_compilation_units_.empty();
+  }
+
   CompileMode compile_mode() const { return compile_mode_; }
   WasmFeatures* detected_features() { return &detected_features_; }
 
@@ -947,13 +954,27 @@ class BackgroundCompileTask : public CancelableTask {
     CompilationEnv env = native_module_->CreateCompilationEnv();
     auto* compilation_state = Impl(native_module_->compilation_state());
     WasmFeatures detected_features = kNoWasmFeatures;
+    int num_units = 0;
+    bool yielded = false;
     while (!compilation_state->failed()) {
       if (!FetchAndExecuteCompilationUnit(&env, compilation_state,
                                           &detected_features, counters_)) {
         break;
       }
+      // Give the worker thread back after a bounded number of units, so
+      // other tasks queued on the platform get to run in between. Without
+      // units left, the next fetch ends the task anyway and there is nothing
+      // for a replacement task to do.
+      if (FLAG_wasm_compilation_task_units > 0 &&
+          ++num_units >= FLAG_wasm_compilation_task_units &&
+          compilation_state->has_units_to_compile()) {
+        yielded = true;
+        break;
+      }
     }
     compilation_state->OnBackgroundTaskStopped(detected_features);
+    // Queue a replacement task behind whatever was posted in the meantime.
+    if (yielded) compilation_state->RestartBackgroundTasks(1);
   }
 
  private:
@@ -3138,10 +3159,15 @@ void CompilationStateImpl::PublishDetectedFeatures(
 
 void CompilationStateImpl::RestartBackgroundTasks(size_t max) {
   size_t num_restart;
+  bool low_priority;
   {
     base::MutexGuard guard(&mutex_);
     // No need to restart tasks if compilation already failed.
     if (compile_error_) return;
+    // Once all baseline units are taken, the remaining work is tier-up, which
+    // should not compete with other work on the worker threads.
+    low_priority = FLAG_wasm_low_priority_tier_up &&
+                   baseline_compilation_units_.empty();
 
     DCHECK_LE(num_background_tasks_, max_background_tasks_);
     if (num_background_tasks_ == max_background_tasks_) return;
@@ -3159,7 +3185,12 @@ void CompilationStateImpl::RestartBackgroundTasks(size_t max) {
     // If --wasm-num-compilation-tasks=0 is passed, do only spawn foreground
     // tasks. This is used to make timing deterministic.
     if (FLAG_wasm_num_compilation_tasks > 0) {
-      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+      if (low_priority) {
+        V8::GetCurrentPlatform()->CallLowPriorityTaskOnWorkerThread(
+            std::move(task));
+      } else {
+        V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+      }
     } else {
       foreground_task_runner_->PostTask(std::move(task));
     }
@@ -4,14 +4,18 @@
 
 #include "src/wasm/module-decoder.h"
 
+#include <atomic>
+
 #include "src/base/functional.h"
 #include "src/base/platform/platform.h"
 #include "src/base/template-utils.h"
+#include "src/cancelable-task.h"
 #include "src/counters.h"
 #include "src/flags.h"
 #include "src/macro-assembler.h"
 #include "src/objects-inl.h"
 #include "src/ostreams.h"
+#include "src/task-utils.h"
 #include "src/v8.h"
 #include "src/wasm/decoder.h"
 #include "src/wasm/function-body-decoder-impl.h"
@@ -830,6 +834,12 @@ class ModuleDecoderImpl : public Decoder {
     uint32_t pos = pc_offset();
     uint32_t functions_count = consume_u32v("functions count");
     CheckFunctionsCount(functions_count, pos);
+    const bool verify_in_parallel =
+        verify_functions && FLAG_wasm_parallel_validation &&
+        !FLAG_trace_wasm_decoder && FLAG_wasm_num_compilation_tasks > 0 &&
+        functions_count > 1 &&
+        V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0;
+    if (verify_in_parallel) verify_functions = false;
     for (uint32_t i = 0; ok() && i < functions_count; ++i) {
       const byte* pos = pc();
       uint32_t size = consume_u32v("body size");
@@ -843,6 +853,58 @@ class ModuleDecoderImpl : public Decoder {
       if (failed()) break;
       DecodeFunctionBody(i, size, offset, verify_functions);
     }
+    if (verify_in_parallel && ok()) {
+      VerifyFunctionBodiesInParallel(module_->signature_zone->allocator());
+    }
+  }
+
+  // Verifies all function bodies on worker threads and the current thread.
+  // The first failing function is verified again with VerifyFunctionBody to
+  // report its error like sequential verification does.
+  void VerifyFunctionBodiesInParallel(AccountingAllocator* allocator) {
+    const WasmModule* module = module_.get();
+    uint32_t first = module->num_imported_functions;
+    uint32_t count = module->num_declared_functions;
+    std::atomic<uint32_t> next_index{0};
+    base::Mutex mutex;
+    uint32_t failed_index = count;
+
+    auto verify = [&]() {
+      for (;;) {
+        uint32_t i = next_index.fetch_add(1);
+        if (i >= count) return;
+        const WasmFunction* function = &module->functions[first + i];
+        FunctionBody body = {
+            function->sig, function->code.offset(),
+            start_ + GetBufferRelativeOffset(function->code.offset()),
+            start_ + GetBufferRelativeOffset(function->code.end_offset())};
+        WasmFeatures unused_detected_features;
+        DecodeResult result = VerifyWasmCode(allocator, enabled_features_,
+                                             module, &unused_detected_features,
+                                             body);
+        if (result.ok()) continue;
+        base::MutexGuard guard(&mutex);
+        failed_index = std::min(failed_index, i);
+      }
+    };
+
+    CancelableTaskManager task_manager;
+    int num_tasks = std::min(FLAG_wasm_num_compilation_tasks,
+                             V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+    for (int i = 0; i < num_tasks; ++i) {
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          MakeCancelableTask(&task_manager, verify));
+    }
+    verify();
+    // Tasks which did not start yet have nothing left to do; wait for the
+    // running ones.
+    task_manager.CancelAndWait();
+
+    if (failed_index < count) {
+      ModuleWireBytes bytes(start_, end_);
+      VerifyFunctionBody(allocator, first + failed_index, bytes, module,
+                         &module_->functions[first + failed_index]);
+    }
   }
 
   bool CheckFunctionsCount(uint32_t functions_count, uint32_t offset) {
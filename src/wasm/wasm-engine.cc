@@ -26,6 +26,8 @@ WasmEngine::~WasmEngine() {
   DCHECK(jobs_.empty());
   // All Isolates have been deregistered.
   DCHECK(isolates_.empty());
+  // No compilation for the native module cache is in flight.
+  DCHECK(native_modules_in_flight_.empty());
 }
 
 bool WasmEngine::SyncValidate(Isolate* isolate, const WasmFeatures& enabled,
@@ -84,9 +86,84 @@ Handle<WasmModuleObject> WasmEngine::FinalizeTranslatedAsmJs(
   return module_object;
 }
 
+namespace {
+
+bool HaveSameFeatures(const WasmFeatures& a, const WasmFeatures& b) {
+#define SPACE
+#define COMPARE_FEATURE(feat, desc, val) \
+  if (a.feat != b.feat) return false;
+  FOREACH_WASM_FEATURE(COMPARE_FEATURE, SPACE)
+#undef COMPARE_FEATURE
+#undef SPACE
+  return true;
+}
+
+}  // namespace
+
+std::shared_ptr<NativeModule> WasmEngine::GetCachedNativeModule(
+    const WasmFeatures& enabled, Vector<const byte> wire_bytes, size_t hash) {
+  base::MutexGuard guard(&mutex_);
+  while (native_modules_in_flight_.count(hash) != 0) {
+    native_module_cache_cv_.Wait(&mutex_);
+  }
+  auto range = native_module_cache_.equal_range(hash);
+  for (auto it = range.first; it != range.second;) {
+    std::shared_ptr<NativeModule> module = it->second.lock();
+    if (!module) {
+      it = native_module_cache_.erase(it);
+      continue;
+    }
+    Vector<const byte> cached_bytes = module->wire_bytes();
+    if (cached_bytes.length() == wire_bytes.length() &&
+        memcmp(cached_bytes.start(), wire_bytes.start(),
+               wire_bytes.length()) == 0 &&
+        HaveSameFeatures(module->enabled_features(), enabled)) {
+      return module;
+    }
+    ++it;
+  }
+  native_modules_in_flight_.insert(hash);
+  return nullptr;
+}
+
+void WasmEngine::FinishNativeModuleCompilation(
+    size_t hash, std::shared_ptr<NativeModule> module) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(1, native_modules_in_flight_.count(hash));
+  native_modules_in_flight_.erase(hash);
+  if (module) native_module_cache_.emplace(hash, module);
+  native_module_cache_cv_.NotifyAll();
+}
+
 MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
     const ModuleWireBytes& bytes) {
+  if (FLAG_wasm_native_module_cache && FLAG_wasm_shared_code) {
+    size_t hash = base::hash_range(bytes.start(), bytes.end());
+    std::shared_ptr<NativeModule> cached =
+        GetCachedNativeModule(enabled, bytes.module_bytes(), hash);
+    if (cached) {
+      Handle<WasmModuleObject> module_object =
+          ImportNativeModule(isolate, std::move(cached));
+      isolate->debug()->OnAfterCompile(
+          handle(module_object->script(), isolate));
+      return module_object;
+    }
+    MaybeHandle<WasmModuleObject> maybe_module_object =
+        SyncCompileNativeModule(isolate, enabled, thrower, bytes);
+    Handle<WasmModuleObject> module_object;
+    FinishNativeModuleCompilation(
+        hash, maybe_module_object.ToHandle(&module_object)
+                  ? ExportNativeModule(module_object)
+                  : nullptr);
+    return maybe_module_object;
+  }
+  return SyncCompileNativeModule(isolate, enabled, thrower, bytes);
+}
+
+MaybeHandle<WasmModuleObject> WasmEngine::SyncCompileNativeModule(
+    Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
+    const ModuleWireBytes& bytes) {
   ModuleResult result =
       DecodeWasmModule(enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
                        isolate->counters(), allocator());
@@ -6,8 +6,10 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "src/base/platform/condition-variable.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-memory.h"
 #include "src/wasm/wasm-tier.h"
@@ -154,12 +156,26 @@ class V8_EXPORT_PRIVATE WasmEngine {
   static std::shared_ptr<WasmEngine> GetWasmEngine();
 
  private:
+  MaybeHandle<WasmModuleObject> SyncCompileNativeModule(
+      Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
+      const ModuleWireBytes& bytes);
+
   AsyncCompileJob* CreateAsyncCompileJob(
       Isolate* isolate, const WasmFeatures& enabled,
       std::unique_ptr<byte[]> bytes_copy, size_t length,
       Handle<Context> context,
       std::shared_ptr<CompilationResultResolver> resolver);
 
+  // Returns a live native module compiled from the same bytes with the same
+  // features, or nullptr. If an identical module is currently compiled by
+  // another thread, waits for that compilation to finish first. Otherwise
+  // the caller is expected to compile the module and report the result to
+  // {FinishNativeModuleCompilation}.
+  std::shared_ptr<NativeModule> GetCachedNativeModule(
+      const WasmFeatures& enabled, Vector<const byte> wire_bytes, size_t hash);
+  void FinishNativeModuleCompilation(size_t hash,
+                                     std::shared_ptr<NativeModule> module);
+
   WasmMemoryTracker memory_tracker_;
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
@@ -181,6 +197,16 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // Set of isolates which use this WasmEngine. Used for cross-isolate GCs.
   std::unordered_set<Isolate*> isolates_;
 
+  // Native modules compiled by {SyncCompile}, keyed by the hash of their
+  // wire bytes. The cache does not keep modules alive.
+  std::unordered_multimap<size_t, std::weak_ptr<NativeModule>>
+      native_module_cache_;
+
+  // Hashes of modules currently being compiled for the cache. Threads
+  // compiling an identical module wait on {native_module_cache_cv_}.
+  std::unordered_set<size_t> native_modules_in_flight_;
+  base::ConditionVariable native_module_cache_cv_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -27,6 +27,58 @@ void AddAllocationStatusSample(Isolate* isolate,
       static_cast<int>(status));
 }
 
+// For guard regions, we always allocate the largest possible offset into the
+// heap, so the addressable memory after the guard page can be made
+// inaccessible.
+//
+// To protect against 32-bit integer overflow issues, we also protect the 2GiB
+// before the valid part of the memory buffer.
+size_t FullGuardRegionsAllocationLength() {
+  return RoundUp(kWasmMaxHeapOffset + kNegativeGuardSize, CommitPageSize());
+}
+
+void* CommitBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
+                         size_t size, void* allocation_base,
+                         size_t allocation_length,
+                         bool require_full_guard_regions,
+                         WasmMemoryTracker::AllocationStatus status) {
+  byte* memory = reinterpret_cast<byte*>(allocation_base);
+  if (require_full_guard_regions) {
+    memory += kNegativeGuardSize;
+  }
+
+  // Make the part we care about accessible.
+  if (size > 0) {
+    bool result =
+        SetPermissions(GetPlatformPageAllocator(), memory,
+                       RoundUp(size, kWasmPageSize), PageAllocator::kReadWrite);
+    // SetPermissions commits the extra memory, which may put us over the
+    // process memory limit. If so, report this as an OOM.
+    if (!result) {
+      V8::FatalProcessOutOfMemory(nullptr, "TryAllocateBackingStore");
+    }
+  }
+
+  memory_tracker->RegisterAllocation(heap->isolate(), allocation_base,
+                                     allocation_length, memory, size);
+  AddAllocationStatusSample(heap->isolate(), status);
+  return memory;
+}
+
+// Pooled pages were only discarded, which does not guarantee that they read as
+// zero again. Clear the pages the previous memory used before handing them out.
+void ClearPooledReservation(void* allocation_base, size_t dirty_length) {
+  if (dirty_length == 0) return;
+  byte* memory = reinterpret_cast<byte*>(allocation_base) + kNegativeGuardSize;
+  if (!SetPermissions(GetPlatformPageAllocator(), memory, dirty_length,
+                      PageAllocator::kReadWrite)) {
+    V8::FatalProcessOutOfMemory(nullptr, "TryAllocateBackingStore");
+  }
+  memset(memory, 0, dirty_length);
+  CHECK(SetPermissions(GetPlatformPageAllocator(), memory, dirty_length,
+                       PageAllocator::kNoAccess));
+}
+
 void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
                               size_t size, void** allocation_base,
                               size_t* allocation_length) {
@@ -36,6 +88,21 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
 #else
   bool require_full_guard_regions = false;
 #endif
+  // Reuse a reservation released by an earlier memory if there is one. Its
+  // address space is still accounted for.
+  DCHECK_NULL(*allocation_base);
+  if (require_full_guard_regions) {
+    *allocation_length = FullGuardRegionsAllocationLength();
+    size_t dirty_length = 0;
+    *allocation_base = memory_tracker->TakePooledReservation(
+        *allocation_length, &dirty_length);
+    if (*allocation_base != nullptr) {
+      ClearPooledReservation(*allocation_base, dirty_length);
+      return CommitBackingStore(memory_tracker, heap, size, *allocation_base,
+                                *allocation_length, require_full_guard_regions,
+                                AllocationStatus::kSuccess);
+    }
+  }
   // Let the WasmMemoryTracker know we are going to reserve a bunch of
   // address space.
   // Try up to three times; getting rid of dead JSArrayBuffer allocations might
@@ -44,16 +111,10 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
   static constexpr int kAllocationRetries = 2;
   bool did_retry = false;
   for (int trial = 0;; ++trial) {
-    // For guard regions, we always allocate the largest possible offset into
-    // the heap, so the addressable memory after the guard page can be made
-    // inaccessible.
-    //
-    // To protect against 32-bit integer overflow issues, we also protect the
-    // 2GiB before the valid part of the memory buffer.
     // TODO(7881): do not use static_cast<uint32_t>() here
     *allocation_length =
         require_full_guard_regions
-            ? RoundUp(kWasmMaxHeapOffset + kNegativeGuardSize, CommitPageSize())
+            ? FullGuardRegionsAllocationLength()
             : RoundUp(base::bits::RoundUpToPowerOfTwo32(
                           static_cast<uint32_t>(size)),
                       kWasmPageSize);
@@ -64,6 +125,9 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
                                             : WasmMemoryTracker::kHardLimit;
     if (memory_tracker->ReserveAddressSpace(*allocation_length, limit)) break;
 
+    // Pooled reservations count against the limit; give them up first.
+    if (memory_tracker->FreePooledReservations()) continue;
+
     did_retry = true;
     // After first and second GC: retry.
     if (trial == kAllocationRetries) {
@@ -93,7 +157,6 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
   }
 
   // The Reserve makes the whole region inaccessible by default.
-  DCHECK_NULL(*allocation_base);
   for (int trial = 0;; ++trial) {
     *allocation_base =
         AllocatePages(GetPlatformPageAllocator(), nullptr, *allocation_length,
@@ -107,29 +170,10 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
     }
     heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
   }
-  byte* memory = reinterpret_cast<byte*>(*allocation_base);
-  if (require_full_guard_regions) {
-    memory += kNegativeGuardSize;
-  }
-
-  // Make the part we care about accessible.
-  if (size > 0) {
-    bool result =
-        SetPermissions(GetPlatformPageAllocator(), memory,
-                       RoundUp(size, kWasmPageSize), PageAllocator::kReadWrite);
-    // SetPermissions commits the extra memory, which may put us over the
-    // process memory limit. If so, report this as an OOM.
-    if (!result) {
-      V8::FatalProcessOutOfMemory(nullptr, "TryAllocateBackingStore");
-    }
-  }
-
-  memory_tracker->RegisterAllocation(heap->isolate(), *allocation_base,
-                                     *allocation_length, memory, size);
-  AddAllocationStatusSample(heap->isolate(),
+  return CommitBackingStore(memory_tracker, heap, size, *allocation_base,
+                            *allocation_length, require_full_guard_regions,
                             did_retry ? AllocationStatus::kSuccessAfterRetry
                                       : AllocationStatus::kSuccess);
-  return memory;
 }
 
 #if V8_TARGET_ARCH_MIPS64
@@ -148,6 +192,7 @@ constexpr size_t kAddressSpaceHardLimit = 0xC0000000;  // 3 GiB
 }  // namespace
 
 WasmMemoryTracker::~WasmMemoryTracker() {
+  FreePooledReservations();
   // All reserved address space should be released before the allocation tracker
   // is destroyed.
   DCHECK_EQ(reserved_address_space_, 0u);
@@ -259,17 +304,88 @@ bool WasmMemoryTracker::HasFullGuardRegions(const void* buffer_start) {
   return start + kWasmMaxHeapOffset < limit;
 }
 
+void WasmMemoryTracker::UpdateBufferLength(const void* buffer_start,
+                                           size_t buffer_length) {
+  base::MutexGuard scope_lock(&mutex_);
+  auto find_result = allocations_.find(buffer_start);
+  if (find_result == allocations_.end()) return;
+  find_result->second.buffer_length = buffer_length;
+}
+
 bool WasmMemoryTracker::FreeMemoryIfIsWasmMemory(Isolate* isolate,
                                                  const void* buffer_start) {
   if (IsWasmMemory(buffer_start)) {
     const AllocationData allocation = ReleaseAllocation(isolate, buffer_start);
-    CHECK(FreePages(GetPlatformPageAllocator(), allocation.allocation_base,
-                    allocation.allocation_length));
+    if (!PoolReservation(allocation)) {
+      CHECK(FreePages(GetPlatformPageAllocator(), allocation.allocation_base,
+                      allocation.allocation_length));
+    }
     return true;
   }
   return false;
 }
 
+bool WasmMemoryTracker::PoolReservation(const AllocationData& allocation) {
+  if (FLAG_wasm_memory_reservation_pool_size <= 0) return false;
+  // Only reservations with full guard regions all have the same size.
+  if (allocation.allocation_length != FullGuardRegionsAllocationLength()) {
+    return false;
+  }
+  // Check the pool size first and insert under the same lock, so that
+  // concurrent frees cannot grow the pool beyond its limit.
+  base::MutexGuard scope_lock(&mutex_);
+  if (pooled_reservations_.size() >=
+      static_cast<size_t>(FLAG_wasm_memory_reservation_pool_size)) {
+    return false;
+  }
+  // Keep the address space accounted for while it sits in the pool, so the
+  // pool stays within the reservation limits.
+  if (!ReserveAddressSpace(allocation.allocation_length, kHardLimit)) {
+    return false;
+  }
+  // Drop the access to the committed part of the memory, which also discards
+  // its pages. The rest of the reservation was never accessible. The pages
+  // are cleared when the reservation is reused.
+  size_t dirty_length = RoundUp(allocation.buffer_length, CommitPageSize());
+  DCHECK_LE(reinterpret_cast<uintptr_t>(allocation.buffer_start) +
+                dirty_length,
+            reinterpret_cast<uintptr_t>(allocation.allocation_base) +
+                allocation.allocation_length);
+  if (dirty_length > 0) {
+    CHECK(SetPermissions(GetPlatformPageAllocator(), allocation.buffer_start,
+                         dirty_length, PageAllocator::kNoAccess));
+  }
+  pooled_reservations_.push_back({allocation.allocation_base, dirty_length});
+  return true;
+}
+
+void* WasmMemoryTracker::TakePooledReservation(size_t allocation_length,
+                                                size_t* dirty_length) {
+  DCHECK_EQ(FullGuardRegionsAllocationLength(), allocation_length);
+  USE(allocation_length);
+  base::MutexGuard scope_lock(&mutex_);
+  if (pooled_reservations_.empty()) return nullptr;
+  PooledReservation reservation = pooled_reservations_.back();
+  pooled_reservations_.pop_back();
+  *dirty_length = reservation.dirty_length;
+  return reservation.allocation_base;
+}
+
+bool WasmMemoryTracker::FreePooledReservations() {
+  std::vector<PooledReservation> reservations;
+  {
+    base::MutexGuard scope_lock(&mutex_);
+    reservations.swap(pooled_reservations_);
+  }
+  size_t allocation_length = FullGuardRegionsAllocationLength();
+  for (const PooledReservation& reservation : reservations) {
+    CHECK(FreePages(GetPlatformPageAllocator(), reservation.allocation_base,
+                    allocation_length));
+    ReleaseReservation(allocation_length);
+  }
+  return !reservations.empty();
+}
+
 void WasmMemoryTracker::AddAddressSpaceSample(Isolate* isolate) {
   // Report address space usage in MiB so the full range fits in an int on all
   // platforms.
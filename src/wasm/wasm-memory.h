@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <unordered_map>
+#include <vector>
 
 #include "src/base/platform/mutex.h"
 #include "src/flags.h"
@@ -94,11 +95,26 @@ class WasmMemoryTracker {
   // buffer is not tracked.
   const AllocationData* FindAllocationData(const void* buffer_start);
 
+  // Records that the accessible part of a Wasm memory grew in place.
+  void UpdateBufferLength(const void* buffer_start, size_t buffer_length);
+
   // Checks if a buffer points to a Wasm memory and if so does any necessary
   // work to reclaim the buffer. If this function returns false, the caller must
   // free the buffer manually.
+  // With --wasm-memory-reservation-pool-size, the reservation may be kept for
+  // reuse by the next allocation instead of being unmapped.
   bool FreeMemoryIfIsWasmMemory(Isolate* isolate, const void* buffer_start);
 
+  // Returns the base of a pooled reservation of {allocation_length} bytes, or
+  // nullptr if the pool is empty. The reservation stays accounted for.
+  // {dirty_length} is set to the number of bytes after the negative guard
+  // region that the previous memory used and that still need clearing.
+  void* TakePooledReservation(size_t allocation_length, size_t* dirty_length);
+
+  // Unmaps all pooled reservations and releases their address space. Returns
+  // whether there were any.
+  bool FreePooledReservations();
+
   // Allocation results are reported to UMA
   //
   // See wasm_memory_allocation_result in counters.h
@@ -116,6 +132,11 @@ class WasmMemoryTracker {
  private:
   void AddAddressSpaceSample(Isolate* isolate);
 
+  // Discards the pages of a released allocation and keeps its reservation in
+  // the pool. Returns false if the reservation cannot be pooled and must be
+  // freed.
+  bool PoolReservation(const AllocationData& allocation);
+
   // Clients use a two-part process. First they "reserve" the address space,
   // which signifies an intent to actually allocate it. This determines whether
   // doing the allocation would put us over our limit. Once there is a
@@ -136,6 +157,14 @@ class WasmMemoryTracker {
   // buffer, rather than by the start of the allocation.
   std::unordered_map<const void*, AllocationData> allocations_;
 
+  // Released reservations with full guard regions which are kept mapped and
+  // inaccessible for reuse. Protected by {mutex_}.
+  struct PooledReservation {
+    void* allocation_base;
+    size_t dirty_length;
+  };
+  std::vector<PooledReservation> pooled_reservations_;
+
   DISALLOW_COPY_AND_ASSIGN(WasmMemoryTracker);
 };
 
@@ -904,6 +904,8 @@ MaybeHandle<JSArrayBuffer> MemoryGrowBuffer(Isolate* isolate,
       DCHECK_GE(new_size, old_size);
       reinterpret_cast<v8::Isolate*>(isolate)
           ->AdjustAmountOfExternalAllocatedMemory(new_size - old_size);
+      isolate->wasm_engine()->memory_tracker()->UpdateBufferLength(
+          old_mem_start, new_size);
     }
     // NOTE: We must allocate a new array buffer here because the spec
     // assumes that ArrayBuffers do not change size.
@@ -11,6 +11,7 @@
 #endif
 
 #include "src/allocation.h"
+#include "src/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -72,7 +73,8 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
 }
 
 Segment* AccountingAllocator::GetSegment(size_t bytes) {
-  Segment* result = GetSegmentFromPool(bytes);
+  Segment* result = bytes == kLargeSegmentSize ? GetLargeSegmentFromPool()
+                                               : GetSegmentFromPool(bytes);
   if (result == nullptr) {
     result = AllocateSegment(bytes);
     if (result != nullptr) {
@@ -101,6 +103,8 @@ void AccountingAllocator::ReturnSegment(Segment* segment) {
 
   if (memory_pressure_level_.Value() != MemoryPressureLevel::kNone) {
     FreeSegment(segment);
+  } else if (segment->size() == kLargeSegmentSize) {
+    if (!AddLargeSegmentToPool(segment)) FreeSegment(segment);
   } else if (!AddSegmentToPool(segment)) {
     FreeSegment(segment);
   }
@@ -188,9 +192,47 @@ bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
   return true;
 }
 
+Segment* AccountingAllocator::GetLargeSegmentFromPool() {
+  base::MutexGuard lock_guard(&unused_segments_mutex_);
+  Segment* segment = unused_large_segments_head_;
+  if (segment != nullptr) {
+    unused_large_segments_head_ = segment->next();
+    segment->set_next(nullptr);
+    unused_large_segments_size_--;
+    base::Relaxed_AtomicIncrement(
+        &current_pool_size_, -static_cast<base::AtomicWord>(segment->size()));
+  }
+  return segment;
+}
+
+bool AccountingAllocator::AddLargeSegmentToPool(Segment* segment) {
+  DCHECK_EQ(kLargeSegmentSize, segment->size());
+  base::MutexGuard lock_guard(&unused_segments_mutex_);
+  if (unused_large_segments_size_ >=
+      FLAG_zone_large_segment_pool_size / kLargeSegmentSize) {
+    return false;
+  }
+  segment->set_next(unused_large_segments_head_);
+  unused_large_segments_head_ = segment;
+  base::Relaxed_AtomicIncrement(&current_pool_size_, segment->size());
+  unused_large_segments_size_++;
+  return true;
+}
+
 void AccountingAllocator::ClearPool() {
   base::MutexGuard lock_guard(&unused_segments_mutex_);
 
+  Segment* large = unused_large_segments_head_;
+  while (large) {
+    Segment* next = large->next();
+    base::Relaxed_AtomicIncrement(
+        &current_pool_size_, -static_cast<base::AtomicWord>(large->size()));
+    FreeSegment(large);
+    large = next;
+  }
+  unused_large_segments_head_ = nullptr;
+  unused_large_segments_size_ = 0;
+
   for (size_t power = 0; power <= kMaxSegmentSizePower - kMinSegmentSizePower;
        power++) {
     Segment* current = unused_segments_heads_[power];
@@ -22,6 +22,10 @@ namespace internal {
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
   static const size_t kMaxPoolSize = 8ul * KB;
+  // Segments of this size are pooled separately. Large zones, e.g. TurboFan
+  // graph zones, keep allocating segments of Zone::kMaximumSegmentSize once
+  // they have grown.
+  static const size_t kLargeSegmentSize = 1ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -67,6 +71,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // Trys to add a segment to the pool. Returns false if the pool is full.
   bool AddSegmentToPool(Segment* segment);
 
+  // Same as above for segments of kLargeSegmentSize. The number of pooled
+  // large segments is bounded by --zone-large-segment-pool-size.
+  Segment* GetLargeSegmentFromPool();
+  bool AddLargeSegmentToPool(Segment* segment);
+
   // Empties the pool and puts all its contents onto the garbage stack.
   void ClearPool();
 
@@ -75,6 +84,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   size_t unused_segments_sizes_[kNumberBuckets];
   size_t unused_segments_max_sizes_[kNumberBuckets];
 
+  Segment* unused_large_segments_head_ = nullptr;
+  size_t unused_large_segments_size_ = 0;
+
   base::Mutex unused_segments_mutex_;
 
   base::AtomicWord current_memory_usage_ = 0;
@@ -138,6 +138,8 @@ Address Zone::NewExpand(size_t size) {
     V8::FatalProcessOutOfMemory(nullptr, "Zone");
     return kNullAddress;
   }
+  // Segments of the maximum size are pooled separately by the allocator.
+  STATIC_ASSERT(kMaximumSegmentSize == AccountingAllocator::kLargeSegmentSize);
   if (segment_size_ == SegmentSize::kLarge) {
     new_size = kMaximumSegmentSize;
   }
@@ -197,6 +197,36 @@ TEST(InstructionGetBasicBlock) {
 }
 
 
+TEST(InstructionColdExitsLaidOutOfLine) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.NewBasicBlock();
+  BasicBlock* b2 = R.schedule.NewBasicBlock();
+  BasicBlock* b3 = R.schedule.end();
+
+  Node* start = R.graph.NewNode(R.common.Start(0));
+  Node* branch = R.graph.NewNode(R.common.Branch(), R.Int32Constant(1), start);
+  R.schedule.AddBranch(b0, branch, b1, b2);
+  R.schedule.AddDeoptimize(b1, R.NewNode(b1));
+  R.schedule.AddGoto(b2, b3);
+
+  R.allocCode();
+
+  CHECK(!R.BlockAt(b0)->is_cold_exit());
+  CHECK(R.BlockAt(b1)->is_cold_exit());
+  CHECK(!R.BlockAt(b2)->is_cold_exit());
+  CHECK(!R.BlockAt(b1)->IsDeferred());
+
+  // The deoptimizing block is placed after every other block.
+  CHECK_EQ(0, R.BlockAt(b0)->ao_number().ToInt());
+  CHECK_LT(R.BlockAt(b2)->ao_number().ToInt(),
+           R.BlockAt(b1)->ao_number().ToInt());
+  CHECK_LT(R.BlockAt(b3)->ao_number().ToInt(),
+           R.BlockAt(b1)->ao_number().ToInt());
+}
+
+
 TEST(InstructionIsGapAt) {
   InstructionTester R;
 
@@ -6334,8 +6334,78 @@ TEST(RunCallCFunction9) {
     CHECK_EQ(x * 9 + 36, m.Call(x));
   }
 }
+
+// Keeps more values live across a C call than there are registers, so the
+// allocator sees the call's fixed ranges as inactive ranges that start after
+// the range being allocated.
+TEST(RunManyValuesLiveAcrossCFunctionCall) {
+  static const int kNumValues = 16;
+  auto* foo1_ptr = &foo1;
+  RawMachineAssemblerTester<int32_t> m(MachineType::Int32());
+  Node* param = m.Parameter(0);
+  Node* values[kNumValues];
+  for (int i = 0; i < kNumValues; ++i) {
+    values[i] = m.Int32Mul(param, m.Int32Constant(2 * i + 1));
+  }
+  Node* function = m.LoadFromPointer(&foo1_ptr, MachineType::Pointer());
+  Node* sum = m.CallCFunction1(MachineType::Int32(), MachineType::Int32(),
+                               function, values[kNumValues - 1]);
+  for (int i = 0; i < kNumValues; ++i) {
+    sum = m.Int32Add(sum, values[i]);
+  }
+  m.Return(sum);
+  FOR_INT32_INPUTS(i) {
+    uint32_t const x = static_cast<uint32_t>(*i);
+    uint32_t expected = x * (2 * kNumValues - 1);
+    for (int j = 0; j < kNumValues; ++j) expected += x * (2 * j + 1);
+    CHECK_EQ(static_cast<int32_t>(expected), m.Call(*i));
+  }
+}
 #endif  // USE_SIMULATOR
 
+
+// Same register pressure without calls: the inactive ranges come from phis
+// bundled with their inputs, and have to be intersected with the range.
+TEST(RunManyPhisUnderRegisterPressure) {
+  static const int kNumValues = 16;
+  RawMachineAssemblerTester<int32_t> m(MachineType::Int32(),
+                                       MachineType::Int32());
+  Node* cond = m.Parameter(0);
+  Node* param = m.Parameter(1);
+  RawMachineLabel blocka, blockb, end;
+  Node* a_values[kNumValues];
+  Node* b_values[kNumValues];
+  m.Branch(cond, &blocka, &blockb);
+  m.Bind(&blocka);
+  for (int i = 0; i < kNumValues; ++i) {
+    a_values[i] = m.Int32Mul(param, m.Int32Constant(2 * i + 1));
+  }
+  m.Goto(&end);
+  m.Bind(&blockb);
+  for (int i = 0; i < kNumValues; ++i) {
+    b_values[i] = m.Int32Add(param, m.Int32Constant(i));
+  }
+  m.Goto(&end);
+  m.Bind(&end);
+  Node* sum = m.Int32Constant(0);
+  for (int i = 0; i < kNumValues; ++i) {
+    sum = m.Int32Add(sum, m.Phi(MachineRepresentation::kWord32, a_values[i],
+                                b_values[i]));
+  }
+  m.Return(sum);
+  FOR_INT32_INPUTS(i) {
+    uint32_t const x = static_cast<uint32_t>(*i);
+    uint32_t expected_a = 0;
+    uint32_t expected_b = 0;
+    for (int j = 0; j < kNumValues; ++j) {
+      expected_a += x * (2 * j + 1);
+      expected_b += x + j;
+    }
+    CHECK_EQ(static_cast<int32_t>(expected_a), m.Call(1, *i));
+    CHECK_EQ(static_cast<int32_t>(expected_b), m.Call(0, *i));
+  }
+}
+
 #if V8_TARGET_ARCH_64_BIT
 // TODO(titzer): run int64 tests on all platforms when supported.
 
@@ -29,6 +29,7 @@
   V(InvalidatedSlotsSomeInvalidatedRanges)                \
   V(TestNewSpaceRefsInCopiedCode)                         \
   V(GCFlags)                                              \
+  V(HeapGrowingPolicyEnvelopeExceeded)                    \
   V(MarkCompactCollector)                                 \
   V(NoPromotion)                                          \
   V(NumberStringCacheSize)                                \
@@ -4,6 +4,7 @@
 
 #include "include/v8.h"
 #include "src/api-inl.h"
+#include "src/base/platform/mutex.h"
 #include "src/objects-inl.h"
 #include "src/objects/module.h"
 #include "src/objects/script.h"
@@ -37,14 +38,21 @@ v8::Local<v8::Object> ConstructTraceableJSApiObject(
 
 class TestEmbedderHeapTracer final : public v8::EmbedderHeapTracer {
  public:
-  explicit TestEmbedderHeapTracer(v8::Isolate* isolate) : isolate_(isolate) {}
+  explicit TestEmbedderHeapTracer(v8::Isolate* isolate,
+                                  bool concurrent_registration = false)
+      : isolate_(isolate), concurrent_registration_(concurrent_registration) {}
 
   void RegisterV8References(
       const std::vector<std::pair<void*, void*>>& embedder_fields) final {
+    base::MutexGuard guard(&mutex_);
     registered_from_v8_.insert(registered_from_v8_.end(),
                                embedder_fields.begin(), embedder_fields.end());
   }
 
+  bool SupportsConcurrentRegistration() final {
+    return concurrent_registration_;
+  }
+
   void AddReferenceForTracing(v8::Persistent<v8::Object>* persistent) {
     to_register_with_v8_.push_back(persistent);
   }
@@ -64,7 +72,8 @@ class TestEmbedderHeapTracer final : public v8::EmbedderHeapTracer {
   void AbortTracing() final {}
   void EnterFinalPause(EmbedderStackState) final {}
 
-  bool IsRegisteredFromV8(void* first_field) const {
+  bool IsRegisteredFromV8(void* first_field) {
+    base::MutexGuard guard(&mutex_);
     for (auto pair : registered_from_v8_) {
       if (pair.first == first_field) return true;
     }
@@ -73,6 +82,8 @@ class TestEmbedderHeapTracer final : public v8::EmbedderHeapTracer {
 
  private:
   v8::Isolate* const isolate_;
+  const bool concurrent_registration_;
+  base::Mutex mutex_;
   std::vector<std::pair<void*, void*>> registered_from_v8_;
   std::vector<v8::Persistent<v8::Object>*> to_register_with_v8_;
 };
@@ -115,6 +126,26 @@ TEST(V8RegisteringEmbedderReference) {
   CHECK(tracer.IsRegisteredFromV8(first_field));
 }
 
+TEST(V8RegisteringEmbedderReferenceConcurrently) {
+  // Tests that wrappers are registered with embedder heap tracers that accept
+  // references from concurrent marking tasks.
+  ManualGCScope manual_gc;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  TestEmbedderHeapTracer tracer(isolate, true);
+  TemporaryEmbedderHeapTracerScope tracer_scope(isolate, &tracer);
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  void* first_field = reinterpret_cast<void*>(0x2);
+  v8::Local<v8::Object> api_object =
+      ConstructTraceableJSApiObject(context, first_field, nullptr);
+  CHECK(!api_object.IsEmpty());
+  CcTest::CollectGarbage(i::OLD_SPACE);
+  CHECK(tracer.IsRegisteredFromV8(first_field));
+}
+
 TEST(EmbedderRegisteringV8Reference) {
   // Tests that references that are registered by the embedder heap tracer are
   // considered live by V8.
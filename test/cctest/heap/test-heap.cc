@@ -44,6 +44,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/remembered-set.h"
+#include "src/heap/store-buffer.h"
 #include "src/ic/ic.h"
 #include "src/macro-assembler-inl.h"
 #include "src/objects-inl.h"
@@ -5812,6 +5813,34 @@ TEST(YoungGenerationLargeObjectAllocationReleaseScavenger) {
   CHECK_EQ(0, isolate->heap()->lo_space()->SizeOfObjects());
 }
 
+TEST(YoungGenerationLargeObjectCapacityTriggersScavenge) {
+  if (FLAG_minor_mc) return;
+  FLAG_young_generation_large_objects = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+  if (!isolate->serializer_enabled()) return;
+
+  Handle<FixedArray> first = isolate->factory()->NewFixedArray(200000);
+  CHECK_EQ(NEW_LO_SPACE,
+           MemoryChunk::FromAddress(first->address())->owner()->identity());
+  int scavenges_before = heap->gc_count();
+
+  // Filling the young generation large object space beyond its capacity
+  // promotes the surviving large objects by page instead of growing it.
+  size_t capacity = heap->new_lo_space()->Available() + first->Size();
+  for (size_t allocated = first->Size(); allocated <= capacity;) {
+    Handle<FixedArray> array = isolate->factory()->NewFixedArray(200000);
+    allocated += array->Size();
+  }
+  CHECK_LT(scavenges_before, heap->gc_count());
+  MemoryChunk* chunk = MemoryChunk::FromAddress(first->address());
+  CHECK_EQ(LO_SPACE, chunk->owner()->identity());
+  CHECK(!chunk->IsFlagSet(MemoryChunk::IN_TO_SPACE));
+  CHECK_GE(capacity, heap->new_lo_space()->SizeOfObjects());
+}
+
 TEST(UncommitUnusedLargeObjectMemory) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
@@ -6052,6 +6081,35 @@ TEST(Regress6800LargeObject) {
                   MemoryChunk::FromAddress(root->address())));
 }
 
+TEST(StoreBufferOverflowStatistics) {
+  FLAG_concurrent_store_buffer = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope handle_scope(isolate);
+  StoreBuffer* store_buffer = CcTest::heap()->store_buffer();
+  store_buffer->MoveAllEntriesToRememberedSet();
+
+  // Fill one buffer more than the whole ring so that without the concurrent
+  // task the main thread has to move entries itself.
+  const int kEntriesPerBuffer = StoreBuffer::kStoreBufferSize / kPointerSize;
+  const int kLength = kEntriesPerBuffer * (StoreBuffer::kStoreBuffers + 1);
+  Handle<FixedArray> root = isolate->factory()->NewFixedArray(kLength, TENURED);
+  Handle<FixedArray> new_space_array = isolate->factory()->NewFixedArray(1);
+  CHECK(Heap::InNewSpace(*new_space_array));
+  int overflows = store_buffer->overflows();
+  int blocking_overflows = store_buffer->blocking_overflows();
+  for (int i = 0; i < kLength; i++) {
+    root->set(i, *new_space_array);
+  }
+  CHECK_LE(overflows + StoreBuffer::kStoreBuffers, store_buffer->overflows());
+  CHECK_LE(blocking_overflows + 1, store_buffer->blocking_overflows());
+  store_buffer->MoveAllEntriesToRememberedSet();
+  CHECK(store_buffer->Empty());
+  CHECK(RememberedSet<OLD_TO_NEW>::Contains(
+      MemoryChunk::FromHeapObject(*root),
+      root->RawFieldOfElementAt(kLength - 1).address()));
+}
+
 HEAP_TEST(RegressMissingWriteBarrierInAllocate) {
   if (!FLAG_incremental_marking) return;
   ManualGCScope manual_gc_scope;
@@ -6348,6 +6406,128 @@ TEST(Regress8014) {
   CHECK_LE(heap->ms_count(), ms_count + 10);
 }
 
+TEST(FlushOldBytecodeOnMemoryPressure) {
+  if (FLAG_always_opt) return;
+  FLAG_flush_bytecode_on_memory_pressure = true;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::Context> ctx = CcTest::isolate()->GetCurrentContext();
+  CompileRun("function f() { return 42; }; f();");
+  i::Handle<JSFunction> f = i::Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+          CcTest::global()->Get(ctx, v8_str("f")).ToLocalChecked())));
+  CHECK(f->shared()->is_compiled());
+
+  // Pretend that several GCs happened since f last ran.
+  f->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kLastBytecodeAge);
+  heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
+  CHECK(!f->shared()->is_compiled());
+  CHECK(!f->is_compiled());
+
+  CHECK_EQ(42, CompileRun("f()")->Int32Value(ctx).FromJust());
+  CHECK(f->shared()->is_compiled());
+}
+
+namespace {
+
+void AgeBytecodeAndRequestCriticalMemoryPressure(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = CcTest::i_isolate();
+  // Pretend that several GCs happened since f and the running g last started.
+  for (const char* name : {"f", "g"}) {
+    GetFunctionByName(isolate, name)
+        ->shared()
+        ->GetBytecodeArray()
+        ->set_bytecode_age(BytecodeArray::kLastBytecodeAge);
+  }
+  // Not holding the isolate lock makes the heap handle the notification on
+  // the next interrupt check, while g is still on the stack.
+  isolate->heap()->MemoryPressureNotification(MemoryPressureLevel::kCritical,
+                                              false);
+}
+
+}  // namespace
+
+TEST(FlushOldBytecodeOnMemoryPressureInterrupt) {
+  if (FLAG_always_opt) return;
+  FLAG_flush_bytecode_on_memory_pressure = true;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> ctx = isolate->GetCurrentContext();
+  CHECK(CcTest::global()
+            ->Set(ctx, v8_str("notify"),
+                  v8::FunctionTemplate::New(
+                      isolate, AgeBytecodeAndRequestCriticalMemoryPressure)
+                      ->GetFunction(ctx)
+                      .ToLocalChecked())
+            .FromJust());
+  CompileRun(
+      "function f() { return 42; }; f();"
+      "function h() { return 1; }; h();"
+      "function g() { notify(); return h(); }");
+  Handle<JSFunction> f = GetFunctionByName(CcTest::i_isolate(), "f");
+  Handle<JSFunction> g = GetFunctionByName(CcTest::i_isolate(), "g");
+
+  // The interrupt is handled when h is entered.
+  CHECK_EQ(1, CompileRun("g()")->Int32Value(ctx).FromJust());
+  CHECK(!f->shared()->is_compiled());
+  // g was on the stack and keeps its bytecode.
+  CHECK(g->shared()->is_compiled());
+  CHECK(g->is_compiled());
+}
+
+HEAP_TEST(HeapGrowingPolicyEnvelopeExceeded) {
+  if (FLAG_stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  const size_t kEnvelope = 1 * MB;
+  heap->SetHeapGrowingPolicy(0, kEnvelope);
+  {
+    HandleScope scope(isolate);
+    const int kArrayLength = 64 * KB;
+    std::vector<Handle<FixedArray>> arrays;
+    for (int i = 0; i < 8; i++) {
+      arrays.push_back(factory->NewFixedArray(kArrayLength, TENURED));
+    }
+    CcTest::CollectAllGarbage();
+    CHECK_LT(kEnvelope, heap->OldGenerationSizeOfObjects());
+    // Exceeding the soft envelope must not move the limit below the live
+    // size, which would trigger back-to-back full GCs.
+    CHECK_GT(heap->old_generation_allocation_limit_,
+             heap->OldGenerationSizeOfObjects());
+  }
+  heap->SetHeapGrowingPolicy(0, 0);
+}
+
+TEST(DeduplicateStringsWhenCollectingAllAvailableGarbage) {
+  FLAG_string_deduplication = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  const char* chars = "a duplicated string value";
+  Handle<String> one = factory->NewStringFromAsciiChecked(chars, TENURED);
+  Handle<String> two = factory->NewStringFromAsciiChecked(chars, TENURED);
+  CHECK(!one->IsInternalizedString());
+  CHECK(!two->IsInternalizedString());
+
+  CcTest::CollectAllAvailableGarbage();
+  // The first copy visited is internalized in place, the other one forwards
+  // to it.
+  Handle<String> internalized = one->IsInternalizedString() ? one : two;
+  Handle<String> thin = one->IsInternalizedString() ? two : one;
+  CHECK(internalized->IsInternalizedString());
+  CHECK(thin->IsThinString());
+  CHECK_EQ(*internalized, ThinString::cast(*thin)->actual());
+  CHECK(one->Equals(*two));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
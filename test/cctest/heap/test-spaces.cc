@@ -213,6 +213,37 @@ TEST(MemoryAllocator) {
   delete memory_allocator;
 }
 
+TEST(MemoryAllocatorReusesFreedLargePages) {
+  FLAG_concurrent_sweeping = false;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  MemoryAllocator* memory_allocator =
+      new MemoryAllocator(isolate, heap->MaxReserved(), 0);
+  TestMemoryAllocatorScope test_scope(isolate, memory_allocator);
+  MemoryAllocator::Unmapper* unmapper = memory_allocator->unmapper();
+  {
+    const size_t object_size = 3 * Page::kPageSize;
+    LargePage* page = memory_allocator->AllocateLargePage(
+        object_size, heap->lo_space(), NOT_EXECUTABLE);
+    CHECK_NOT_NULL(page);
+    const Address address = page->address();
+    memory_allocator->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+    unmapper->FreeQueuedChunks();
+    CHECK_LT(0u, unmapper->PooledLargeChunkMemoryForTesting());
+
+    // A slightly smaller object fits into the same size class.
+    LargePage* reused = memory_allocator->AllocateLargePage(
+        object_size - Page::kPageSize / 2, heap->lo_space(), NOT_EXECUTABLE);
+    CHECK_NOT_NULL(reused);
+    CHECK_EQ(address, reused->address());
+    CHECK_EQ(0u, unmapper->PooledLargeChunkMemoryForTesting());
+    memory_allocator->Free<MemoryAllocator::kFull>(reused);
+  }
+  memory_allocator->TearDown();
+  delete memory_allocator;
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
@@ -393,6 +393,39 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8LongAsciiRuns) {
+  // ASCII runs longer than the stream's buffer, interleaved with multi-byte
+  // characters, both in one chunk and split into chunks of varying sizes.
+  std::string utf8;
+  std::vector<uint16_t> utf16;
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 1000 + i; j++) {
+      char c = 'a' + (j % 26);
+      utf8.push_back(c);
+      utf16.push_back(c);
+    }
+    utf8.append("\xC3\xA4");  // U+00E4
+    utf16.push_back(0xE4);
+    utf8.append("\xF0\x9F\x98\x80");  // U+1F600
+    utf16.push_back(0xD83D);
+    utf16.push_back(0xDE00);
+  }
+
+  for (bool extra_chunky : {false, true}) {
+    ChunkSource chunk_source(reinterpret_cast<const uint8_t*>(utf8.data()), 1,
+                             utf8.size(), extra_chunky);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+    for (size_t i = 0; i < utf16.size(); i++) {
+      CHECK_EQ(utf16[i], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
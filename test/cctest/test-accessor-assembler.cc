@@ -26,17 +26,20 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams);
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     Node* name = m.Parameter(0);
     Node* map = m.Parameter(1);
-    Node* primary_offset = m.StubCachePrimaryOffsetForTesting(name, map);
+    Node* primary_offset =
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,12 +82,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -115,9 +118,7 @@ Handle<Code> CreateCodeOfKind(Code::Kind kind) {
   return data.GenerateCodeCloseAndEscape();
 }
 
-}  // namespace
-
-TEST(TryProbeStubCache) {
+void TestTryProbeStubCache() {
   typedef CodeStubAssembler::Label Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 3;
@@ -167,21 +168,23 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  const int primary_table_size = stub_cache.primary_table_size();
+  const int secondary_table_size = stub_cache.secondary_table_size();
+  for (int i = 0; i < primary_table_size / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) % primary_table_size);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) % primary_table_size);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -197,7 +200,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < secondary_table_size / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -212,7 +215,7 @@ TEST(TryProbeStubCache) {
   DisallowHeapAllocation no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N = primary_table_size + secondary_table_size;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -258,5 +261,16 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+}  // namespace
+
+TEST(TryProbeStubCache) { TestTryProbeStubCache(); }
+
+TEST(TryProbeStubCacheWithCustomTableSizes) {
+  // The table sizes are read when a stub cache is created.
+  FLAG_stub_cache_primary_table_bits = 13;
+  FLAG_stub_cache_secondary_table_bits = 7;
+  TestTryProbeStubCache();
+}
+
 }  // namespace internal
 }  // namespace v8
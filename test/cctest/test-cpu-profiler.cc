@@ -766,6 +766,30 @@ TEST(CollectCpuProfileSamples) {
   profile->Delete();
 }
 
+TEST(CollectCpuProfileSamplesWithLimit) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_cpu_profiler_max_samples = 10;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile =
+      helper.Run(function, args, arraysize(args), 1000, 0, true);
+
+  CHECK_EQ(10, profile->GetSamplesCount());
+  // The call tree still sees every tick.
+  const v8::CpuProfileNode* root = profile->GetTopDownRoot();
+  GetChild(env.local(), root, "start");
+
+  profile->Delete();
+}
+
 static const char* cpu_profiler_test_source2 =
     "%NeverOptimizeFunction(loop);\n"
     "%NeverOptimizeFunction(delay);\n"
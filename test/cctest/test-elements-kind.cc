@@ -13,9 +13,11 @@
 #include "src/execution.h"
 #include "src/global-handles.h"
 #include "src/heap/factory.h"
+#include "src/heap/incremental-marking.h"
 #include "src/ic/stub-cache.h"
 #include "src/objects-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "test/cctest/heap/heap-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -58,6 +60,22 @@ bool EQUALS(Isolate* isolate, T left, Handle<M> right) {
   return EQUALS(isolate, handle(left, isolate), right);
 }
 
+// Returns a PACKED_SMI_ELEMENTS array holding 0, 1, ..., length - 1.
+Handle<JSArray> NewSmiArray(Isolate* isolate, int length) {
+  Handle<JSArray> array = isolate->factory()->NewJSArray(
+      PACKED_SMI_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+  FixedArray elements = FixedArray::cast(array->elements());
+  for (int i = 0; i < length; i++) elements->set(i, Smi::FromInt(i));
+  return array;
+}
+
+void CheckDoubleElements(JSArray* array, int length) {
+  CHECK_EQ(PACKED_DOUBLE_ELEMENTS, array->GetElementsKind());
+  FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+  CHECK_EQ(length, elements->length());
+  for (int i = 0; i < length; i++) CHECK_EQ(i, elements->get_scalar(i));
+}
+
 }  // namespace
 
 
@@ -481,6 +499,76 @@ TEST(JSArrayAddingElementsGeneralizingiFastDoubleElements) {
   CHECK_EQ(array->map(), *previous_map);
 }
 
+TEST(SmiToDoubleTransitionInPlace) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  CHECK(!isolate->heap()->incremental_marking()->IsMarking());
+
+  const int kLength = 100;
+  Handle<JSArray> array = NewSmiArray(isolate, kLength);
+  Handle<FixedArrayBase> elements(array->elements(), isolate);
+  JSObject::TransitionElementsKind(array, PACKED_DOUBLE_ELEMENTS);
+  CheckDoubleElements(*array, kLength);
+  // The backing store is only rewritten in place where a Smi and a double
+  // have the same size.
+  if (kDoubleSize == kPointerSize) {
+    CHECK_EQ(elements->ptr(), array->elements()->ptr());
+    // A handle to the old backing store sees the converted elements.
+    CHECK(elements->IsFixedDoubleArray());
+    CHECK_EQ(kLength - 1,
+             FixedDoubleArray::cast(*elements)->get_scalar(kLength - 1));
+  } else {
+    CHECK_NE(elements->ptr(), array->elements()->ptr());
+  }
+  CcTest::CollectAllGarbage();
+  CheckDoubleElements(*array, kLength);
+}
+
+TEST(SmiToDoubleTransitionCopiesCopyOnWriteElements) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const int kLength = 10;
+  Handle<FixedArray> cow = isolate->factory()->NewFixedArray(kLength);
+  for (int i = 0; i < kLength; i++) cow->set(i, Smi::FromInt(i));
+  cow->set_map(ReadOnlyRoots(isolate).fixed_cow_array_map());
+  Handle<JSArray> array = isolate->factory()->NewJSArrayWithElements(
+      cow, PACKED_SMI_ELEMENTS, kLength);
+  JSObject::TransitionElementsKind(array, PACKED_DOUBLE_ELEMENTS);
+  CheckDoubleElements(*array, kLength);
+  CHECK_NE(cow->ptr(), array->elements()->ptr());
+  // The shared copy-on-write store is left alone.
+  CHECK_EQ(ReadOnlyRoots(isolate).fixed_cow_array_map(), cow->map());
+  for (int i = 0; i < kLength; i++) CHECK_EQ(i, Smi::ToInt(cow->get(i)));
+}
+
+TEST(SmiToDoubleTransitionCopiesWhileMarking) {
+  if (!FLAG_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const int kLength = 100;
+  Handle<JSArray> array = NewSmiArray(isolate, kLength);
+  Handle<FixedArrayBase> elements(array->elements(), isolate);
+  heap::SimulateIncrementalMarking(isolate->heap(), false);
+  CHECK(isolate->heap()->incremental_marking()->IsMarking());
+  JSObject::TransitionElementsKind(array, PACKED_DOUBLE_ELEMENTS);
+  CheckDoubleElements(*array, kLength);
+  // The marker may be visiting the old store, so it keeps its layout.
+  CHECK_NE(elements->ptr(), array->elements()->ptr());
+  CHECK(elements->IsFixedArray());
+  for (int i = 0; i < kLength; i++) {
+    CHECK_EQ(i, Smi::ToInt(FixedArray::cast(*elements)->get(i)));
+  }
+  CcTest::CollectAllGarbage();
+  CheckDoubleElements(*array, kLength);
+}
+
 }  // namespace test_elements_kind
 }  // namespace internal
 }  // namespace v8
@@ -903,6 +903,47 @@ TEST(SlowModeSubclass) {
 }
 
 
+TEST(ClassFieldsInSubclassChain) {
+  // Avoid eventual completion of in-object slack tracking.
+  FLAG_always_opt = false;
+  FLAG_harmony_public_fields = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const int kFieldsPerClass = 20;
+  std::ostringstream os;
+  os << "'use strict';\n";
+  for (int c = 0; c < 2; c++) {
+    os << "class C" << c;
+    if (c > 0) os << " extends C" << (c - 1);
+    os << " {\n";
+    for (int i = 0; i < kFieldsPerClass; i++) {
+      os << "  f" << c << "_" << i << " = " << i << ";\n";
+    }
+    os << "}\n";
+  }
+  CompileRun(os.str().c_str());
+
+  v8::Local<v8::Script> new_script = v8_compile("new C1();");
+  Handle<JSFunction> func = GetLexical<JSFunction>("C1");
+  Handle<JSObject> obj = RunI<JSObject>(new_script);
+  CHECK(func->has_initial_map());
+  Handle<Map> initial_map(func->initial_map(), func->GetIsolate());
+
+  // The fields of both classes fit in-object.
+  CHECK_LE(2 * kFieldsPerClass, obj->map()->GetInObjectProperties());
+  CHECK(obj->HasFastProperties());
+  CHECK_EQ(0, obj->property_array()->length());
+
+  // Create several instances to complete the tracking.
+  for (int i = 1; i < Map::kGenerousAllocationCount; i++) {
+    RunI<JSObject>(new_script);
+  }
+  CHECK(!initial_map->IsInobjectSlackTrackingInProgress());
+  Handle<JSObject> tmp = RunI<JSObject>(new_script);
+  CHECK_EQ(2 * kFieldsPerClass, tmp->map()->GetInObjectProperties());
+}
+
 static void TestSubclassBuiltin(const char* subclass_name,
                                 InstanceType instance_type,
                                 const char* builtin_name,
@@ -0,0 +1,68 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "src/heap/factory.h"
+#include "src/isolate.h"
+#include "src/lookup-cache-inl.h"
+#include "src/objects-inl.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+
+// Helper for testing. A "friend" of the DescriptorLookupCache class, it is
+// able to find keys that map to the same set.
+class DescriptorLookupCacheTester {
+ public:
+  static const int kWays = DescriptorLookupCache::kWays;
+
+  // Returns {count} distinct names which share a set with {map}.
+  static std::vector<Handle<Name>> NamesInOneSet(Isolate* isolate, Map map,
+                                                 int count) {
+    Factory* factory = isolate->factory();
+    std::vector<Handle<Name>> names;
+    int set_start = -1;
+    for (int i = 0; static_cast<int>(names.size()) < count; i++) {
+      EmbeddedVector<char, 32> buffer;
+      SNPrintF(buffer, "name%d", i);
+      Handle<Name> name = factory->InternalizeUtf8String(buffer.start());
+      int start = DescriptorLookupCache::SetStart(map, *name);
+      if (set_start == -1) set_start = start;
+      if (start == set_start) names.push_back(name);
+    }
+    return names;
+  }
+};
+
+TEST(DescriptorLookupCacheEvictsLeastRecentlyUsed) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  DescriptorLookupCache* cache = isolate->descriptor_lookup_cache();
+  const int kWays = DescriptorLookupCacheTester::kWays;
+
+  Handle<Map> map(isolate->object_function()->initial_map(), isolate);
+  std::vector<Handle<Name>> names =
+      DescriptorLookupCacheTester::NamesInOneSet(isolate, *map, kWays + 1);
+
+  cache->Clear();
+  for (int i = 0; i < kWays; i++) cache->Update(*map, *names[i], i);
+  for (int i = 0; i < kWays; i++) CHECK_EQ(i, cache->Lookup(*map, *names[i]));
+
+  // The lookups above left names[0] as the least recently used entry. Use it
+  // again, so that names[1] is evicted by the fifth key instead.
+  CHECK_EQ(0, cache->Lookup(*map, *names[0]));
+  cache->Update(*map, *names[kWays], kWays);
+
+  CHECK_EQ(DescriptorLookupCache::kAbsent, cache->Lookup(*map, *names[1]));
+  CHECK_EQ(0, cache->Lookup(*map, *names[0]));
+  for (int i = 2; i <= kWays; i++) {
+    CHECK_EQ(i, cache->Lookup(*map, *names[i]));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
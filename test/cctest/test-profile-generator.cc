@@ -354,6 +354,20 @@ TEST(CodeMapMoveAndDeleteCode) {
   CHECK_EQ(entry3, code_map.FindEntry(ToAddress(0x1750)));
 }
 
+TEST(CodeMapRepeatedLookupsSeeReplacedCode) {
+  CodeMap code_map;
+  CodeEntry* entry1 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry* entry2 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  code_map.AddCode(ToAddress(0x1500), entry1, 0x200);
+  for (int i = 0; i < 3; i++) {
+    CHECK_EQ(entry1, code_map.FindEntry(ToAddress(0x1600)));
+    CHECK(!code_map.FindEntry(ToAddress(0x1800)));
+  }
+  code_map.AddCode(ToAddress(0x1600), entry2, 0x400);
+  CHECK_EQ(entry2, code_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(entry2, code_map.FindEntry(ToAddress(0x1800)));
+}
+
 namespace {
 
 class TestSetup {
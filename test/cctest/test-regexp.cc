@@ -1970,6 +1970,44 @@ TEST(UncachedExternalString) {
   ExpectString("external.substring(1).match(re)[1]", "z");
 }
 
+UNINITIALIZED_TEST(RegExpCacheSharedAcrossContexts) {
+  FLAG_regexp_cache_generations = 4;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::String> pattern =
+        v8::String::NewFromUtf8(isolate, "(a+)b[cd]",
+                                v8::NewStringType::kNormal)
+            .ToLocalChecked();
+
+    Handle<FixedArray> data;
+    {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::RegExp> re =
+          v8::RegExp::New(context, pattern, v8::RegExp::kNone).ToLocalChecked();
+      data = handle(FixedArray::cast(v8::Utils::OpenHandle(*re)->data()),
+                    i_isolate);
+    }
+
+    // Entries survive fewer mark-compacts than there are generations.
+    for (int i = 0; i < FLAG_regexp_cache_generations - 1; ++i) {
+      CcTest::CollectAllGarbage(i_isolate);
+    }
+
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::RegExp> re =
+        v8::RegExp::New(context, pattern, v8::RegExp::kNone).ToLocalChecked();
+    CHECK(*data == v8::Utils::OpenHandle(*re)->data());
+  }
+  isolate->Dispose();
+}
+
 }  // namespace test_regexp
 }  // namespace internal
 }  // namespace v8
@@ -1580,6 +1580,67 @@ TEST(CodeSerializerInternalizedString) {
   delete script_data;
 }
 
+TEST(CodeSerializerPreParsedScopeData) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()->Disable();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  // {outer} stays lazy, so the cache holds its uncompiled data including
+  // the preparsed scope data that lets it skip preparsing {inner}.
+  const char* source =
+      "function outer() {\n"
+      "  var x = 1;\n"
+      "  function inner() { return x; }\n"
+      "  return inner();\n"
+      "}\n"
+      "outer;";
+
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<JSObject> global(isolate->context()->global_object(), isolate);
+
+  ScriptData* cache = nullptr;
+  Handle<SharedFunctionInfo> orig = CompileScriptAndProduceCache(
+      isolate, orig_source, Handle<String>(), &cache,
+      v8::ScriptCompiler::kNoCompileOptions);
+  Handle<JSFunction> orig_fun =
+      isolate->factory()->NewFunctionFromSharedFunctionInfo(
+          orig, isolate->native_context());
+  Handle<JSFunction> orig_outer = Handle<JSFunction>::cast(
+      Execution::Call(isolate, orig_fun, global, 0, nullptr)
+          .ToHandleChecked());
+  CHECK(!orig_outer->shared()->is_compiled());
+  CHECK(orig_outer->shared()->HasUncompiledDataWithPreParsedScope());
+
+  Handle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, Handle<String>(), cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+  Handle<JSFunction> copy_fun =
+      isolate->factory()->NewFunctionFromSharedFunctionInfo(
+          copy, isolate->native_context());
+  Handle<JSFunction> copy_outer = Handle<JSFunction>::cast(
+      Execution::Call(isolate, copy_fun, global, 0, nullptr)
+          .ToHandleChecked());
+  CHECK(!copy_outer->shared()->is_compiled());
+  CHECK(copy_outer->shared()->HasUncompiledDataWithPreParsedScope());
+
+  Handle<Object> copy_result =
+      Execution::Call(isolate, copy_outer, global, 0, nullptr)
+          .ToHandleChecked();
+  CHECK_EQ(1, Handle<Smi>::cast(copy_result)->value());
+
+  delete cache;
+}
+
 TEST(CodeSerializerLargeCodeObject) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
@@ -2285,6 +2346,138 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerHotFunctions) {
+  // We test that no compilations happen when running this code. Forcing
+  // to always optimize breaks this test.
+  bool prev_always_opt_value = FLAG_always_opt;
+  FLAG_always_opt = false;
+  const char* source =
+      "function hot() { return 'abc'; }\n"
+      "function cold() { return 'xyz'; }\n"
+      "hot() + 'def'";
+  const int hot_position =
+      static_cast<int>(strstr(source, "function hot") - source);
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_object(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_object)
+            .ToLocalChecked();
+    cache = v8::ScriptCompiler::CreateCodeCache(script, {hot_position});
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_object(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(
+          reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source_object,
+                   v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    CheckDeserializedFlag(script);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iterator(
+        reinterpret_cast<Isolate*>(isolate2),
+        Script::cast(toplevel->script()));
+    int inner_functions = 0;
+    for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+         shared = iterator.Next()) {
+      if (shared->is_toplevel()) continue;
+      inner_functions++;
+      CHECK_EQ(shared->function_token_position() == hot_position,
+               shared->is_compiled());
+    }
+    CHECK_EQ(2, inner_functions);
+
+    {
+      DisallowCompilation no_compile_expected(
+          reinterpret_cast<Isolate*>(isolate2));
+      v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                        ->Run(isolate2->GetCurrentContext())
+                                        .ToLocalChecked();
+      CHECK(result->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+                .FromJust());
+    }
+  }
+  isolate2->Dispose();
+  delete cache;
+
+  // Restore the flags.
+  FLAG_always_opt = prev_always_opt_value;
+}
+
+TEST(CodeSerializerTierUpHints) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  const char* source =
+      "function f() { return 'abc'; };"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the optimized function carries the hint.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    CHECK(!sfi->has_optimized_at_least_once());
+    i::SharedFunctionInfo::ScriptIterator iterator(
+        sfi->GetIsolate(), Script::cast(sfi->script()));
+    int hinted_functions = 0;
+    for (SharedFunctionInfo next = iterator.Next(); !next.is_null();
+         next = iterator.Next()) {
+      if (next->has_optimized_at_least_once()) {
+        CHECK(next->deserialized());
+        hinted_functions++;
+      }
+    }
+    CHECK_EQ(1, hinted_functions);
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -3625,6 +3818,61 @@ TEST(SerializationStats) {
   }
 }
 
+UNINITIALIZED_TEST(EmbeddedBlobBuiltinsOrder) {
+  if (!FLAG_embedded_builtins) return;
+  DisableAlwaysOpt();
+
+  // Lay out the two isolate-independent builtins with the highest ids first,
+  // in reverse id order.
+  int last = -1;
+  int second_to_last = -1;
+  for (int i = Builtins::builtin_count - 1; i >= 0 && second_to_last < 0;
+       i--) {
+    if (!Builtins::IsIsolateIndependent(i)) continue;
+    if (last < 0) {
+      last = i;
+    } else {
+      second_to_last = i;
+    }
+  }
+  CHECK_LE(0, second_to_last);
+
+  EmbeddedVector<char, 64> path;
+  SNPrintF(path, "embedded-builtins-order-%d.txt",
+           base::OS::GetCurrentProcessId());
+  FILE* file = base::OS::FOpen(path.start(), "w");
+  CHECK_NOT_NULL(file);
+  fprintf(file, "%s\n%s\n", Builtins::name(last),
+          Builtins::name(second_to_last));
+  fclose(file);
+  FLAG_embedded_builtins_order = path.start();
+
+  v8::Isolate* isolate = TestSerializer::NewIsolateInitialized();
+  {
+    EmbeddedData d = EmbeddedData::FromBlob();
+    CHECK_EQ(last, d.BuiltinAtLayoutPosition(0));
+    CHECK_EQ(second_to_last, d.BuiltinAtLayoutPosition(1));
+
+    // Every builtin has exactly one position, and the instruction streams
+    // follow the positions.
+    std::vector<bool> seen(Builtins::builtin_count, false);
+    Address previous_start = kNullAddress;
+    for (int position = 0; position < Builtins::builtin_count; position++) {
+      const int builtin = d.BuiltinAtLayoutPosition(position);
+      CHECK(!seen[builtin]);
+      seen[builtin] = true;
+      if (!d.ContainsBuiltin(builtin)) continue;
+      Address start = d.InstructionStartOfBuiltin(builtin);
+      CHECK_LT(previous_start, start);
+      previous_start = start;
+    }
+  }
+  FLAG_embedded_builtins_order = nullptr;
+  base::OS::Remove(path.start());
+  isolate->Dispose();
+  FreeCurrentEmbeddedBlob();
+}
+
 void CheckSFIsAreWeak(WeakFixedArray sfis, Isolate* isolate) {
   CHECK_GT(sfis->length(), 0);
   int no_of_weak = 0;
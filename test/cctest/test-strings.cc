@@ -1267,6 +1267,29 @@ TEST(SliceFromCons) {
 }
 
 
+TEST(EqualsConsWithoutFlattening) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  Handle<String> block = factory->NewStringFromStaticChars("abcdefghijklmn");
+  Handle<String> left = factory->NewConsString(block, block).ToHandleChecked();
+  Handle<String> right = factory->NewConsString(block, block).ToHandleChecked();
+  Handle<String> flat = factory->NewStringFromStaticChars(
+      "abcdefghijklmnabcdefghijklmn");
+  Handle<String> other = factory->NewStringFromStaticChars(
+      "abcdefghijklmnabcdefghijklmX");
+  CHECK(!left->IsFlat());
+  CHECK(!right->IsFlat());
+  CHECK(String::Equals(isolate, left, right));
+  CHECK(String::Equals(isolate, left, flat));
+  CHECK(String::Equals(isolate, flat, right));
+  CHECK(!String::Equals(isolate, left, other));
+  // Comparing does not flatten the ropes.
+  CHECK(!left->IsFlat());
+  CHECK(!right->IsFlat());
+}
+
 class OneByteVectorResource : public v8::String::ExternalOneByteStringResource {
  public:
   explicit OneByteVectorResource(i::Vector<const char> vector)
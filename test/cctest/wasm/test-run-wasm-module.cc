@@ -858,6 +858,40 @@ TEST(Run_WasmModule_Reclaim_Memory) {
               .ToHandle(&buffer));
   }
 }
+
+TEST(Run_WasmModule_Reuse_Pooled_Reservation) {
+  if (!FLAG_wasm_trap_handler) return;
+  FlagScope<int> pool_size(&FLAG_wasm_memory_reservation_pool_size, 1);
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  WasmMemoryTracker* memory_tracker = isolate->wasm_engine()->memory_tracker();
+
+  void* allocation_base = nullptr;
+  size_t allocation_length = 0;
+  byte* memory = reinterpret_cast<byte*>(
+      memory_tracker->TryAllocateBackingStoreForTesting(
+          isolate->heap(), kWasmPageSize, &allocation_base,
+          &allocation_length));
+  CHECK_NOT_NULL(memory);
+  memory[0] = 42;
+  memory[kWasmPageSize - 1] = 42;
+  CHECK(memory_tracker->FreeMemoryIfIsWasmMemory(isolate, memory));
+
+  // The next memory gets the pooled reservation back, zeroed.
+  void* reused_allocation_base = nullptr;
+  size_t reused_allocation_length = 0;
+  byte* reused_memory = reinterpret_cast<byte*>(
+      memory_tracker->TryAllocateBackingStoreForTesting(
+          isolate->heap(), 2 * kWasmPageSize, &reused_allocation_base,
+          &reused_allocation_length));
+  CHECK_EQ(allocation_base, reused_allocation_base);
+  CHECK_EQ(allocation_length, reused_allocation_length);
+  CHECK_EQ(memory, reused_memory);
+  for (size_t i = 0; i < 2 * kWasmPageSize; ++i) {
+    CHECK_EQ(0, reused_memory[i]);
+  }
+  CHECK(memory_tracker->FreeMemoryIfIsWasmMemory(isolate, reused_memory));
+  CHECK(memory_tracker->FreePooledReservations());
+}
 #endif
 
 TEST(AtomicOpDisassembly) {
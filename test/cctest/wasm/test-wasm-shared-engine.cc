@@ -257,6 +257,36 @@ TEST(SharedEngineRunImported) {
   CHECK_EQ(1, module.use_count());
 }
 
+TEST(SharedEngineNativeModuleCache) {
+  FlagScope<bool> flag_scope(&FLAG_wasm_native_module_cache, true);
+  SharedEngine engine;
+  SharedModule module;
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    module = isolate.ExportInstance(instance);
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_EQ(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 42);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_NE(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(42, isolate.Run(instance));
+  }
+}
+
 TEST(SharedEngineRunThreadedBuildingSync) {
   SharedEngine engine;
   SharedEngineThread thread1(&engine, [](SharedEngineIsolate& isolate) {
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+# Copyright 2019 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Runs the heap shapes in shapes.js under --trace-gc-nvp and reports pause
+distributions per GC type and GCTracer scope.
+
+Example:
+  test/gc-benchmarks/run.py --d8 out/x64.release/d8 --heap-mb 128 \\
+      --shapes linked-list,map-cache --percentiles 50,90,99
+
+Every result line has the form "<shape>-<gc>-<scope>-<stat>: <ms>", which is
+consumable by tools/run_perf.py results_regexps. With --trace-dir the raw
+traces are kept for tools/gc-nvp-trace-processor.py or tools/eval_gc_time.sh.
+"""
+
+from argparse import ArgumentParser
+from math import ceil
+import os
+import subprocess
+import sys
+
+BASE_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.append(os.path.join(BASE_DIR, '..', '..', 'tools'))
+from gc_nvp_common import split_nvp
+
+SHAPES = [
+  'linked-list',
+  'wide-array',
+  'small-arrays',
+  'map-cache',
+  'array-buffers',
+]
+
+# GCTracer scopes reported for each "gc=" type of the NVP output.
+SCOPES = {
+  's': [
+    'pause',
+    'scavenge',
+    'scavenge.roots',
+    'scavenge.parallel',
+    'scavenge.weak',
+    'scavenge.update_refs',
+  ],
+  'ms': [
+    'pause',
+    'mark',
+    'mark.finish_incremental',
+    'mark.roots',
+    'mark.main',
+    'mark.weak_closure',
+    'clear',
+    'evacuate',
+    'evacuate.copy',
+    'evacuate.update_pointers',
+    'sweep',
+    'finish',
+    'incremental',
+    'background.mark',
+  ],
+}
+
+
+def percentile(sorted_values, p):
+  index = int(ceil((len(sorted_values) - 1) * p / 100))
+  return sorted_values[index]
+
+
+def run_shape(options, shape):
+  cmd = [options.d8, '--trace-gc-nvp', '--allow-natives-syntax',
+         '--random-seed=%d' % options.random_seed]
+  if options.single_threaded:
+    cmd.append('--single-threaded-gc')
+  cmd += options.extra_flags
+  cmd += [os.path.join(BASE_DIR, 'shapes.js'), '--', shape,
+          str(options.heap_mb), str(options.rounds)]
+  output = subprocess.check_output(cmd, universal_newlines=True)
+  if options.trace_dir:
+    with open(os.path.join(options.trace_dir, shape + '.nvp'), 'w') as f:
+      f.write(output)
+  return [split_nvp(line) for line in output.splitlines()]
+
+
+def report(shape, entries, percentiles):
+  for gc, keys in sorted(SCOPES.items()):
+    events = [e for e in entries if e.get('gc') == gc]
+    print('%s-%s-count: %d' % (shape, gc, len(events)))
+    for key in keys:
+      values = sorted(e[key] for e in events
+                      if isinstance(e.get(key), float))
+      if not values:
+        continue
+      print('%s-%s-%s-total: %.2f' % (shape, gc, key, sum(values)))
+      print('%s-%s-%s-max: %.2f' % (shape, gc, key, values[-1]))
+      for p in percentiles:
+        print('%s-%s-%s-P%g: %.2f' % (shape, gc, key, p,
+                                      percentile(values, p)))
+
+
+def main():
+  parser = ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('--d8', default='d8', help='path to the d8 binary')
+  parser.add_argument('--shapes', default=','.join(SHAPES),
+                      help='comma separated shapes (default: all)')
+  parser.add_argument('--heap-mb', type=int, default=64,
+                      help='retained heap size to build (default: 64)')
+  parser.add_argument('--rounds', type=int, default=20,
+                      help='churn rounds over the graph (default: 20)')
+  parser.add_argument('--percentiles', default='50,90,99',
+                      help='comma separated percentiles (default: 50,90,99)')
+  parser.add_argument('--random-seed', type=int, default=12347,
+                      help='random seed passed to d8 (default: 12347)')
+  parser.add_argument('--single-threaded', action='store_true',
+                      help='run GC without helper threads for less noise')
+  parser.add_argument('--trace-dir',
+                      help='directory to keep the raw NVP traces in')
+  parser.add_argument('extra_flags', nargs='*',
+                      help='additional d8 flags, given after "--"')
+  options = parser.parse_args()
+
+  percentiles = [float(p) for p in options.percentiles.split(',') if p]
+  for shape in options.shapes.split(','):
+    if shape not in SHAPES:
+      parser.error('unknown shape %s' % shape)
+    report(shape, run_shape(options, shape), percentiles)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,132 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Builds a retained object graph of a given shape up to a target heap size
+// and then churns a fraction of it, so that both scavenges and full
+// mark-compacts run over that shape. Run by run.py with --trace-gc-nvp as
+//
+//   d8 --allow-natives-syntax shapes.js -- <shape> <heap-mb> <rounds>
+
+(function(args) {
+  var shape = args[0] || 'linked-list';
+  var targetBytes = (Number(args[1]) || 64) * 1024 * 1024;
+  var rounds = Number(args[2]) || 20;
+
+  // Deterministic PRNG so that runs are reproducible.
+  var seed = 49734321;
+  function Random() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed / 0x7fffffff;
+  }
+
+  // Each generator returns a [create, replace] pair: create() returns a new
+  // unit of the shape, replace(unit) swaps out part of that unit in place.
+  var shapes = {
+    'linked-list': function() {
+      function Node(next, value) {
+        this.next = next;
+        this.value = value;
+      }
+      return [
+        function() {
+          var head = null;
+          for (var i = 0; i < 1000; i++) head = new Node(head, i);
+          return head;
+        },
+        function(unit) {
+          for (var i = 0; i < 100 && unit.next !== null; i++) unit = unit.next;
+          unit.next = new Node(unit.next, -1);
+        },
+      ];
+    },
+    'wide-array': function() {
+      return [
+        function() {
+          var array = new Array(10000);
+          for (var i = 0; i < array.length; i++) array[i] = {index: i};
+          return array;
+        },
+        function(unit) {
+          for (var i = 0; i < 100; i++) {
+            unit[Math.floor(Random() * unit.length)] = {index: -1};
+          }
+        },
+      ];
+    },
+    'small-arrays': function() {
+      return [
+        function() {
+          var arrays = [];
+          for (var i = 0; i < 1000; i++) arrays.push([i, i + 1, i + 2]);
+          return arrays;
+        },
+        function(unit) {
+          for (var i = 0; i < 100; i++) {
+            unit[Math.floor(Random() * unit.length)] = [-1, -1, -1];
+          }
+        },
+      ];
+    },
+    'map-cache': function() {
+      var next_key = 0;
+      return [
+        function() {
+          var map = new Map();
+          for (var i = 0; i < 1000; i++) {
+            map.set('key' + next_key++, {payload: 'value' + i});
+          }
+          return map;
+        },
+        function(unit) {
+          for (var i = 0; i < 100; i++) {
+            unit.delete(unit.keys().next().value);
+            unit.set('key' + next_key++, {payload: 'fresh'});
+          }
+        },
+      ];
+    },
+    // d8 has no embedder wrapper objects; typed arrays over small array
+    // buffers are the closest stand-in, as every buffer is tracked outside
+    // the JS heap and swept by the GC.
+    'array-buffers': function() {
+      return [
+        function() {
+          var views = [];
+          for (var i = 0; i < 200; i++) views.push(new Uint8Array(64));
+          return views;
+        },
+        function(unit) {
+          for (var i = 0; i < 20; i++) {
+            unit[Math.floor(Random() * unit.length)] = new Uint8Array(64);
+          }
+        },
+      ];
+    },
+  };
+
+  if (!shapes.hasOwnProperty(shape)) {
+    throw new Error('unknown shape ' + shape + ', expected one of ' +
+                    Object.keys(shapes).join(', '));
+  }
+  var generator = shapes[shape]();
+  var create = generator[0];
+  var replace = generator[1];
+
+  var units = [];
+  while (%GetHeapUsage() < targetBytes) units.push(create());
+
+  for (var round = 0; round < rounds; round++) {
+    // Replace a tenth of the units wholesale and mutate the rest, which
+    // produces short-lived garbage as well as old-to-new references.
+    for (var i = 0; i < units.length; i++) {
+      if (Random() < 0.1) {
+        units[i] = create();
+      } else {
+        replace(units[i]);
+      }
+    }
+  }
+  print(shape + ': ' + units.length + ' units, ' +
+        Math.round(%GetHeapUsage() / (1024 * 1024)) + ' MB');
+})(arguments);
@@ -0,0 +1,29 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function makeRecord(i) {
+  const record = {id: i, name: 'user' + i, active: i % 2 == 0};
+  // Optional fields give the shared maps more than one transition.
+  if (i % 3 == 0) record.email = 'user' + i + '@example.com';
+  if (i % 5 == 0) record.score = i / 7;
+  record.tags = ['a', 'b'];
+  return record;
+}
+
+const records = [];
+for (let i = 0; i < 200; ++i) records.push(makeRecord(i));
+const kRepeatedShapes = JSON.stringify(records);
+
+const kLongStrings = JSON.stringify(
+    records.map(r => ({text: 'lorem ipsum dolor sit amet '.repeat(20)})));
+
+function ParseRepeatedShapes() {
+  return JSON.parse(kRepeatedShapes);
+}
+createSuite('ParseRepeatedShapes', 1000, ParseRepeatedShapes, () => {});
+
+function ParseLongStrings() {
+  return JSON.parse(kLongStrings);
+}
+createSuite('ParseLongStrings', 1000, ParseLongStrings, () => {});
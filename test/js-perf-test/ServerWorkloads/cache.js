@@ -0,0 +1,61 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises a Map-based LRU cache with a skewed key distribution, as used
+// for session and response caches.
+
+new BenchmarkSuite('MapCache', [1000], [
+  new Benchmark('MapCache', false, false, 0, MapCache, MapCacheSetup),
+]);
+
+function LRUCache(capacity) {
+  this.capacity = capacity;
+  this.map = new Map();
+}
+
+LRUCache.prototype.get = function(key) {
+  var value = this.map.get(key);
+  if (value !== undefined) {
+    this.map.delete(key);
+    this.map.set(key, value);
+  }
+  return value;
+};
+
+LRUCache.prototype.set = function(key, value) {
+  if (this.map.has(key)) {
+    this.map.delete(key);
+  } else if (this.map.size >= this.capacity) {
+    this.map.delete(this.map.keys().next().value);
+  }
+  this.map.set(key, value);
+};
+
+var cache;
+var cacheKeys;
+
+function MapCacheSetup() {
+  cache = new LRUCache(256);
+  cacheKeys = [];
+  var seed = 49734321;
+  for (var i = 0; i < 2000; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    // Square the uniform value so that low keys are requested more often.
+    var r = seed / 0x7fffffff;
+    cacheKeys.push('session:' + Math.floor(r * r * 1024));
+  }
+}
+
+function MapCache() {
+  var hits = 0;
+  for (var i = 0; i < cacheKeys.length; i++) {
+    var key = cacheKeys[i];
+    if (cache.get(key) !== undefined) {
+      hits++;
+    } else {
+      cache.set(key, {key: key, created: i});
+    }
+  }
+  if (hits == 0) throw new Error('MapCache: no cache hits');
+}
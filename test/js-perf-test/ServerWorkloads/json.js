@@ -0,0 +1,40 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Round-trips a large API-style payload through JSON, the way a server
+// parses a request body and serializes a response.
+
+new BenchmarkSuite('JSONRoundTrip', [1000], [
+  new Benchmark('JSONRoundTrip', false, false, 0, JSONRoundTrip,
+                JSONRoundTripSetup),
+]);
+
+var payload;
+var payloadString;
+
+function JSONRoundTripSetup() {
+  var records = [];
+  for (var i = 0; i < 500; i++) {
+    records.push({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      active: (i % 3) != 0,
+      score: i * 1.5,
+      tags: ['alpha', 'beta', 'gamma'].slice(0, i % 4),
+      address: {street: i + ' Main St', city: 'Springfield', zip: 10000 + i},
+    });
+  }
+  payload = {status: 'ok', count: records.length, records: records};
+  payloadString = JSON.stringify(payload);
+}
+
+function JSONRoundTrip() {
+  var request = JSON.parse(payloadString);
+  request.records.forEach(function(record) { record.score += 1; });
+  var response = JSON.stringify(request);
+  if (response.length < payloadString.length) {
+    throw new Error('JSONRoundTrip: unexpected response length');
+  }
+}
@@ -0,0 +1,25 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Driver for d8's load mode (--load-iterations), which calls the global run()
+// repeatedly and reports throughput, latency percentiles and GC time.
+
+load('../base.js');
+load('json.js');
+load('templating.js');
+load('routing.js');
+load('pipeline.js');
+load('cache.js');
+
+var benchmarks = [];
+BenchmarkSuite.suites.forEach(function(suite) {
+  suite.benchmarks.forEach(function(benchmark) {
+    benchmark.Setup();
+    benchmarks.push(benchmark);
+  });
+});
+
+function run() {
+  for (var i = 0; i < benchmarks.length; i++) benchmarks[i].run();
+}
@@ -0,0 +1,52 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs requests through an async/await middleware chain, as done by
+// promise-based HTTP server frameworks.
+
+new BenchmarkSuite('AsyncPipeline', [1000], [
+  new Benchmark('AsyncPipeline', false, false, 0, AsyncPipeline,
+                AsyncPipelineSetup),
+]);
+
+var middleware;
+var handledRequests;
+
+function AsyncPipelineSetup() {
+  middleware = [
+    async function parseHeaders(ctx) {
+      ctx.headers = {host: 'example.com', 'content-type': 'text/plain'};
+    },
+    async function authenticate(ctx) {
+      ctx.user = await Promise.resolve({id: ctx.id, admin: ctx.id % 10 == 0});
+    },
+    async function loadData(ctx) {
+      ctx.data = await new Promise(function(resolve) {
+        resolve([ctx.id, ctx.id + 1, ctx.id + 2]);
+      });
+    },
+    async function render(ctx) {
+      ctx.body = `user=${ctx.user.id} data=${ctx.data.join(',')}`;
+    },
+  ];
+  handledRequests = 0;
+}
+
+async function HandleRequest(id) {
+  var ctx = {id: id};
+  for (var i = 0; i < middleware.length; i++) {
+    await middleware[i](ctx);
+  }
+  handledRequests++;
+  return ctx.body;
+}
+
+function AsyncPipeline() {
+  handledRequests = 0;
+  for (var i = 0; i < 100; i++) HandleRequest(i);
+  %PerformMicrotaskCheckpoint();
+  if (handledRequests != 100) {
+    throw new Error('AsyncPipeline: requests left pending');
+  }
+}
@@ -0,0 +1,53 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Dispatches request paths against a table of regexp routes with named
+// captures, as done by web framework routers.
+
+new BenchmarkSuite('Routing', [1000], [
+  new Benchmark('Routing', false, false, 0, Routing, RoutingSetup),
+]);
+
+var routes;
+var requestPaths;
+
+function CompileRoute(pattern) {
+  var source = pattern.replace(/:(\w+)/g, '(?<$1>[^/]+)');
+  return new RegExp('^' + source + '/?$');
+}
+
+function RoutingSetup() {
+  routes = [
+    '/', '/login', '/logout', '/users', '/users/:id', '/users/:id/posts',
+    '/users/:id/posts/:post', '/posts/:post/comments/:comment',
+    '/api/v1/items', '/api/v1/items/:item', '/api/v1/orders/:order/lines',
+    '/static/:dir/:file',
+  ].map(function(pattern) {
+    return {pattern: pattern, regexp: CompileRoute(pattern)};
+  });
+  requestPaths = [];
+  for (var i = 0; i < 100; i++) {
+    requestPaths.push('/users/' + i + '/posts/' + (i * 7));
+    requestPaths.push('/api/v1/items/' + i);
+    requestPaths.push('/static/css/site' + i + '.css');
+    requestPaths.push('/missing/' + i);
+  }
+}
+
+function Routing() {
+  var matched = 0;
+  for (var i = 0; i < requestPaths.length; i++) {
+    var path = requestPaths[i];
+    for (var j = 0; j < routes.length; j++) {
+      var match = routes[j].regexp.exec(path);
+      if (match !== null) {
+        if (match.groups !== undefined) {
+          matched += Object.keys(match.groups).length;
+        }
+        break;
+      }
+    }
+  }
+  if (matched != 500) throw new Error('Routing: unexpected match count');
+}
@@ -0,0 +1,34 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+load('../base.js');
+load('json.js');
+load('templating.js');
+load('routing.js');
+load('pipeline.js');
+load('cache.js');
+
+var success = true;
+var peakHeapUsage = 0;
+
+function PrintResult(name, result) {
+  print(name + '-ServerWorkloads(Score): ' + result);
+  peakHeapUsage = Math.max(peakHeapUsage, %GetHeapUsage());
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
+
+print('PeakHeapUsage-ServerWorkloads(KB): ' + Math.round(peakHeapUsage / 1024));
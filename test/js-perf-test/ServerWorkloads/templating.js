@@ -0,0 +1,60 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Renders an HTML page from a mustache-style template, as done by
+// server-side view engines.
+
+new BenchmarkSuite('Templating', [1000], [
+  new Benchmark('Templating', false, false, 0, Templating, TemplatingSetup),
+]);
+
+var rowTemplate;
+var pageItems;
+
+function Escape(value) {
+  return String(value).replace(/[&<>"']/g, function(c) {
+    switch (c) {
+      case '&': return '&amp;';
+      case '<': return '&lt;';
+      case '>': return '&gt;';
+      case '"': return '&quot;';
+      default: return '&#39;';
+    }
+  });
+}
+
+function CompileTemplate(source) {
+  var parts = source.split(/\{\{\s*(\w+)\s*\}\}/);
+  return function(data) {
+    var out = '';
+    for (var i = 0; i < parts.length; i++) {
+      out += (i % 2) ? Escape(data[parts[i]]) : parts[i];
+    }
+    return out;
+  };
+}
+
+function TemplatingSetup() {
+  rowTemplate = CompileTemplate(
+      '<tr class="{{ kind }}"><td>{{id}}</td><td>{{ title }}</td>' +
+      '<td><a href="/items/{{id}}">{{ link }}</a></td></tr>');
+  pageItems = [];
+  for (var i = 0; i < 200; i++) {
+    pageItems.push({
+      id: i,
+      kind: (i % 2) ? 'odd' : 'even',
+      title: 'Item <' + i + '> & "friends"',
+      link: 'details',
+    });
+  }
+}
+
+function Templating() {
+  var rows = pageItems.map(rowTemplate).join('\n');
+  var page = `<html><head><title>${pageItems.length} items</title></head>` +
+             `<body><table>${rows}</table></body></html>`;
+  if (page.indexOf('&lt;199&gt;') < 0) {
+    throw new Error('Templating: missing escaped row');
+  }
+}
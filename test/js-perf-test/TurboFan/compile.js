@@ -0,0 +1,88 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures TurboFan compile throughput. Every run creates fresh closures
+// from source, so that no optimized code or feedback is shared between
+// iterations, and forces a synchronous optimized compile of each of them.
+
+const kCompileSources = [
+  // Tokenizer loop in the style of a generated parser.
+  `(function(s) {
+     var tokens = [];
+     var i = 0;
+     while (i < s.length) {
+       var c = s.charCodeAt(i);
+       if (c === 32 || c === 10) { i++; continue; }
+       var start = i;
+       if (c >= 48 && c <= 57) {
+         while (i < s.length && s.charCodeAt(i) >= 48 &&
+                s.charCodeAt(i) <= 57) i++;
+         tokens.push({ kind: 'num', value: +s.substring(start, i) });
+       } else if ((c >= 65 && c <= 90) || (c >= 97 && c <= 122)) {
+         while (i < s.length && /[A-Za-z0-9_]/.test(s[i])) i++;
+         tokens.push({ kind: 'id', value: s.substring(start, i) });
+       } else {
+         tokens.push({ kind: 'punct', value: s[i++] });
+       }
+     }
+     return tokens;
+   })`,
+  // asm.js-style numeric kernel.
+  `(function(a, n) {
+     var sum = 0.0;
+     for (var i = 0; i < n; i = (i + 1) | 0) {
+       var x = +a[i];
+       sum = sum + x * x - (x / 3.0);
+       if (sum > 1e9) sum = sum * 0.5;
+     }
+     return +sum;
+   })`,
+  // Framework-style object and closure manipulation.
+  `(function(items) {
+     var byKey = {};
+     var out = [];
+     items.forEach(function(item) {
+       var key = item.type + ':' + item.id;
+       if (!byKey[key]) byKey[key] = { count: 0, total: 0 };
+       byKey[key].count++;
+       byKey[key].total += item.value;
+     });
+     for (var key in byKey) {
+       out.push({ key: key, avg: byKey[key].total / byKey[key].count });
+     }
+     return out.sort(function(a, b) { return a.avg - b.avg; }).length;
+   })`,
+];
+
+const kCompileItems = [
+  { type: 'a', id: 1, value: 3 },
+  { type: 'b', id: 2, value: 5 },
+  { type: 'a', id: 1, value: 7 },
+];
+const kCompileNumbers = [1.5, 2.5, 3.5, 4.5];
+
+function CallCompiled(index, f) {
+  switch (index) {
+    case 0: return f('foo = 12 + bar_1;');
+    case 1: return f(kCompileNumbers, kCompileNumbers.length);
+    case 2: return f(kCompileItems);
+  }
+}
+
+var compileRun = 0;
+
+function Compile() {
+  // The unique suffix keeps the eval cache from handing back a closure that
+  // already has optimized code.
+  var suffix = '// run ' + compileRun++;
+  for (var i = 0; i < kCompileSources.length; i++) {
+    var f = eval(kCompileSources[i] + suffix);
+    CallCompiled(i, f);
+    CallCompiled(i, f);
+    %OptimizeFunctionOnNextCall(f);
+    CallCompiled(i, f);
+  }
+}
+
+createSuite('Compile', 1000, Compile);
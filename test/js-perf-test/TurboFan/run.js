@@ -8,6 +8,7 @@ load("../base.js");
 const iterations = 100;
 
 load("typedLowering.js");
+load("compile.js");
 
 var success = true;
 
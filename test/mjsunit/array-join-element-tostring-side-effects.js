@@ -60,6 +60,26 @@ function ArrayTests() {
     assertSame('1', a.join());
   })();
 
+  (function ArrayLengthDecreasedAfterPrimitives() {
+    let callCount = 0;
+    const a = [
+      1,
+      'two',
+      {
+        toString() {
+          callCount++;
+          a.length = 4;
+          return '3';
+        }
+      },
+      4,
+      5
+    ];
+    assertSame('1,two,3,4,', a.join());
+    assertSame(1, callCount);
+    assertSame('1,two,3,4', a.join());
+  })();
+
   (function ElementsKindChangedToHoley() {
     let callCount = 0;
     const a = [
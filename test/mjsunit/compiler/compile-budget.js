@@ -0,0 +1,25 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+// Flags: --turbo-compile-budget-node-count=1
+
+// Every graph exceeds the budget, so this runs the reduced pipeline without
+// loop peeling, load elimination, escape analysis and splintering.
+(function() {
+  function foo(a) {
+    let o = {x: 0};
+    for (let i = 0; i < a.length; ++i) {
+      o.x += a[i];
+    }
+    return o.x;
+  }
+
+  assertEquals(6, foo([1, 2, 3]));
+  assertEquals(6, foo([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo([1, 2, 3]));
+  assertEquals(10, foo([1, 2, 3, 4]));
+  assertOptimized(foo);
+})();
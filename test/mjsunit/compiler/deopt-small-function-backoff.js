@@ -0,0 +1,33 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --no-concurrent-recompilation --interrupt-budget=1024
+
+// A small function that keeps deoptimizing must not be re-optimized on the
+// first profiler tick after each deopt.
+
+function f(x) { return x + 1; }
+
+function CallsUntilOptimized() {
+  const kMaxCalls = 1000000;
+  for (let i = 1; i <= kMaxCalls; i++) {
+    f(i);
+    if (isOptimized(f)) return i;
+  }
+  return kMaxCalls;
+}
+
+// Let the profiler optimize f via the small function path first.
+const initial_calls = CallsUntilOptimized();
+assertOptimized(f);
+
+for (let i = 0; i < 3; i++) {
+  %DeoptimizeFunction(f);
+  assertUnoptimized(f);
+  assertEquals(i + 1, %GetDeoptCount(f));
+  assertTrue(CallsUntilOptimized() > initial_calls);
+  // The function is still optimized eventually.
+  assertOptimized(f);
+}
@@ -30,3 +30,35 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = new Array("first", "second", "third", "fourth");
+    return a[i];
+  }
+
+  assertEquals("first", f(0));
+  assertEquals("fourth", f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+})();
+
+// Test variable index access in a loop over a small array literal.
+(function testSmallArrayLiteralLoop() {
+  function f(x) {
+    const a = [x, x + 1, x + 2];
+    let sum = 0;
+    for (let i = 0; i < a.length; ++i) sum += a[i];
+    return sum;
+  }
+
+  assertEquals(6, f(1));
+  assertEquals(9, f(2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(6, f(1));
+  assertEquals(12, f(3));
+})();
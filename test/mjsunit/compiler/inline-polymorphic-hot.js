@@ -0,0 +1,56 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --max-inlined-bytecode-size-cumulative=0
+// Flags: --max-inlined-bytecode-size-small=0 --hot-inlining-frequency=10
+
+// A polymorphic call site in a hot loop is inlined within the absolute
+// budget, even if the cumulative budget is already exhausted.
+
+var inlined = {};
+
+function isInlined(f) {
+  return !(%GetOptimizationStatus(f) & V8OptimizationStatus.kIsExecuting);
+}
+
+function inc(x) {
+  inlined.inc = isInlined(inc);
+  return x + 1;
+}
+
+function dec(x) {
+  inlined.dec = isInlined(dec);
+  return x - 1;
+}
+
+(function TestHotPolymorphicSite() {
+  function hot(n) {
+    var r = 0;
+    for (var i = 0; i < n; i++) r = (i & 1 ? inc : dec)(r);
+    return r;
+  }
+
+  assertEquals(0, hot(100));
+  assertEquals(0, hot(100));
+  %OptimizeFunctionOnNextCall(hot);
+  assertEquals(0, hot(100));
+  assertOptimized(hot);
+  assertTrue(inlined.inc);
+  assertTrue(inlined.dec);
+})();
+
+(function TestColdPolymorphicSite() {
+  function cold(c, x) {
+    return (c ? inc : dec)(x);
+  }
+
+  assertEquals(2, cold(true, 1));
+  assertEquals(0, cold(false, 1));
+  %OptimizeFunctionOnNextCall(cold);
+  assertEquals(2, cold(true, 1));
+  assertEquals(0, cold(false, 1));
+  assertOptimized(cold);
+  assertFalse(inlined.inc);
+  assertFalse(inlined.dec);
+})();
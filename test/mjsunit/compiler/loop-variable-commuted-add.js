@@ -0,0 +1,31 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-variable
+
+(function() {
+  function f(a) {
+    var sum = 0;
+    for (var i = 0; i < a.length; i = 1 + i) sum += a[i];
+    return sum;
+  }
+  var a = new Int32Array([1, 2, 3, 4]);
+  assertEquals(10, f(a));
+  assertEquals(10, f(a));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(10, f(a));
+})();
+
+(function() {
+  function f(s) {
+    var r = 0;
+    for (var i = 0; i < 3; i = s + i) r++;
+    return r;
+  }
+  assertEquals(3, f(1));
+  assertEquals(3, f(1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(3, f(1));
+  assertEquals(1, f("x"));
+})();
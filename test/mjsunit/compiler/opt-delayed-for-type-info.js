@@ -0,0 +1,56 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --no-concurrent-recompilation --interrupt-budget=1024
+// Flags: --delay-opt-for-type-info --type-info-threshold=100
+
+// A hot function is held back while too few of its ICs have type info, but
+// it is still optimized eventually.
+
+// Two functions with the same bytecode, too large for the small function
+// heuristic. Only |full| has seen the branch that loads o.c, so one of the
+// ICs of |sparse| never gets type info.
+function full(o, c) {
+  var s = 0;
+  for (var i = 0; i < 10; i++) {
+    s += o.a + o.b * i;
+    s -= o.b - o.a * i;
+    s += (o.a * i) % (o.b + 1);
+    s ^= o.a + o.b + i;
+    if (c) s += o.c;
+  }
+  return s;
+}
+
+function sparse(o, c) {
+  var s = 0;
+  for (var i = 0; i < 10; i++) {
+    s += o.a + o.b * i;
+    s -= o.b - o.a * i;
+    s += (o.a * i) % (o.b + 1);
+    s ^= o.a + o.b + i;
+    if (c) s += o.c;
+  }
+  return s;
+}
+
+const o = {a: 1, b: 2, c: 3};
+full(o, true);
+
+function CallsUntilOptimized(f) {
+  const kMaxCalls = 1000000;
+  for (let i = 1; i <= kMaxCalls; i++) {
+    f(o, false);
+    if (isOptimized(f)) return i;
+  }
+  return kMaxCalls;
+}
+%NeverOptimizeFunction(CallsUntilOptimized);
+
+const full_calls = CallsUntilOptimized(full);
+assertOptimized(full);
+const sparse_calls = CallsUntilOptimized(sparse);
+assertOptimized(sparse);
+assertTrue(sparse_calls > full_calls);
@@ -0,0 +1,37 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function TestPackedSmiToDouble() {
+  var a = [];
+  for (var i = 0; i < 10000; i++) a.push(i - 5000);
+  assertTrue(%HasSmiElements(a));
+  a.push(0.5);
+  assertTrue(%HasDoubleElements(a));
+  for (var i = 0; i < 10000; i++) assertEquals(i - 5000, a[i]);
+  assertEquals(0.5, a[10000]);
+})();
+
+(function TestHoleySmiToDouble() {
+  var a = new Array(1000);
+  for (var i = 0; i < 1000; i += 2) a[i] = i;
+  assertTrue(%HasSmiElements(a));
+  a[1] = 1.5;
+  assertTrue(%HasDoubleElements(a));
+  for (var i = 0; i < 1000; i += 2) assertEquals(i, a[i]);
+  assertEquals(1.5, a[1]);
+  for (var i = 3; i < 1000; i += 2) {
+    assertEquals(undefined, a[i]);
+    assertFalse(i in a);
+  }
+})();
+
+(function TestCopyOnWriteSmiToDouble() {
+  function literal() { return [1, 2, 3]; }
+  var a = literal();
+  a[0] = 0.5;
+  assertEquals([0.5, 2, 3], a);
+  assertEquals([1, 2, 3], literal());
+})();
@@ -0,0 +1,52 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --typed-array-parallel-sort-threshold=1000
+
+// Long arrays are sorted by counting (8-bit and 16-bit integers) or in
+// parallel chunks; the result must match a sort with a comparator.
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint8ClampedArray,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Float32Array,
+  Float64Array
+];
+
+function fill(array) {
+  var seed = 17;
+  for (var i = 0; i < array.length; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    array[i] = (seed >> 4) - (1 << 25);
+  }
+  if (array instanceof Float32Array || array instanceof Float64Array) {
+    array[0] = NaN;
+    array[1] = -0;
+    array[2] = 0;
+    array[3] = -Infinity;
+  }
+}
+
+for (var constructor of typedArrayConstructors) {
+  for (var length of [7, 1001, 70000]) {
+    var array = new constructor(length);
+    fill(array);
+    var expected = Array.from(array).sort(function(a, b) {
+      if (a < b || (a === 0 && b === 0 && 1 / a < 0)) return -1;
+      if (a > b || (a === 0 && b === 0 && 1 / b < 0)) return 1;
+      if (a !== a) return b !== b ? 0 : 1;
+      if (b !== b) return -1;
+      return 0;
+    });
+    array.sort();
+    for (var i = 0; i < length; i++) {
+      assertSame(expected[i], array[i], constructor.name + '[' + i + ']');
+    }
+  }
+}
@@ -0,0 +1,44 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function keys(object) {
+  var result = [];
+  for (var key in object) result.push(key);
+  return result;
+}
+
+// A dictionary-mode prototype without enumerable properties does not
+// contribute keys.
+var proto = {};
+for (var i = 0; i < 100; i++) {
+  Object.defineProperty(proto, 'method' + i, {value: i, enumerable: false});
+}
+proto[Symbol('symbol')] = 1;
+delete proto.method0;
+assertFalse(%HasFastProperties(proto));
+
+var object = Object.create(proto);
+object.a = 1;
+object.b = 2;
+assertEquals(['a', 'b'], keys(object));
+assertEquals(['a', 'b'], keys(object));
+
+// Own properties shadowing non-enumerable prototype properties are still
+// visited.
+object.method1 = 3;
+assertEquals(['a', 'b', 'method1'], keys(object));
+
+// Enumerable properties and elements on the prototype show up again.
+proto.c = 4;
+assertEquals(['a', 'b', 'method1', 'c'], keys(object));
+delete proto.c;
+assertFalse(%HasFastProperties(proto));
+assertEquals(['a', 'b', 'method1'], keys(object));
+proto[0] = 5;
+assertEquals(['a', 'b', 'method1', '0'], keys(object));
+delete proto[0];
+Object.defineProperty(proto, 1, {value: 6, enumerable: false});
+assertEquals(['a', 'b', 'method1'], keys(object));
@@ -0,0 +1,41 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-sharedarraybuffer
+
+// Atomics.notify may return without taking the futex lock when nobody is
+// waiting. A plain store followed by a notify must still never be missed by
+// a worker that is about to wait on the old value.
+
+if (this.Worker) {
+  (function TestNotifyAfterPlainStore() {
+    const kRounds = 2000;
+    const sab = new SharedArrayBuffer(8);
+    const i32a = new Int32Array(sab);
+
+    const workerScript =
+      `onmessage = function(msg) {
+         const i32a = new Int32Array(msg.sab);
+         for (let round = 0; round < ${kRounds}; round++) {
+           Atomics.store(i32a, 1, round + 1);
+           Atomics.wait(i32a, 0, round);
+         }
+         postMessage("done");
+       };`;
+
+    const worker = new Worker(workerScript, {type: 'string'});
+    worker.postMessage({sab: sab});
+
+    for (let round = 0; round < kRounds; round++) {
+      // Spin until the worker is about to wait on |round|, then race the
+      // plain store and notify against it. A missed notify hangs the worker.
+      while (Atomics.load(i32a, 1) != round + 1) {}
+      i32a[0] = round + 1;
+      Atomics.notify(i32a, 0, 1);
+    }
+
+    assertEquals("done", worker.getMessage());
+    worker.terminate();
+  })();
+}
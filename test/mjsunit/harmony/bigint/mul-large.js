@@ -0,0 +1,64 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Operands long enough to take the Karatsuba path in BigInt::Multiply. The
+// path starts at 34 digits, which is 1088 bits with 32-bit digits and 2176
+// bits with 64-bit digits. The sizes below cover both sides of the threshold
+// and of the first recursion step on both word sizes.
+
+(function TestSquareOfAllOnes() {
+  for (const bits of [1087, 1088, 2048, 2111, 2175, 2176, 2177, 2240, 4352,
+                      4353, 10007]) {
+    const ones = (1n << BigInt(bits)) - 1n;
+    const expected =
+        (1n << BigInt(2 * bits)) - (1n << BigInt(bits + 1)) + 1n;
+    assertEquals(expected, ones * ones);
+    assertEquals(-expected, -ones * ones);
+  }
+})();
+
+(function TestUnbalancedOperands() {
+  const a = (1n << 30000n) + 12345678901234567890n;
+  const b = (1n << 3000n) - 987654321n;
+  const expected = (1n << 33000n) - (987654321n << 30000n) +
+      (12345678901234567890n << 3000n) - 12345678901234567890n * 987654321n;
+  assertEquals(expected, a * b);
+  assertEquals(expected, b * a);
+})();
+
+(function TestAgainstModularArithmetic() {
+  let a = 0x123456789abcdef0fedcba9876543210n;
+  let b = 0xfedcba98765432100123456789abcdefn;
+  for (let i = 0; i < 6; i++) {
+    a = a * a + 0x5555n;
+    b = b * b + 0x3333n;
+  }
+  const m = 0xffffffffffffffc5n;
+  assertEquals(((a % m) * (b % m)) % m, (a * b) % m);
+  assertEquals(((a % m) * (a % m)) % m, (a * a) % m);
+  assertEquals(((a % m) * (b % m)) % m, ((a * b) % m + m) % m);
+})();
+
+(function TestMixedDigits() {
+  // Pseudo-random operands, checked against the schoolbook division.
+  let state = 0x12345678n;
+  function random(bits) {
+    let result = 0n;
+    for (let i = 0; i < bits; i += 32) {
+      state = (state * 1103515245n + 12345n) & 0xFFFFFFFFn;
+      result = (result << 32n) | state;
+    }
+    return BigInt.asUintN(bits, result) | (1n << BigInt(bits - 1));
+  }
+  for (const [x_bits, y_bits] of [[2200, 2200], [2300, 4500], [5000, 2180],
+                                  [1100, 1100], [3000, 9000]]) {
+    const x = random(x_bits);
+    const y = random(y_bits);
+    const product = x * y;
+    assertEquals(x, product / y);
+    assertEquals(y, product / x);
+    assertEquals(0n, product % x);
+    assertEquals(product + x, (y + 1n) * x);
+  }
+})();
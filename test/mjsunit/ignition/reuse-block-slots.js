@@ -0,0 +1,48 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-reuse-block-slots --allow-natives-syntax
+
+function f(n) {
+  let outer = n;
+  {
+    let a = outer + 1;
+    let b = a * 2;
+    outer += b;
+  }
+  {
+    let c;
+    assertEquals(undefined, c);
+    c = outer;
+    {
+      let d = c + 1;
+      outer = d;
+    }
+  }
+  for (let i = 0; i < 2; i++) {
+    let e = i;
+    outer += e;
+  }
+  return outer;
+}
+
+assertEquals(7, f(0));
+assertEquals(12, f(1));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(12, f(1));
+
+function* g() {
+  { let x = 1; yield x; }
+  { let y = 2; yield y; }
+  let z = 3;
+  yield z;
+}
+assertEquals([1, 2, 3], [...g()]);
+
+function h() {
+  { let x = 1; assertEquals(1, x); }
+  { let y; assertThrows(() => { y.foo; }, TypeError); }
+  { assertThrows(() => w, ReferenceError); let w = 1; }
+}
+h();
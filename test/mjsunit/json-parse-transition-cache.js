@@ -0,0 +1,34 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects whose maps have several transitions, in an input long enough for
+// the parser to cache the key taken last from each map.
+const records = [];
+for (let i = 0; i < 100; ++i) {
+  const record = {id: i};
+  if (i % 2 == 0) record.even = true;
+  if (i % 3 == 0) record.third = 'x' + i;
+  record.last = i * 1.5;
+  records.push(record);
+}
+const json = JSON.stringify(records);
+assertTrue(json.length > 1024);
+
+const parsed = JSON.parse(json);
+assertEquals(records, parsed);
+for (let i = 0; i < parsed.length; ++i) {
+  assertEquals(Object.keys(records[i]), Object.keys(parsed[i]));
+}
+// Objects of the same shape share their map.
+assertTrue(%HaveSameMap(parsed[0], parsed[6]));
+assertTrue(%HaveSameMap(parsed[1], parsed[5]));
+assertFalse(%HaveSameMap(parsed[0], parsed[1]));
+
+// A cached key that is only a prefix of the actual key does not match.
+const prefixed = JSON.parse(
+    json.slice(0, -1) + ',{"id":1,"eve":2},{"id":2,"evenly":3}]');
+assertEquals(2, prefixed[100].eve);
+assertEquals(3, prefixed[101].evenly);
@@ -0,0 +1,29 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Keys are serialized through a per-call cache of keys that need no
+// escaping; make sure keys that do need it are still escaped.
+const keys = ['plain', 'with"quote', 'back\\slash', 'new\nline', 'tab\t',
+              'space key', 'été', ' ', 'x'];
+const obj = {};
+for (const key of keys) obj[key] = key.length;
+const expected = '{' + keys.map(k => `${JSON.stringify(k)}:${k.length}`)
+    .join(',') + '}';
+
+// Serialize many times within one call, so cached keys are reused.
+const array = new Array(100).fill(obj);
+assertEquals('[' + new Array(100).fill(expected).join(',') + ']',
+             JSON.stringify(array));
+assertEquals(expected, JSON.stringify(obj));
+
+// Many distinct keys collide in the cache.
+const wide = {};
+for (let i = 0; i < 500; ++i) wide['key' + i] = i;
+wide['key"'] = 'q';
+const roundtrip = JSON.parse(JSON.stringify([wide, wide]));
+assertEquals([wide, wide], roundtrip);
+
+// With a gap, keys are followed by a space.
+assertEquals('{\n "a": 1,\n "b\\"": 2\n}', JSON.stringify({a: 1, 'b"': 2},
+                                                          null, 1));
@@ -0,0 +1,26 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A multi-line comment that contains a line terminator counts as a line
+// terminator for automatic semicolon insertion.
+function returns(body) {
+  return (new Function(body))();
+}
+
+assertEquals(1, returns("return /* */ 1"));
+assertEquals(1, returns("return /**/ 1"));
+assertEquals(1, returns("return /*/ */ 1"));
+assertEquals(1, returns("return /* ** */ 1"));
+assertEquals(undefined, returns("return /*\n*/ 1"));
+assertEquals(undefined, returns("return /* *\n */ 1"));
+assertEquals(undefined, returns("return /* **\n */ 1"));
+assertEquals(undefined, returns("return /* \u2028 */ 1"));
+assertEquals(undefined, returns("return /* \u2029 */ 1"));
+assertEquals(undefined, returns("return /* x\n * y\n */ 1"));
+assertEquals(1, returns("return /* long " + "x".repeat(10000) + " */ 1"));
+
+assertThrows(() => new Function("/* unterminated"), SyntaxError);
+assertThrows(() => new Function("/* unterminated *"), SyntaxError);
+assertThrows(() => new Function("/* unterminated\n"), SyntaxError);
+assertThrows(() => new Function("/*/"), SyntaxError);
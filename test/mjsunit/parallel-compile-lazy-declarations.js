@@ -0,0 +1,39 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --parallel-compile-lazy-declarations
+// Flags: --use-external-strings
+
+var outer_var = 42;
+
+function lazy_declaration(a) {
+  return a + outer_var;
+}
+
+function* lazy_generator() {
+  yield 1;
+  yield 2;
+}
+
+async function lazy_async() {
+  return outer_var;
+}
+
+function never_called() {
+  class foo {};
+  return new foo();
+}
+
+var lazy_expression = function() { return outer_var; };
+
+assertEquals(43, lazy_declaration(1));
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+assertEquals(42, lazy_expression());
+
+var async_result;
+lazy_async().then(v => async_result = v);
+%PerformMicrotaskCheckpoint();
+assertEquals(42, async_result);
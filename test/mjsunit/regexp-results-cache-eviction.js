@@ -0,0 +1,36 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Exercise the sets and eviction of the split and global match results
+// cache with more distinct subjects than it has entries.
+
+const kSubjects = 2000;
+
+function subject(i) {
+  return `a${i},b${i},c${i}`;
+}
+
+for (let round = 0; round < 3; ++round) {
+  for (let i = 0; i < kSubjects; ++i) {
+    // Use internalized subject strings, which are the only cached ones.
+    const s = %InternalizeString(subject(i));
+    assertEquals([`a${i}`, `b${i}`, `c${i}`], s.split(','));
+    assertEquals([`a${i}`, `b${i}`, `c${i}`], s.match(/[a-c]\d+/g));
+  }
+  // Repeated lookups of a few subjects hit the front of their sets. String
+  // literals are internalized, so these lookups go through the cache.
+  const hot = ['a0,b0,c0', 'a1,b1,c1', 'a2,b2,c2'];
+  for (let i = 0; i < 10; ++i) {
+    const s = hot[i % 3];
+    assertEquals([`a${i % 3}`, `b${i % 3}`, `c${i % 3}`], s.split(','));
+  }
+}
+
+// Cached results must not be affected by modifications of returned arrays.
+const s = 'x,y,z';
+const parts = s.split(',');
+parts[0] = 'w';
+assertEquals(['x', 'y', 'z'], s.split(','));
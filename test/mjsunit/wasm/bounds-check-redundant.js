@@ -0,0 +1,56 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-wasm-trap-handler --no-wasm-tier-up --no-liftoff
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 2, false);
+// Loads at offsets 8 and 0 of the same index; the second check is covered by
+// the first one.
+builder.addFunction('sum_down', kSig_i_i)
+    .addBody([
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 8,
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 0,
+        kExprI32Add])
+    .exportFunc();
+// Loads at offsets 0 and 8 of the same index; both checks are needed.
+builder.addFunction('sum_up', kSig_i_i)
+    .addBody([
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 0,
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 8,
+        kExprI32Add])
+    .exportFunc();
+// Grows the memory between two loads of the same index.
+builder.addFunction('grow_between', kSig_i_i)
+    .addBody([
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 0,
+        kExprI32Const, 1,
+        kExprMemoryGrow, kMemoryZero,
+        kExprDrop,
+        kExprGetLocal, 0,
+        kExprI32LoadMem, 0, 0,
+        kExprI32Add])
+    .exportFunc();
+builder.exportMemory('memory');
+
+const instance = builder.instantiate();
+const view = new Int32Array(instance.exports.memory.buffer);
+view[0] = 1;
+view[2] = 2;
+view[kPageSize / 4 - 1] = 3;
+
+assertEquals(3, instance.exports.sum_down(0));
+assertEquals(3, instance.exports.sum_up(0));
+assertTraps(kTrapMemOutOfBounds, _ => instance.exports.sum_down(kPageSize - 8));
+assertTraps(kTrapMemOutOfBounds, _ => instance.exports.sum_up(kPageSize - 4));
+assertTraps(kTrapMemOutOfBounds, _ => instance.exports.sum_down(kPageSize));
+assertEquals(6, instance.exports.grow_between(kPageSize - 4));
@@ -27,3 +27,67 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
   // Should not throw.
   const module = builder.instantiate();
 })();
+
+function getMemoryCopy(size) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('copy', kSig_v_iii).addBody([
+    kExprGetLocal, 0,  // dst
+    kExprGetLocal, 1,  // src
+    kExprGetLocal, 2,  // size
+    kNumericPrefix, kExprMemoryCopy, 0
+  ]).exportFunc();
+  builder.addFunction('copy_const', kSig_v_ii).addBody([
+    kExprGetLocal, 0,  // dst
+    kExprGetLocal, 1,  // src
+    kExprI32Const, size,
+    kNumericPrefix, kExprMemoryCopy, 0
+  ]).exportFunc();
+  return builder.instantiate().exports;
+}
+
+(function TestMemoryCopy() {
+  const exports = getMemoryCopy(4);
+  const mem = new Uint8Array(exports.memory.buffer);
+  mem.set([11, 22, 33, 44, 55, 66, 77, 88], 0);
+
+  exports.copy(100, 0, 8);
+  assertEquals([11, 22, 33, 44, 55, 66, 77, 88], [...mem.slice(100, 108)]);
+
+  // Overlapping ranges are copied as if through a temporary buffer.
+  exports.copy(2, 0, 6);
+  assertEquals([11, 22, 11, 22, 33, 44, 55, 66], [...mem.slice(0, 8)]);
+
+  exports.copy_const(200, 100);
+  assertEquals([11, 22, 33, 44, 0], [...mem.slice(200, 205)]);
+  exports.copy_const(101, 100);
+  assertEquals([11, 11, 22, 33, 44, 66], [...mem.slice(100, 106)]);
+
+  // Copying zero bytes at the end of memory is allowed.
+  exports.copy(kPageSize, 0, 0);
+  assertTraps(kTrapMemOutOfBounds, () => exports.copy(kPageSize - 7, 0, 8));
+  assertTraps(kTrapMemOutOfBounds, () => exports.copy(0, kPageSize - 3, 4));
+  assertTraps(kTrapMemOutOfBounds, () => exports.copy(0, 0, -1));
+  assertTraps(kTrapMemOutOfBounds, () => exports.copy_const(kPageSize - 3, 0));
+})();
+
+(function TestMemoryFill() {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('fill', kSig_v_iii).addBody([
+    kExprGetLocal, 0,  // dst
+    kExprGetLocal, 1,  // value
+    kExprGetLocal, 2,  // size
+    kNumericPrefix, kExprMemoryFill, 0
+  ]).exportFunc();
+  const exports = builder.instantiate().exports;
+  const mem = new Uint8Array(exports.memory.buffer);
+
+  exports.fill(10, 0x1ff, 5);
+  assertEquals([0, 255, 255, 255, 255, 255, 0], [...mem.slice(9, 16)]);
+  exports.fill(kPageSize, 1, 0);
+  assertTraps(kTrapMemOutOfBounds, () => exports.fill(kPageSize - 1, 1, 2));
+  assertEquals(0, mem[kPageSize - 1]);
+})();
@@ -0,0 +1,40 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-compilation-task-units=1 --wasm-low-priority-tier-up
+// Flags: --wasm-tier-up --liftoff
+
+load('test/mjsunit/wasm/wasm-constants.js');
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumFunctions = 100;
+
+function buildModuleBytes() {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < kNumFunctions; ++i) {
+    builder.addFunction('f' + i, kSig_i_i)
+        .addBody([kExprGetLocal, 0, kExprI32Const, i, kExprI32Mul])
+        .exportFunc();
+  }
+  return builder.toBuffer();
+}
+
+function checkInstance(instance) {
+  for (let i = 0; i < kNumFunctions; ++i) {
+    assertEquals(3 * i, instance.exports['f' + i](3));
+  }
+}
+
+(function testSyncCompile() {
+  print(arguments.callee.name);
+  checkInstance(new WebAssembly.Instance(
+      new WebAssembly.Module(buildModuleBytes())));
+})();
+
+(function testAsyncCompile() {
+  print(arguments.callee.name);
+  assertPromiseResult(
+      WebAssembly.instantiate(buildModuleBytes()),
+      result => checkInstance(result.instance));
+})();
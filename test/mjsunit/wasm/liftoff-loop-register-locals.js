@@ -0,0 +1,76 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-future --no-wasm-tier-up
+// Flags: --liftoff-loop-register-locals
+
+load('test/mjsunit/wasm/wasm-constants.js');
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testSumLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Local 1 starts out as a constant, local 0 in a register.
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals({i32_count: 1})
+      .addBody([
+        kExprLoop, kWasmStmt,
+          kExprGetLocal, 1, kExprGetLocal, 0, kExprI32Add, kExprSetLocal, 1,
+          kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprGetLocal, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(55, instance.exports.sum(10));
+  assertEquals(5050, instance.exports.sum(100));
+})();
+
+(function testSharedRegisterLocals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals 1 and 2 hold the same value in the same register at the loop
+  // header, but only local 1 is changed inside the loop.
+  builder.addFunction('shared', kSig_i_i)
+      .addLocals({i32_count: 2})
+      .addBody([
+        kExprGetLocal, 0, kExprTeeLocal, 1, kExprSetLocal, 2,
+        kExprLoop, kWasmStmt,
+          kExprGetLocal, 1, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 1,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprGetLocal, 2, kExprGetLocal, 1, kExprI32Add
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(7, instance.exports.shared(7));
+  assertEquals(1, instance.exports.shared(1));
+})();
+
+(function testNestedLoops() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Computes the product of both parameters by counting.
+  builder.addFunction('mul', kSig_i_ii)
+      .addLocals({i32_count: 2})
+      .addBody([
+        kExprLoop, kWasmStmt,
+          kExprGetLocal, 1, kExprSetLocal, 3,
+          kExprLoop, kWasmStmt,
+            kExprGetLocal, 2, kExprI32Const, 1, kExprI32Add, kExprSetLocal, 2,
+            kExprGetLocal, 3, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 3,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprGetLocal, 2
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(42, instance.exports.mul(6, 7));
+  assertEquals(9, instance.exports.mul(3, 3));
+})();
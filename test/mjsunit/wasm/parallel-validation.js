@@ -0,0 +1,41 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-parallel-validation
+
+load('test/mjsunit/wasm/wasm-constants.js');
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumFunctions = 50;
+
+function buildModule(invalid_functions) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < kNumFunctions; ++i) {
+    const body = invalid_functions.includes(i) ?
+        [kExprI64Const, 0] :
+        [kExprGetLocal, 0, kExprI32Const, i, kExprI32Add];
+    builder.addFunction('f' + i, kSig_i_i).addBody(body).exportFunc();
+  }
+  return builder.toBuffer();
+}
+
+(function testValidModule() {
+  print(arguments.callee.name);
+  const bytes = buildModule([]);
+  assertTrue(WebAssembly.validate(bytes));
+  const instance = new WebAssembly.Instance(new WebAssembly.Module(bytes));
+  assertEquals(17, instance.exports.f10(7));
+})();
+
+(function testInvalidModule() {
+  print(arguments.callee.name);
+  const bytes = buildModule([33, 7, 41]);
+  assertFalse(WebAssembly.validate(bytes));
+  assertThrows(() => new WebAssembly.Module(bytes), WebAssembly.CompileError);
+})();
+
+(function testInvalidLastFunction() {
+  print(arguments.callee.name);
+  assertFalse(WebAssembly.validate(buildModule([kNumFunctions - 1])));
+})();
@@ -353,6 +353,7 @@ let kExprF32ReinterpretI32 = 0xbe;
 let kExprF64ReinterpretI64 = 0xbf;
 
 // Prefix opcodes
+let kNumericPrefix = 0xfc;
 let kAtomicPrefix = 0xfe;
 
 let kExprAtomicWake = 0x00;
@@ -423,6 +424,10 @@ let kExprI64AtomicCompareExchange8U = 0x4c;
 let kExprI64AtomicCompareExchange16U = 0x4d;
 let kExprI64AtomicCompareExchange32U = 0x4e;
 
+// Bulk memory opcodes, following kNumericPrefix.
+let kExprMemoryCopy = 0x0a;
+let kExprMemoryFill = 0x0b;
+
 let kTrapUnreachable          = 0;
 let kTrapMemOutOfBounds       = 1;
 let kTrapDivByZero            = 2;
@@ -95,5 +95,73 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, PriorityOrder) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(
+      Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+  BlockingCompilationJob* cold = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* hot = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* warm = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* warm2 = new BlockingCompilationJob(i_isolate(), fun);
+
+  bool old_flag = FLAG_block_concurrent_recompilation;
+  FLAG_block_concurrent_recompilation = true;
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  dispatcher.QueueForOptimization(cold, 1);
+  dispatcher.QueueForOptimization(warm, 2);
+  dispatcher.QueueForOptimization(hot, 3);
+  dispatcher.QueueForOptimization(warm2, 2);
+
+  // Jobs are served by priority and in FIFO order within a priority.
+  EXPECT_EQ(hot, dispatcher.NextInput());
+  EXPECT_EQ(warm, dispatcher.NextInput());
+  EXPECT_EQ(warm2, dispatcher.NextInput());
+  EXPECT_EQ(cold, dispatcher.NextInput());
+  EXPECT_EQ(nullptr, dispatcher.NextInput());
+  delete cold;
+  delete hot;
+  delete warm;
+  delete warm2;
+
+  dispatcher.Stop();
+  FLAG_block_concurrent_recompilation = old_flag;
+}
+
+TEST_F(OptimizingCompileDispatcherTest, CancelLowestPriority) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(
+      Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+  BlockingCompilationJob* cold = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* warm = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* hot = new BlockingCompilationJob(i_isolate(), fun);
+
+  bool old_flag = FLAG_block_concurrent_recompilation;
+  int old_length = FLAG_concurrent_recompilation_queue_length;
+  FLAG_block_concurrent_recompilation = true;
+  FLAG_concurrent_recompilation_queue_length = 2;
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  dispatcher.QueueForOptimization(cold, 1);
+  dispatcher.QueueForOptimization(warm, 2);
+  EXPECT_FALSE(dispatcher.IsQueueAvailable());
+  EXPECT_FALSE(dispatcher.IsQueueAvailable(1));
+  EXPECT_TRUE(dispatcher.IsQueueAvailable(3));
+
+  // Queueing the hot job cancels and disposes the cold one.
+  dispatcher.QueueForOptimization(hot, 3);
+  EXPECT_EQ(hot, dispatcher.NextInput());
+  EXPECT_EQ(warm, dispatcher.NextInput());
+  EXPECT_EQ(nullptr, dispatcher.NextInput());
+  delete warm;
+  delete hot;
+
+  dispatcher.Stop();
+  FLAG_block_concurrent_recompilation = old_flag;
+  FLAG_concurrent_recompilation_queue_length = old_length;
+}
+
 }  // namespace internal
 }  // namespace v8
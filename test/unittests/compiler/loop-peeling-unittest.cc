@@ -275,6 +275,32 @@ TEST_F(LoopPeelingTest, SimpleNestedLoopWithCounter_peel_inner) {
 }
 
 
+TEST_F(LoopPeelingTest, SimpleNestedLoop_peel_outer_loops) {
+  bool old_flag = FLAG_turbo_peel_outer_loops;
+  FLAG_turbo_peel_outer_loops = true;
+
+  Node* p0 = Parameter(0);
+  While outer = NewWhile(p0);
+  While inner = NewWhile(p0);
+  Nest(&inner, &outer);
+
+  Node* r = InsertReturn(p0, start(), outer.exit);
+
+  LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+  LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                    node_origins());
+  peeler.PeelInnerLoopsOfTree();
+  FLAG_turbo_peel_outer_loops = old_flag;
+
+  // Both loops were peeled, so their exits merge with the peeled iterations.
+  EXPECT_EQ(IrOpcode::kMerge, inner.exit->opcode());
+  EXPECT_EQ(IrOpcode::kMerge, outer.exit->opcode());
+  EXPECT_NE(start(), NodeProperties::GetControlInput(outer.loop, 0));
+  EXPECT_NE(outer.if_true, NodeProperties::GetControlInput(inner.loop, 0));
+  EXPECT_THAT(r, IsReturn(p0, start(), outer.exit));
+}
+
+
 TEST_F(LoopPeelingTest, SimpleInnerCounter_peel_inner) {
   Node* p0 = Parameter(0);
   While outer = NewWhile(p0);
@@ -131,6 +131,18 @@ TEST_F(NodeTest, OwnedBy) {
 }
 
 
+TEST_F(NodeTest, HasMultipleUses) {
+  Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
+  EXPECT_FALSE(n0->HasMultipleUses());
+  Node* n1 = Node::New(zone(), 1, &kOp1, 1, &n0, false);
+  EXPECT_FALSE(n0->HasMultipleUses());
+  Node* n0_n0[] = {n0, n0};
+  Node::New(zone(), 2, &kOp2, 2, n0_n0, false);
+  EXPECT_TRUE(n0->HasMultipleUses());
+  EXPECT_FALSE(n1->HasMultipleUses());
+}
+
+
 TEST_F(NodeTest, ReplaceUsesNone) {
   Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
   Node* n1 = Node::New(zone(), 1, &kOp1, 1, &n0, false);
@@ -107,6 +107,46 @@ TEST_F(RedundancyEliminationTest, CheckBounds) {
   }
 }
 
+// -----------------------------------------------------------------------------
+// CheckIf
+
+TEST_F(RedundancyEliminationTest, CheckIfOnBothSidesOfDiamond) {
+  Node* condition = Parameter(0);
+  Node* value = Parameter(1);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  Node* branch = graph()->NewNode(common()->Branch(), condition, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongValue), value, effect,
+      if_true);
+  Reduction r1 = Reduce(etrue);
+  ASSERT_TRUE(r1.Changed());
+  EXPECT_EQ(r1.replacement(), etrue);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongValue), value, effect,
+      if_false);
+  Reduction r2 = Reduce(efalse);
+  ASSERT_TRUE(r2.Changed());
+  EXPECT_EQ(r2.replacement(), efalse);
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  Reduction r3 = Reduce(effect);
+  ASSERT_TRUE(r3.Changed());
+
+  Node* check = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongValue), value, effect,
+      control);
+  Reduction r4 = Reduce(check);
+  ASSERT_TRUE(r4.Changed());
+  EXPECT_EQ(r4.replacement(), etrue);
+}
+
 // -----------------------------------------------------------------------------
 // CheckNumber
 
@@ -155,6 +155,32 @@ TEST_F(ZoneStatsTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZoneStatsTest, AllocatedBytesByZoneName) {
+  ZoneStats::Scope before(zone_stats(), "before");
+  size_t before_allocated = Allocate(before.zone());
+  USE(before_allocated);
+
+  ZoneStats::StatsScope stats(zone_stats());
+  size_t first_allocated = Allocate(before.zone());
+  size_t second_allocated = 0;
+  {
+    ZoneStats::Scope returned(zone_stats(), "returned");
+    second_allocated += Allocate(returned.zone());
+    second_allocated += Allocate(returned.zone());
+  }
+  ZoneStats::Scope live(zone_stats(), "live");
+  size_t live_allocated = Allocate(live.zone());
+
+  ZoneStats::StatsScope::AllocatedBytesByZoneName result;
+  stats.GetAllocatedBytesByZoneName(&result);
+  ASSERT_EQ(3u, result.size());
+  ASSERT_EQ(first_allocated, result["before"]);
+  ASSERT_EQ(second_allocated, result["returned"]);
+  ASSERT_EQ(live_allocated, result["live"]);
+  ASSERT_EQ(stats.GetTotalAllocatedBytes(),
+            first_allocated + second_allocated + live_allocated);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
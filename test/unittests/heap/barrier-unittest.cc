@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "src/heap/barrier.h"
+
+#include <atomic>
+
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -90,6 +93,49 @@ TEST(OneshotBarrier, EarlyFinish_Concurrent) {
 
 namespace {
 
+class ThreadFinishingBeforeJoin final : public base::Thread {
+ public:
+  ThreadFinishingBeforeJoin(OneshotBarrier* barrier, std::atomic<bool>* joined)
+      : base::Thread(Options("ThreadFinishingBeforeJoin")),
+        barrier_(barrier),
+        joined_(joined) {}
+
+  void Run() final {
+    while (!barrier_->Wait()) {
+    }
+    finished_before_join_ = !joined_->load();
+  }
+
+  bool finished_before_join() const { return finished_before_join_; }
+
+ private:
+  OneshotBarrier* const barrier_;
+  std::atomic<bool>* const joined_;
+  bool finished_before_join_ = false;
+};
+
+}  // namespace
+
+TEST(OneshotBarrier, NoTimeoutWhilePending_Concurrent) {
+  // A short timeout that would trigger while the pending task is busy.
+  OneshotBarrier barrier(base::TimeDelta::FromMilliseconds(1));
+  std::atomic<bool> joined(false);
+  barrier.StartPending();
+  barrier.Start();
+  ThreadFinishingBeforeJoin thread(&barrier, &joined);
+  thread.Start();
+  base::OS::Sleep(base::TimeDelta::FromMilliseconds(50));
+  joined.store(true);
+  barrier.Join();
+  while (!barrier.Wait()) {
+  }
+  thread.Join();
+  EXPECT_FALSE(thread.finished_before_join());
+  EXPECT_TRUE(barrier.DoneForTesting());
+}
+
+namespace {
+
 class CountingThread final : public base::Thread {
  public:
   CountingThread(OneshotBarrier* barrier, base::Mutex* mutex, size_t* work)
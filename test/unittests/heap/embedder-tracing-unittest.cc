@@ -38,6 +38,7 @@ class MockEmbedderHeapTracer : public EmbedderHeapTracer {
   MOCK_METHOD1(RegisterV8References,
                void(const std::vector<std::pair<void*, void*> >&));
   MOCK_METHOD1(AdvanceTracing, bool(double deadline_in_ms));
+  MOCK_METHOD0(SupportsConcurrentRegistration, bool());
 };
 
 TEST(LocalEmbedderHeapTracer, InUse) {
@@ -59,10 +60,28 @@ TEST(LocalEmbedderHeapTracer, NoRemoteTracer) {
   local_tracer.TraceEpilogue();
 }
 
+TEST(LocalEmbedderHeapTracer, SupportsConcurrentRegistration) {
+  StrictMock<MockEmbedderHeapTracer> remote_tracer;
+  LocalEmbedderHeapTracer local_tracer(nullptr);
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  // The embedder is queried once per cycle in the prologue.
+  EXPECT_FALSE(local_tracer.SupportsConcurrentRegistration());
+  EXPECT_CALL(remote_tracer, TracePrologue()).Times(2);
+  EXPECT_CALL(remote_tracer, SupportsConcurrentRegistration())
+      .WillOnce(Return(true))
+      .WillOnce(Return(false));
+  local_tracer.TracePrologue();
+  EXPECT_TRUE(local_tracer.SupportsConcurrentRegistration());
+  local_tracer.TracePrologue();
+  EXPECT_FALSE(local_tracer.SupportsConcurrentRegistration());
+}
+
 TEST(LocalEmbedderHeapTracer, TracePrologueForwards) {
   StrictMock<MockEmbedderHeapTracer> remote_tracer;
   LocalEmbedderHeapTracer local_tracer(nullptr);
   local_tracer.SetRemoteTracer(&remote_tracer);
+  EXPECT_CALL(remote_tracer, SupportsConcurrentRegistration())
+      .WillOnce(Return(false));
   EXPECT_CALL(remote_tracer, TracePrologue());
   local_tracer.TracePrologue();
 }
@@ -25,12 +25,20 @@ class GCIdleTimeHandlerTest : public ::testing::Test {
     result.contexts_disposal_rate = GCIdleTimeHandler::kHighContextDisposalRate;
     result.incremental_marking_stopped = false;
     result.size_of_objects = kSizeOfObjects;
+    result.new_space_capacity = kNewSpaceCapacity;
+    result.used_new_space_size = 0;
+    result.scavenge_speed_in_bytes_per_ms = kScavengeSpeed;
+    result.final_incremental_mark_compact_speed_in_bytes_per_ms =
+        kMarkCompactSpeed;
+    result.incremental_marking_limit_reached = false;
     return result;
   }
 
   static const size_t kSizeOfObjects = 100 * MB;
   static const size_t kMarkCompactSpeed = 200 * KB;
   static const size_t kMarkingSpeed = 200 * KB;
+  static const size_t kNewSpaceCapacity = 16 * MB;
+  static const size_t kScavengeSpeed = 1 * MB;
   static const int kMaxNotifications = 100;
 
  private:
@@ -240,5 +248,71 @@ TEST_F(GCIdleTimeHandlerTest, DoneIfNotMakingProgressOnIncrementalMarking) {
   EXPECT_EQ(DONE, action.type);
 }
 
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeLowUtilization) {
+  EXPECT_FALSE(
+      GCIdleTimeHandler::ShouldDoScavenge(100, 16 * MB, 1 * MB, 1 * MB));
+}
+
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeFitsIdleTime) {
+  EXPECT_TRUE(
+      GCIdleTimeHandler::ShouldDoScavenge(100, 16 * MB, 12 * MB, 1 * MB));
+  EXPECT_FALSE(
+      GCIdleTimeHandler::ShouldDoScavenge(10, 16 * MB, 12 * MB, 1 * MB));
+}
+
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeInitialSpeed) {
+  size_t used = 10 * GCIdleTimeHandler::kInitialConservativeScavengeSpeed;
+  EXPECT_FALSE(GCIdleTimeHandler::ShouldDoScavenge(10, used, used, 0));
+  EXPECT_TRUE(GCIdleTimeHandler::ShouldDoScavenge(100, used, used, 0));
+}
+
+
+TEST_F(GCIdleTimeHandlerTest, IdlePeriodScavenge) {
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.used_new_space_size = kNewSpaceCapacity;
+  double idle_time_ms = 100;
+  GCIdleTimeAction action =
+      handler()->ComputeForIdlePeriod(idle_time_ms, heap_state, false);
+  EXPECT_EQ(DO_SCAVENGE, action.type);
+  EXPECT_TRUE(action.strict_deadline);
+}
+
+
+TEST_F(GCIdleTimeHandlerTest, IdlePeriodIncrementalStepWithStrictDeadline) {
+  if (!handler()->Enabled()) return;
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  double idle_time_ms = 10;
+  GCIdleTimeAction action =
+      handler()->ComputeForIdlePeriod(idle_time_ms, heap_state, false);
+  EXPECT_EQ(DO_INCREMENTAL_STEP, action.type);
+  EXPECT_TRUE(action.strict_deadline);
+}
+
+
+TEST_F(GCIdleTimeHandlerTest, IdlePeriodStartIncrementalMarking) {
+  if (!handler()->Enabled()) return;
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.incremental_marking_limit_reached = true;
+  double idle_time_ms = 10;
+  GCIdleTimeAction action =
+      handler()->ComputeForIdlePeriod(idle_time_ms, heap_state, true);
+  EXPECT_EQ(DO_START_INCREMENTAL_MARKING, action.type);
+  action = handler()->ComputeForIdlePeriod(idle_time_ms, heap_state, false);
+  EXPECT_EQ(DONE, action.type);
+}
+
+
+TEST_F(GCIdleTimeHandlerTest, IdlePeriodZeroIdleTimeNothingToDo) {
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.used_new_space_size = kNewSpaceCapacity;
+  GCIdleTimeAction action =
+      handler()->ComputeForIdlePeriod(0, heap_state, true);
+  EXPECT_EQ(DO_NOTHING, action.type);
+}
+
 }  // namespace internal
 }  // namespace v8
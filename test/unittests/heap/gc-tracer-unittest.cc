@@ -331,6 +331,84 @@ TEST_F(GCTracerTest, MutatorUtilization) {
                    tracer->AverageMarkCompactMutatorUtilization());
 }
 
+TEST(GCTracer, DurationHistogramBuckets) {
+  // Small durations map one microsecond per bucket.
+  for (uint64_t us = 0; us < DurationHistogram::kSubBuckets; us++) {
+    EXPECT_EQ(static_cast<int>(us), DurationHistogram::BucketIndex(us));
+    EXPECT_EQ(us + 1, DurationHistogram::BucketUpperBound(
+                          DurationHistogram::BucketIndex(us)));
+  }
+  // Larger durations are covered by buckets with bounded relative width.
+  for (uint64_t us = DurationHistogram::kSubBuckets; us < 100000; us += 7) {
+    int index = DurationHistogram::BucketIndex(us);
+    uint64_t upper = DurationHistogram::BucketUpperBound(index);
+    EXPECT_LT(us, upper);
+    EXPECT_LE(upper, us + us / DurationHistogram::kSubBuckets + 1);
+    EXPECT_GE(us, DurationHistogram::BucketUpperBound(index - 1));
+  }
+  EXPECT_EQ(
+      DurationHistogram::kNumberOfBuckets - 1,
+      DurationHistogram::BucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(GCTracer, DurationHistogramPercentiles) {
+  DurationHistogram histogram;
+  EXPECT_EQ(0.0, histogram.Percentile(99));
+  for (int i = 1; i <= 100; i++) {
+    histogram.AddSample(i);
+  }
+  EXPECT_EQ(100u, histogram.count());
+  EXPECT_DOUBLE_EQ(5050, histogram.total_ms());
+  EXPECT_DOUBLE_EQ(100, histogram.max_ms());
+  EXPECT_LE(50, histogram.Percentile(50));
+  EXPECT_GE(50 * 1.125, histogram.Percentile(50));
+  EXPECT_LE(99, histogram.Percentile(99));
+  EXPECT_GE(100, histogram.Percentile(99));
+  EXPECT_DOUBLE_EQ(100, histogram.Percentile(100));
+  histogram.Reset();
+  EXPECT_EQ(0u, histogram.count());
+}
+
+TEST_F(GCTracerTest, PhaseStatistics) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  for (int i = 0; i < 3; i++) {
+    tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                  "collector unittest");
+    tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 10);
+    tracer->AddBackgroundScopeSample(
+        GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 20, nullptr);
+    tracer->Stop(MARK_COMPACTOR);
+  }
+
+  GCTracer::PhaseStatistics stats;
+  tracer->GetPhaseStatistics(GCTracer::Event::MARK_COMPACTOR, &stats);
+  EXPECT_FALSE(stats.is_background);
+  EXPECT_EQ(3u, stats.histogram->count());
+  tracer->GetPhaseStatistics(GCTracer::Event::SCAVENGER, &stats);
+  EXPECT_EQ(0u, stats.histogram->count());
+
+  tracer->GetPhaseStatistics(
+      GCTracer::kNumberOfPauseTypes + GCTracer::Scope::MC_MARK, &stats);
+  EXPECT_STREQ("V8.GC_MC_MARK", stats.name);
+  EXPECT_FALSE(stats.is_background);
+  EXPECT_EQ(3u, stats.histogram->count());
+  EXPECT_DOUBLE_EQ(30, stats.histogram->total_ms());
+  EXPECT_DOUBLE_EQ(10, stats.histogram->Percentile(99));
+
+  tracer->GetPhaseStatistics(
+      GCTracer::kNumberOfPauseTypes + GCTracer::Scope::MC_BACKGROUND_MARKING,
+      &stats);
+  EXPECT_TRUE(stats.is_background);
+  EXPECT_EQ(3u, stats.histogram->count());
+  EXPECT_DOUBLE_EQ(60, stats.histogram->total_ms());
+
+  tracer->GetPhaseStatistics(
+      GCTracer::kNumberOfPauseTypes + GCTracer::Scope::MC_SWEEP, &stats);
+  EXPECT_EQ(0u, stats.histogram->count());
+}
+
 TEST_F(GCTracerTest, BackgroundScavengerScope) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -48,6 +48,20 @@ TEST_F(HeapControllerTest, HeapGrowingFactor) {
   CheckEqualRounded(min_factor, heap_controller.GrowingFactor(400, 1, 4.0));
 }
 
+TEST_F(HeapControllerTest, GCTimeBudget) {
+  HeapController heap_controller(i_isolate()->heap());
+  const double default_mu = heap_controller.target_mutator_utilization();
+  heap_controller.SetGCTimeBudget(100);
+  CheckEqualRounded(0.9, heap_controller.target_mutator_utilization());
+  // A larger budget allows the heap to stay smaller.
+  EXPECT_LT(heap_controller.GrowingFactor(100, 1, 4.0),
+            HeapController(i_isolate()->heap()).GrowingFactor(100, 1, 4.0));
+  heap_controller.SetGCTimeBudget(900);
+  CheckEqualRounded(0.5, heap_controller.target_mutator_utilization());
+  heap_controller.SetGCTimeBudget(0);
+  CheckEqualRounded(default_mu, heap_controller.target_mutator_utilization());
+}
+
 TEST_F(HeapControllerTest, MaxHeapGrowingFactor) {
   HeapController heap_controller(i_isolate()->heap());
   CheckEqualRounded(
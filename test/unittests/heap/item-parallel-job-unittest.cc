@@ -288,6 +288,27 @@ TEST_F(ItemParallelJobTest, DistributeItemsMultipleTasks) {
   }
 }
 
+TEST_F(ItemParallelJobTest, ScheduleBackgroundTasksBeforeRun) {
+  const int kItemsAndTasks = 16;
+  bool was_processed[kItemsAndTasks] = {};
+  OneShotBarrier barrier(kItemsAndTasks);
+  ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                      parallel_job_semaphore());
+  for (int i = 0; i < kItemsAndTasks; i++) {
+    job.AddItem(new SimpleItem(&was_processed[i]));
+    const bool wait_when_done = i == 0;
+    job.AddTask(
+        new TaskProcessingOneItem(i_isolate(), &barrier, wait_when_done));
+  }
+  job.ScheduleBackgroundTasks(i_isolate()->async_counters());
+  // Only the main thread task is left to run.
+  EXPECT_FALSE(was_processed[0]);
+  job.Run(i_isolate()->async_counters());
+  for (int i = 0; i < kItemsAndTasks; i++) {
+    EXPECT_TRUE(was_processed[i]);
+  }
+}
+
 TEST_F(ItemParallelJobTest, DifferentItems) {
   bool item_a = false;
   bool item_b = false;
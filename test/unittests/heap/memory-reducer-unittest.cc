@@ -329,5 +329,84 @@ TEST(MemoryReducer, FromRunToWait) {
   EXPECT_EQ(2000, state1.last_gc_time_ms);
 }
 
+class MemoryReducerCoordinatorTest : public ::testing::Test {
+ public:
+  static const int kStaggerMs = 100;
+
+  void SetUp() override {
+    old_stagger_ms_ = FLAG_memory_reducer_stagger_ms;
+    FLAG_memory_reducer_stagger_ms = kStaggerMs;
+  }
+
+  void TearDown() override {
+    FLAG_memory_reducer_stagger_ms = old_stagger_ms_;
+  }
+
+  // The coordinator only uses the reducers as keys.
+  MemoryReducer* reducer(int index) {
+    return reinterpret_cast<MemoryReducer*>(&reducer_ids_[index]);
+  }
+
+  MemoryReducerCoordinator* coordinator() { return &coordinator_; }
+
+ private:
+  int old_stagger_ms_;
+  int reducer_ids_[3];
+  MemoryReducerCoordinator coordinator_;
+};
+
+TEST_F(MemoryReducerCoordinatorTest, StaggersReducers) {
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1000));
+  // The reducer that started the last GC is not delayed by its own GC.
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1010));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 10, 1050));
+  EXPECT_FALSE(
+      coordinator()->TryAcquire(reducer(1), 10, 1010 + kStaggerMs - 1));
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(1), 10, 1010 + kStaggerMs));
+  EXPECT_FALSE(
+      coordinator()->TryAcquire(reducer(0), 10, 1010 + kStaggerMs + 1));
+}
+
+TEST_F(MemoryReducerCoordinatorTest, LargestReclaimableMemoryGoesFirst) {
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1000));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 10, 1010));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(2), 20, 1020));
+  // After the stagger delay the reducer expecting to free more memory wins,
+  // even though the other one asked first.
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 10, 1000 + kStaggerMs));
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(2), 20, 1010 + kStaggerMs));
+  EXPECT_TRUE(
+      coordinator()->TryAcquire(reducer(1), 10, 1010 + 2 * kStaggerMs));
+}
+
+TEST_F(MemoryReducerCoordinatorTest, StaleCandidatesExpire) {
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1000));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 20, 1010));
+  // Reducer 1 never asks again, so after the long delay it no longer blocks
+  // reducers that expect to free less memory.
+  EXPECT_FALSE(coordinator()->TryAcquire(
+      reducer(2), 10, 1010 + MemoryReducer::kLongDelayMs));
+  EXPECT_TRUE(coordinator()->TryAcquire(
+      reducer(2), 10, 1011 + MemoryReducer::kLongDelayMs));
+}
+
+TEST_F(MemoryReducerCoordinatorTest, RemoveCandidate) {
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1000));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 20, 1010));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(2), 10, 1000 + kStaggerMs));
+  // A reducer that finished its GC by other means no longer blocks others.
+  coordinator()->RemoveCandidate(reducer(1));
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(2), 10, 1001 + kStaggerMs));
+}
+
+TEST_F(MemoryReducerCoordinatorTest, TearDownCancelsStagger) {
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(0), 10, 1000));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(1), 10, 1010));
+  EXPECT_FALSE(coordinator()->TryAcquire(reducer(2), 20, 1020));
+  coordinator()->TearDown(reducer(0));
+  coordinator()->TearDown(reducer(2));
+  EXPECT_TRUE(coordinator()->TryAcquire(reducer(1), 10, 1030));
+}
+
 }  // namespace internal
 }  // namespace v8
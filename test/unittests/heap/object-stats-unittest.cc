@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cmath>
 #include <unordered_set>
 
 #include "src/heap/object-stats.h"
@@ -33,6 +34,41 @@ TEST(ObjectStats, NoClashWithInstanceTypes) {
 #undef CHECK_REGULARINSTANCE_TYPE
 }
 
+TEST(ObjectStats, SampledUnitsAreExtrapolated) {
+  ObjectStats stats(nullptr);
+  const size_t kObjectSize = 64;
+  // An exactly visited unit is not scaled.
+  stats.RecordObjectStats(FIXED_ARRAY_TYPE, kObjectSize);
+  // Two sampled units with inclusion probability 1/4 stand in for eight.
+  for (int unit = 0; unit < 2; unit++) {
+    stats.BeginSampledUnit();
+    stats.RecordObjectStats(FIXED_ARRAY_TYPE, kObjectSize);
+    stats.RecordObjectStats(FIXED_ARRAY_TYPE, kObjectSize);
+    stats.EndSampledUnit(0.25);
+  }
+  stats.CheckpointObjectStats();
+  EXPECT_EQ(1u + 2 * 2 * 4, stats.object_count_last_gc(FIXED_ARRAY_TYPE));
+  EXPECT_EQ((1 + 2 * 2 * 4) * kObjectSize,
+            stats.object_size_last_gc(FIXED_ARRAY_TYPE));
+  // Variance: 2 * (1 - p) / p^2 * (2 * kObjectSize)^2.
+  double sigma = std::sqrt(2 * 0.75 / (0.25 * 0.25)) * 2 * kObjectSize;
+  EXPECT_EQ(static_cast<size_t>(1.96 * sigma),
+            stats.object_size_error_last_gc(FIXED_ARRAY_TYPE));
+  // Types that were not sampled have no error.
+  EXPECT_EQ(0u, stats.object_size_error_last_gc(MAP_TYPE));
+}
+
+TEST(ObjectStats, FullyVisitedUnitsHaveNoError) {
+  ObjectStats stats(nullptr);
+  stats.BeginSampledUnit();
+  stats.RecordObjectStats(FIXED_ARRAY_TYPE, 32);
+  stats.EndSampledUnit(1);
+  stats.CheckpointObjectStats();
+  EXPECT_EQ(1u, stats.object_count_last_gc(FIXED_ARRAY_TYPE));
+  EXPECT_EQ(32u, stats.object_size_last_gc(FIXED_ARRAY_TYPE));
+  EXPECT_EQ(0u, stats.object_size_error_last_gc(FIXED_ARRAY_TYPE));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
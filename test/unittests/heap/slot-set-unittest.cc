@@ -4,7 +4,9 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
+#include "src/base/platform/platform.h"
 #include "src/globals.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
@@ -73,6 +75,161 @@ TEST(SlotSet, Iterate) {
   }
 }
 
+TEST(SlotSet, SparseBucketUpgrade) {
+  // Fill the first bucket one slot at a time so that it starts out sparse and
+  // is upgraded to a bitmap on the way. Insert in descending order to exercise
+  // the sorted insertion into the sparse representation.
+  const int kSlots = 64;
+  SlotSet set;
+  set.SetPageStart(0);
+  for (int i = kSlots - 1; i >= 0; i--) {
+    set.Insert(i * 2 * kPointerSize);
+    set.Insert(i * 2 * kPointerSize);
+    for (int j = 0; j < kSlots; j++) {
+      EXPECT_EQ(j >= i, set.Lookup(j * 2 * kPointerSize));
+      EXPECT_FALSE(set.Lookup((j * 2 + 1) * kPointerSize));
+    }
+    int count = 0;
+    set.Iterate(
+        [&count](MaybeObjectSlot slot) {
+          count++;
+          return KEEP_SLOT;
+        },
+        SlotSet::KEEP_EMPTY_BUCKETS);
+    EXPECT_EQ(kSlots - i, count);
+  }
+}
+
+TEST(SlotSet, IterateSparseBucketAndInsert) {
+  SlotSet set;
+  set.SetPageStart(0);
+  set.Insert(0);
+  set.Insert(2 * kPointerSize);
+  // Inserting into the bucket that is being iterated must not deadlock.
+  int count = set.Iterate(
+      [&set](MaybeObjectSlot slot) {
+        set.Insert(static_cast<int>(slot.address()) + kPointerSize);
+        return slot.address() == 0 ? REMOVE_SLOT : KEEP_SLOT;
+      },
+      SlotSet::PREFREE_EMPTY_BUCKETS);
+  EXPECT_EQ(1, count);
+  EXPECT_FALSE(set.Lookup(0));
+  EXPECT_TRUE(set.Lookup(kPointerSize));
+  EXPECT_TRUE(set.Lookup(2 * kPointerSize));
+  EXPECT_TRUE(set.Lookup(3 * kPointerSize));
+  set.RemoveRange(0, Page::kPageSize, SlotSet::FREE_EMPTY_BUCKETS);
+  // The now empty sparse bucket is pre-freed like a bitmap bucket.
+  set.PreFreeEmptyBuckets();
+  EXPECT_EQ(1, set.NumberOfPreFreedEmptyBuckets());
+  for (int i = 0; i < 4; i++) {
+    EXPECT_FALSE(set.Lookup(i * kPointerSize));
+  }
+  set.FreeToBeFreedBuckets();
+  EXPECT_EQ(0, set.NumberOfPreFreedEmptyBuckets());
+}
+
+TEST(SlotSet, PreFreeSparseBucket) {
+  SlotSet set;
+  set.SetPageStart(0);
+  set.Insert(kPointerSize);
+  int count = set.Iterate([](MaybeObjectSlot slot) { return REMOVE_SLOT; },
+                          SlotSet::PREFREE_EMPTY_BUCKETS);
+  EXPECT_EQ(0, count);
+  // The sparse bucket is unlinked but stays allocated until it is freed
+  // explicitly.
+  EXPECT_EQ(1, set.NumberOfPreFreedEmptyBuckets());
+  EXPECT_FALSE(set.Lookup(kPointerSize));
+  set.RemoveRange(0, 2 * kPointerSize, SlotSet::KEEP_EMPTY_BUCKETS);
+  set.FreeToBeFreedBuckets();
+  EXPECT_EQ(0, set.NumberOfPreFreedEmptyBuckets());
+}
+
+namespace {
+
+class SlotSetInsertingThread final : public base::Thread {
+ public:
+  SlotSetInsertingThread(SlotSet* set, int first_slot, int slots)
+      : base::Thread(Options("SlotSetInsertingThread")),
+        set_(set),
+        first_slot_(first_slot),
+        slots_(slots) {}
+
+  void Run() final {
+    for (int i = 0; i < slots_; i++) {
+      set_->Insert((first_slot_ + i) * kPointerSize);
+    }
+  }
+
+ private:
+  SlotSet* const set_;
+  const int first_slot_;
+  const int slots_;
+};
+
+class SlotSetRemovingThread final : public base::Thread {
+ public:
+  SlotSetRemovingThread(SlotSet* set, int iterations)
+      : base::Thread(Options("SlotSetRemovingThread")),
+        set_(set),
+        iterations_(iterations) {}
+
+  void Run() final {
+    for (int i = 0; i < iterations_; i++) {
+      set_->RemoveRange(kPointerSize, 2 * kPointerSize,
+                        SlotSet::KEEP_EMPTY_BUCKETS);
+    }
+  }
+
+ private:
+  SlotSet* const set_;
+  const int iterations_;
+};
+
+}  // namespace
+
+TEST(SlotSet, ConcurrentRemoveRangeAndPreFreeSparseBucket) {
+  // The removing thread reads sparse buckets that the main thread keeps
+  // pre-freeing. They must stay allocated until FreeToBeFreedBuckets().
+  const int kIterations = 1000;
+  SlotSet set;
+  set.SetPageStart(0);
+  SlotSetRemovingThread thread(&set, kIterations);
+  thread.Start();
+  for (int i = 0; i < kIterations; i++) {
+    set.Insert(kPointerSize);
+    set.Iterate([](MaybeObjectSlot slot) { return REMOVE_SLOT; },
+                SlotSet::PREFREE_EMPTY_BUCKETS);
+  }
+  thread.Join();
+  EXPECT_FALSE(set.Lookup(kPointerSize));
+  set.FreeToBeFreedBuckets();
+  EXPECT_EQ(0, set.NumberOfPreFreedEmptyBuckets());
+}
+
+TEST(SlotSet, ConcurrentInsertIntoSparseBucket) {
+  // The threads insert overlapping ranges of the first bucket, so that they
+  // race on the same sparse entries and on the upgrade to a bitmap.
+  const int kThreads = 4;
+  const int kSlotsPerThread = 12;
+  const int kStride = 4;
+  const int kSlots = (kThreads - 1) * kStride + kSlotsPerThread;
+  SlotSet set;
+  set.SetPageStart(0);
+  std::unique_ptr<SlotSetInsertingThread> threads[kThreads];
+  for (int i = 0; i < kThreads; i++) {
+    threads[i].reset(
+        new SlotSetInsertingThread(&set, i * kStride, kSlotsPerThread));
+  }
+  for (int i = 0; i < kThreads; i++) threads[i]->Start();
+  for (int i = 0; i < kThreads; i++) threads[i]->Join();
+  for (int i = 0; i < kSlots + 1; i++) {
+    EXPECT_EQ(i < kSlots, set.Lookup(i * kPointerSize));
+  }
+  int count = set.Iterate([](MaybeObjectSlot slot) { return KEEP_SLOT; },
+                          SlotSet::KEEP_EMPTY_BUCKETS);
+  EXPECT_EQ(kSlots, count);
+}
+
 TEST(SlotSet, Remove) {
   SlotSet set;
   set.SetPageStart(0);
@@ -107,6 +107,18 @@ TEST(WorkListTest, SegmentUpdate) {
   EXPECT_EQ(object, objectB);
 }
 
+TEST(WorkListTest, SegmentSplit) {
+  TestWorklist::Segment segment;
+  TestWorklist::Segment other;
+  SomeObject dummy;
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(segment.Push(&dummy));
+  }
+  segment.Split(&other);
+  EXPECT_EQ(2u, segment.Size());
+  EXPECT_EQ(2u, other.Size());
+}
+
 TEST(WorkListTest, CreateEmpty) {
   TestWorklist worklist;
   TestWorklist::View worklist_view(&worklist, 0);
@@ -327,5 +339,33 @@ TEST(WorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsEmpty());
 }
 
+TEST(WorkListTest, RequestWorkSharesHalfOfPushSegment) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  SomeObject* retrieved = nullptr;
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy));
+  }
+  EXPECT_FALSE(worklist_view2.Pop(&retrieved));
+  worklist_view2.RequestWork();
+  EXPECT_TRUE(worklist.IsWorkRequested());
+  // The next push of the busy task shares work.
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  EXPECT_FALSE(worklist.IsWorkRequested());
+  EXPECT_FALSE(worklist.IsGlobalPoolEmpty());
+  EXPECT_EQ(2u, worklist_view1.LocalPushSegmentSize());
+  for (int i = 0; i < 2; i++) {
+    EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+    EXPECT_EQ(&dummy, retrieved);
+  }
+  EXPECT_FALSE(worklist_view2.Pop(&retrieved));
+  for (int i = 0; i < 2; i++) {
+    EXPECT_TRUE(worklist_view1.Pop(&retrieved));
+  }
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -47,6 +47,31 @@ TEST(TaskQueueTest, Basic) {
 }
 
 
+TEST(TaskQueueTest, Priorities) {
+  TaskQueue queue;
+  std::unique_ptr<Task> low(new MockTask());
+  std::unique_ptr<Task> normal(new MockTask());
+  std::unique_ptr<Task> high(new MockTask());
+  Task* low_ptr = low.get();
+  Task* normal_ptr = normal.get();
+  Task* high_ptr = high.get();
+  queue.Append(std::move(low), TaskQueue::Priority::kLow);
+  queue.Append(std::move(normal));
+  queue.Append(std::move(high), TaskQueue::Priority::kHigh);
+  EXPECT_EQ(high_ptr, queue.GetNext().get());
+  EXPECT_EQ(normal_ptr, queue.GetNext().get());
+  EXPECT_EQ(low_ptr, queue.GetNext().get());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+TEST(TaskQueueTest, AppendAfterTerminate) {
+  TaskQueue queue;
+  queue.Terminate();
+  EXPECT_FALSE(queue.Append(std::unique_ptr<Task>(new MockTask())));
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
 TEST(TaskQueueTest, TerminateMultipleReaders) {
   TaskQueue queue;
   TaskQueueThread thread1(&queue);
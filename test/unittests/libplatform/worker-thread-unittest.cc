@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "include/v8-platform.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
 #include "src/libplatform/task-queue.h"
 #include "src/libplatform/worker-thread.h"
 #include "testing/gmock/include/gmock/gmock.h"
@@ -64,6 +65,20 @@ TEST(WorkerThreadTest, Basic) {
   queue.Terminate();
 }
 
+TEST(WorkerThreadTest, PostAfterTerminate) {
+  DefaultWorkerThreadsTaskRunner runner(1);
+  runner.Terminate();
+
+  // Tasks posted after termination are deleted without running.
+  std::unique_ptr<StrictMock<MockTask>> task(new StrictMock<MockTask>);
+  EXPECT_CALL(*task.get(), Die());
+  runner.PostTask(std::move(task));
+
+  std::unique_ptr<StrictMock<MockTask>> delayed_task(new StrictMock<MockTask>);
+  EXPECT_CALL(*delayed_task.get(), Die());
+  runner.PostDelayedTask(std::move(delayed_task), 1.0);
+}
+
 }  // namespace worker_thread_unittest
 }  // namespace platform
 }  // namespace v8
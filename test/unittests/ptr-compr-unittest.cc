@@ -0,0 +1,57 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ptr-compr-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if V8_TARGET_ARCH_64_BIT
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const Address kIsolateRoot = Address{0x1234} * kPtrComprIsolateRootAlignment;
+
+}  // namespace
+
+TEST(PtrComprTest, RootFromOnHeapAddress) {
+  const Address kReservationStart = kIsolateRoot - kPtrComprIsolateRootBias;
+  const Address kReservationEnd =
+      kReservationStart + kPtrComprHeapReservationSize;
+  EXPECT_EQ(kIsolateRoot, GetRootFromOnHeapAddress(kReservationStart));
+  EXPECT_EQ(kIsolateRoot, GetRootFromOnHeapAddress(kIsolateRoot));
+  EXPECT_EQ(kIsolateRoot, GetRootFromOnHeapAddress(kReservationEnd - 1));
+  EXPECT_NE(kIsolateRoot, GetRootFromOnHeapAddress(kReservationEnd));
+}
+
+TEST(PtrComprTest, RoundTripHeapObject) {
+  const Address kSlot = kIsolateRoot + 0x100;
+  const Address kObjects[] = {
+      kIsolateRoot - kPtrComprIsolateRootBias + kHeapObjectTag,
+      kIsolateRoot + kHeapObjectTag,
+      kIsolateRoot + kPtrComprIsolateRootBias - kTaggedSize + kHeapObjectTag};
+  for (Address object : kObjects) {
+    uint32_t compressed = CompressTagged(object);
+    EXPECT_EQ(object, DecompressTaggedPointer(kSlot, compressed));
+    EXPECT_EQ(object, DecompressTaggedAny(kSlot, compressed));
+  }
+}
+
+TEST(PtrComprTest, RoundTripSmi) {
+  const Address kSlot = kIsolateRoot + 0x100;
+  const int32_t kValues[] = {0, 1, -1, 0x3fffffff, -0x40000000};
+  for (int32_t value : kValues) {
+    // Compressed smis are 31-bit values shifted by the smi tag size.
+    Address smi = static_cast<Address>(static_cast<intptr_t>(value) << 1);
+    uint32_t compressed = CompressTagged(smi);
+    EXPECT_EQ(smi, DecompressTaggedSigned(compressed));
+    EXPECT_EQ(smi, DecompressTaggedAny(kSlot, compressed));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_64_BIT
@@ -113,6 +113,34 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, AsciiRunsOverrunBuffer) {
+  // Long ASCII runs between multi-byte sequences, and invalid bytes, are
+  // decoded past the end of the buffer the same way as within it.
+  std::vector<byte> bytes;
+  for (int i = 0; i < 40; i++) {
+    for (int j = 0; j < i; j++) bytes.push_back('a' + j % 26);
+    bytes.push_back(0xC3);
+    bytes.push_back(0xA9);
+    if (i % 3 == 0) bytes.push_back(0xFF);
+    if (i % 5 == 0) {
+      bytes.insert(bytes.end(), {0xF0, 0x90, 0x80, 0x80});
+    }
+  }
+
+  std::vector<unibrow::uchar> expected;
+  DecodeNormally(bytes, &expected);
+
+  unibrow::Utf8Decoder<2> small_decoder;
+  std::vector<unibrow::uchar> output_small;
+  DecodeUtf16(&small_decoder, bytes, &output_small);
+  EXPECT_EQ(expected, output_small);
+
+  unibrow::Utf8Decoder<4096> large_decoder;
+  std::vector<unibrow::uchar> output_large;
+  DecodeUtf16(&large_decoder, bytes, &output_large);
+  EXPECT_EQ(expected, output_large);
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
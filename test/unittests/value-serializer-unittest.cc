@@ -885,6 +885,32 @@ TEST_F(ValueSerializerTest, RoundTripArray) {
   ExpectScriptTrue("result.hasOwnProperty(1)");
 }
 
+TEST_F(ValueSerializerTest, EncodePackedArrays) {
+  // Packed Smi and double arrays are encoded directly into the buffer; the
+  // wire format must match the per-element encoding.
+  std::vector<uint8_t> encoded =
+      EncodeTest(EvaluateScriptForInput("[0, -1, 64, -1073741824]"));
+  EXPECT_EQ(std::vector<uint8_t>({0xFF, 0x0D, 0x41, 0x04, 0x49, 0x00, 0x49,
+                                  0x01, 0x49, 0x80, 0x01, 0x49, 0xFF, 0xFF,
+                                  0xFF, 0xFF, 0x07, 0x24, 0x00, 0x04}),
+            encoded);
+
+  encoded = EncodeTest(EvaluateScriptForInput("[0.5]"));
+  ASSERT_EQ(16u, encoded.size());
+  EXPECT_EQ(0x4E, encoded[4]);
+  double value;
+  memcpy(&value, &encoded[5], sizeof(value));
+  EXPECT_EQ(0.5, value);
+
+  Local<Value> result = RoundTripTest(
+      "Array.from({length: 10000}, (_, i) => (i % 2 ? -i : i) << 16)");
+  ASSERT_TRUE(result->IsArray());
+  ExpectScriptTrue("result.every((x, i) => x === (i % 2 ? -i : i) << 16)");
+  result = RoundTripTest("Array.from({length: 10000}, (_, i) => i + 0.5)");
+  ASSERT_TRUE(result->IsArray());
+  ExpectScriptTrue("result.every((x, i) => x === i + 0.5)");
+}
+
 TEST_F(ValueSerializerTest, DecodeArray) {
   // A simple array of integers.
   Local<Value> value =
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/flags.h"
 #include "src/zone/accounting-allocator.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -28,5 +29,31 @@ TEST(Zone, SegmentPoolConstraints) {
   }
 }
 
+TEST(Zone, LargeSegmentPoolDisabledByDefault) {
+  const size_t kLargeSegmentSize = AccountingAllocator::kLargeSegmentSize;
+  AccountingAllocator allocator;
+  Segment* segment = allocator.GetSegment(kLargeSegmentSize);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+TEST(Zone, LargeSegmentPool) {
+  const size_t kLargeSegmentSize = AccountingAllocator::kLargeSegmentSize;
+  size_t old_pool_size = FLAG_zone_large_segment_pool_size;
+  FLAG_zone_large_segment_pool_size = kLargeSegmentSize;
+  AccountingAllocator allocator;
+  Segment* segment = allocator.GetSegment(kLargeSegmentSize);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(kLargeSegmentSize, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.GetSegment(kLargeSegmentSize));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(segment);
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  FLAG_zone_large_segment_pool_size = old_pool_size;
+}
+
 }  // namespace internal
 }  // namespace v8